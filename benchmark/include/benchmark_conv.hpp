@@ -285,6 +285,7 @@ CPM_DIRECT_SECTION_TWO_PASS_NS_PF(Name, Policy, \
     STDFIX_SECTION_FUNCTOR("std", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::conv4_impl::STD, Function(a, b)); }) \
     VEC_SECTION_FUNCTOR("vec", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::conv4_impl::VEC, Function(a, b)); }) \
     VEC_SECTION_FUNCTOR("blas_vec", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::conv4_impl::BLAS_VEC, Function(a, b)); }) \
+    VEC_SECTION_FUNCTOR("winograd", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::conv4_impl::WINOGRAD, Function(a, b)); }) \
     BLAS_SECTION_FUNCTOR("blas_mkl", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::conv4_impl::BLAS_MKL, Function(a, b)); }) \
     CUDNN_SECTION_FUNCTOR("cudnn", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::conv4_impl::CUDNN, Function(a, b)); }) \
 )
@@ -258,6 +258,125 @@ CPM_BENCH() {
         );
 }
 
+//Bench sin
+CPM_BENCH() {
+    CPM_TWO_PASS_NS(
+        "ssin [std][sin][s]",
+        [](size_t d){ return std::make_tuple(svec(d), svec(d)); },
+        [](svec& a, svec& r){ r = etl::sin(a); },
+        [](size_t d){ return 100 * d; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "dsin [std][sin][d]",
+        [](size_t d){ return std::make_tuple(dvec(d), dvec(d)); },
+        [](dvec& a, dvec& r){ r = etl::sin(a); },
+        [](size_t d){ return 100 * d; }
+        );
+}
+
+//Bench cos
+CPM_BENCH() {
+    CPM_TWO_PASS_NS(
+        "scos [std][cos][s]",
+        [](size_t d){ return std::make_tuple(svec(d), svec(d)); },
+        [](svec& a, svec& r){ r = etl::cos(a); },
+        [](size_t d){ return 100 * d; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "dcos [std][cos][d]",
+        [](size_t d){ return std::make_tuple(dvec(d), dvec(d)); },
+        [](dvec& a, dvec& r){ r = etl::cos(a); },
+        [](size_t d){ return 100 * d; }
+        );
+}
+
+//Bench tanh
+CPM_BENCH() {
+    CPM_TWO_PASS_NS(
+        "stanh [std][tanh][s]",
+        [](size_t d){ return std::make_tuple(svec(d), svec(d)); },
+        [](svec& a, svec& r){ r = etl::tanh(a); },
+        [](size_t d){ return 100 * d; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "dtanh [std][tanh][d]",
+        [](size_t d){ return std::make_tuple(dvec(d), dvec(d)); },
+        [](dvec& a, dvec& r){ r = etl::tanh(a); },
+        [](size_t d){ return 100 * d; }
+        );
+}
+
+//Bench sinh
+CPM_BENCH() {
+    CPM_TWO_PASS_NS(
+        "ssinh [std][sinh][s]",
+        [](size_t d){ return std::make_tuple(svec(d), svec(d)); },
+        [](svec& a, svec& r){ r = etl::sinh(a); },
+        [](size_t d){ return 100 * d; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "dsinh [std][sinh][d]",
+        [](size_t d){ return std::make_tuple(dvec(d), dvec(d)); },
+        [](dvec& a, dvec& r){ r = etl::sinh(a); },
+        [](size_t d){ return 100 * d; }
+        );
+}
+
+//Bench cosh
+CPM_BENCH() {
+    CPM_TWO_PASS_NS(
+        "scosh [std][cosh][s]",
+        [](size_t d){ return std::make_tuple(svec(d), svec(d)); },
+        [](svec& a, svec& r){ r = etl::cosh(a); },
+        [](size_t d){ return 200 * d; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "dcosh [std][cosh][d]",
+        [](size_t d){ return std::make_tuple(dvec(d), dvec(d)); },
+        [](dvec& a, dvec& r){ r = etl::cosh(a); },
+        [](size_t d){ return 200 * d; }
+        );
+}
+
+//Bench softplus
+CPM_BENCH() {
+    CPM_TWO_PASS_NS(
+        "ssoftplus [std][softplus][s]",
+        [](size_t d){ return std::make_tuple(svec(d), svec(d)); },
+        [](svec& a, svec& r){ r = etl::softplus(a); },
+        [](size_t d){ return 200 * d; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "dsoftplus [std][softplus][d]",
+        [](size_t d){ return std::make_tuple(dvec(d), dvec(d)); },
+        [](dvec& a, dvec& r){ r = etl::softplus(a); },
+        [](size_t d){ return 200 * d; }
+        );
+}
+
+//Bench invsqrt
+CPM_BENCH() {
+    CPM_TWO_PASS_NS(
+        "sinvsqrt [std][invsqrt][s]",
+        [](size_t d){ return std::make_tuple(svec(d), svec(d)); },
+        [](svec& a, svec& r){ r = etl::invsqrt(a); },
+        [](size_t d){ return 2 * d; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "dinvsqrt [std][invsqrt][d]",
+        [](size_t d){ return std::make_tuple(dvec(d), dvec(d)); },
+        [](dvec& a, dvec& r){ r = etl::invsqrt(a); },
+        [](size_t d){ return 2 * d; }
+        );
+}
+
 CPM_DIRECT_SECTION_TWO_PASS_NS_P("ssum [std][sum][s]", dot_policy,
     CPM_SECTION_INIT([](size_t d1){ return std::make_tuple(svec(d1)); }),
     CPM_SECTION_FUNCTOR("default", [](svec& a){ float_ref += etl::sum(a); }),
@@ -299,6 +418,7 @@ CPM_DIRECT_SECTION_TWO_PASS_NS_P("strans [transpose][s]", trans_policy,
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2), smat(d2,d1)); }),
     CPM_SECTION_FUNCTOR("default", [](smat& a, smat& r){ r = transpose(a); }),
     CPM_SECTION_FUNCTOR("std", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::STD, transpose(a)); })
+    VEC_SECTION_FUNCTOR("vec", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::VEC, transpose(a)); })
     BLAS_SECTION_FUNCTOR("blas", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::MKL, transpose(a)); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::CUBLAS, transpose(a)); })
 )
@@ -307,6 +427,7 @@ CPM_DIRECT_SECTION_TWO_PASS_NS_P("inplace_strans [transpose][s]", trans_policy,
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2)); }),
     CPM_SECTION_FUNCTOR("default", [](smat& r){ r.transpose_inplace(); }),
     CPM_SECTION_FUNCTOR("std", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::STD){ r.transpose_inplace(); } })
+    VEC_SECTION_FUNCTOR("vec", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::VEC){ r.transpose_inplace(); } })
     BLAS_SECTION_FUNCTOR("blas", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::MKL){ r.transpose_inplace(); } })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::CUBLAS){ r.transpose_inplace(); } })
 )
@@ -0,0 +1,550 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file avx512_exp.hpp
+ * \brief AVX-512 implementation of exp, log, sin, cos, tanh and sinh
+ *
+ * The polynomials are the same as the ones of the AVX versions (from
+ * the Cephes library), but the range reduction and the special values
+ * are handled with the AVX-512 instructions (getexp, getmant, scalef and
+ * masks), so that the full width of the registers is used.
+ */
+
+#pragma once
+
+#ifdef __AVX512F__
+
+#include <limits>
+
+#include <immintrin.h>
+
+#define ETL_INLINE_VEC_512 ETL_STATIC_INLINE(__m512)
+#define ETL_INLINE_VEC_512D ETL_STATIC_INLINE(__m512d)
+
+namespace etl {
+
+/*!
+ * \brief AVX-512-Vectorized exponential in double-precision
+ *
+ * The maximum error is 1 ULP, the result overflows to infinity for x > 709.78
+ * and underflows to zero for x < -745.13.
+ *
+ * \param x The vector of numbers to compute the exponential from
+ * \return a vector containing the exponential of the input vector values
+ */
+ETL_INLINE_VEC_512D exp512_pd(__m512d x) {
+    // The bounds are the first operands so that NaN is kept
+    x = _mm512_min_pd(_mm512_set1_pd(710.0), x);
+    x = _mm512_max_pd(_mm512_set1_pd(-746.0), x);
+
+    // exp(x) = 2^r * exp(x - r * log(2))
+    __m512d r = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(1.44269504088896340736)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    x = _mm512_fnmadd_pd(r, _mm512_set1_pd(0.693145751953125), x);
+    x = _mm512_fnmadd_pd(r, _mm512_set1_pd(1.42860682030941723212E-6), x);
+
+    // Compute e^x - 1 with the Taylor expansion up to x^13
+
+    __m512d x2 = _mm512_mul_pd(x, x);
+    __m512d x4 = _mm512_mul_pd(x2, x2);
+    __m512d x8 = _mm512_mul_pd(x4, x4);
+
+    __m512d pt1 = _mm512_fmadd_pd(_mm512_set1_pd(1.0 / 6227020800.0), x, _mm512_set1_pd(1.0 / 479001600.0));
+    __m512d pt2 = _mm512_fmadd_pd(_mm512_set1_pd(1.0 / 39916800.0), x, _mm512_set1_pd(1.0 / 3628800.0));
+    __m512d pt3 = _mm512_fmadd_pd(_mm512_set1_pd(1.0 / 362880.0), x, _mm512_set1_pd(1.0 / 40320.0));
+    __m512d pt4 = _mm512_fmadd_pd(_mm512_set1_pd(1.0 / 5040.0), x, _mm512_set1_pd(1.0 / 720.0));
+    __m512d pt5 = _mm512_fmadd_pd(_mm512_set1_pd(1.0 / 120.0), x, _mm512_set1_pd(1.0 / 24.0));
+    __m512d pt6 = _mm512_fmadd_pd(_mm512_set1_pd(1.0 / 6.0), x, _mm512_set1_pd(1.0 / 2.0));
+
+    __m512d pt7  = _mm512_fmadd_pd(pt2, x2, pt3);
+    __m512d pt8  = _mm512_fmadd_pd(pt4, x2, pt5);
+    __m512d pt9  = _mm512_fmadd_pd(pt6, x2, x);
+    __m512d pt10 = _mm512_fmadd_pd(pt1, x4, pt7);
+    __m512d pt11 = _mm512_fmadd_pd(pt8, x4, pt9);
+
+    __m512d z = _mm512_fmadd_pd(pt10, x8, pt11);
+
+    // scalef handles the overflow and the denormal results
+    return _mm512_scalef_pd(_mm512_add_pd(z, _mm512_set1_pd(1.0)), r);
+}
+
+/*!
+ * \brief AVX-512-Vectorized exponential in single-precision
+ *
+ * The maximum error is 1 ULP, the result overflows to infinity for x > 88.72
+ * and underflows to zero for x < -103.97.
+ *
+ * \param x The vector of numbers to compute the exponential from
+ * \return a vector containing the exponential of the input vector values
+ */
+ETL_INLINE_VEC_512 exp512_ps(__m512 x) {
+    // The bounds are the first operands so that NaN is kept
+    x = _mm512_min_ps(_mm512_set1_ps(89.0f), x);
+    x = _mm512_max_ps(_mm512_set1_ps(-104.0f), x);
+
+    // exp(x) = 2^r * exp(x - r * log(2))
+    __m512 r = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    x = _mm512_fnmadd_ps(r, _mm512_set1_ps(0.693359375f), x);
+    x = _mm512_fnmadd_ps(r, _mm512_set1_ps(-2.12194440e-4f), x);
+
+    __m512 z = _mm512_mul_ps(x, x);
+
+    __m512 y = _mm512_set1_ps(1.9875691500E-4f);
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.3981999507E-3f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(8.3334519073E-3f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(4.1665795894E-2f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.6666665459E-1f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(5.0000001201E-1f));
+    y        = _mm512_fmadd_ps(y, z, x);
+    y        = _mm512_add_ps(y, _mm512_set1_ps(1.0f));
+
+    // scalef handles the overflow and the denormal results
+    return _mm512_scalef_ps(y, r);
+}
+
+/*!
+ * \brief AVX-512-Vectorized logarithm in double-precision
+ *
+ * The maximum error is 1 ULP for positive normal and denormal inputs.
+ *
+ * \param x The vector of numbers to compute the logarithm from
+ * \return a vector containing the logarithms of the input vector values
+ */
+ETL_INLINE_VEC_512D log512_pd(__m512d x) {
+    const __m512d one  = _mm512_set1_pd(1.0);
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d inf  = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+
+    __mmask8 invalid_mask = _mm512_cmp_pd_mask(x, zero, _CMP_NGE_UQ); // negative args and NaN will be NaN
+    __mmask8 zero_mask    = _mm512_cmp_pd_mask(x, zero, _CMP_EQ_OQ);
+    __mmask8 inf_mask     = _mm512_cmp_pd_mask(x, inf, _CMP_EQ_OQ);
+
+    // x = m * 2^e with m in [0.5, 1[, denormals included
+    __m512d e = _mm512_add_pd(_mm512_getexp_pd(x), one);
+    x         = _mm512_getmant_pd(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+
+    // x = 2 * m - 1 for m < sqrt(0.5), m - 1 otherwise
+    __mmask8 mask = _mm512_cmp_pd_mask(x, _mm512_set1_pd(0.70710678118654752440), _CMP_LT_OQ);
+    x             = _mm512_mask_add_pd(x, mask, x, x);
+    x             = _mm512_sub_pd(x, one);
+    e             = _mm512_mask_sub_pd(e, mask, e, one);
+
+    __m512d z = _mm512_mul_pd(x, x);
+
+    // log(1 + x) = x - x^2 / 2 + x^3 * P(x) / Q(x)
+
+    __m512d p = _mm512_set1_pd(1.01875663804580931796E-4);
+    p         = _mm512_fmadd_pd(p, x, _mm512_set1_pd(4.97494994976747001425E-1));
+    p         = _mm512_fmadd_pd(p, x, _mm512_set1_pd(4.70579119878881725854E0));
+    p         = _mm512_fmadd_pd(p, x, _mm512_set1_pd(1.44989225341610930846E1));
+    p         = _mm512_fmadd_pd(p, x, _mm512_set1_pd(1.79368678507819816313E1));
+    p         = _mm512_fmadd_pd(p, x, _mm512_set1_pd(7.70838733755885391666E0));
+
+    __m512d q = _mm512_add_pd(x, _mm512_set1_pd(1.12873587189167450590E1));
+    q         = _mm512_fmadd_pd(q, x, _mm512_set1_pd(4.52279145837532221105E1));
+    q         = _mm512_fmadd_pd(q, x, _mm512_set1_pd(8.29875266912776603211E1));
+    q         = _mm512_fmadd_pd(q, x, _mm512_set1_pd(7.11544750618563894466E1));
+    q         = _mm512_fmadd_pd(q, x, _mm512_set1_pd(2.31251620126765340583E1));
+
+    __m512d y = _mm512_mul_pd(_mm512_mul_pd(x, z), _mm512_div_pd(p, q));
+
+    y = _mm512_fnmadd_pd(e, _mm512_set1_pd(2.121944400546905827679e-4), y);
+    y = _mm512_fnmadd_pd(z, _mm512_set1_pd(0.5), y);
+    x = _mm512_add_pd(x, y);
+    x = _mm512_fmadd_pd(e, _mm512_set1_pd(0.693359375), x);
+
+    // Special values
+    x = _mm512_mask_mov_pd(x, zero_mask, _mm512_set1_pd(-std::numeric_limits<double>::infinity()));
+    x = _mm512_mask_mov_pd(x, inf_mask, inf);
+    x = _mm512_mask_mov_pd(x, invalid_mask, _mm512_set1_pd(std::numeric_limits<double>::quiet_NaN()));
+
+    return x;
+}
+
+/*!
+ * \brief AVX-512-Vectorized logarithm in single-precision
+ *
+ * The maximum error is 1 ULP for positive normal and denormal inputs.
+ *
+ * \param x The vector of numbers to compute the logarithm from
+ * \return a vector containing the logarithms of the input vector values
+ */
+ETL_INLINE_VEC_512 log512_ps(__m512 x) {
+    const __m512 one  = _mm512_set1_ps(1.0f);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 inf  = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+
+    __mmask16 invalid_mask = _mm512_cmp_ps_mask(x, zero, _CMP_NGE_UQ); // negative args and NaN will be NaN
+    __mmask16 zero_mask    = _mm512_cmp_ps_mask(x, zero, _CMP_EQ_OQ);
+    __mmask16 inf_mask     = _mm512_cmp_ps_mask(x, inf, _CMP_EQ_OQ);
+
+    // x = m * 2^e with m in [0.5, 1[, denormals included
+    __m512 e = _mm512_add_ps(_mm512_getexp_ps(x), one);
+    x        = _mm512_getmant_ps(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+
+    // x = 2 * m - 1 for m < sqrt(0.5), m - 1 otherwise
+    __mmask16 mask = _mm512_cmp_ps_mask(x, _mm512_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+    x              = _mm512_mask_add_ps(x, mask, x, x);
+    x              = _mm512_sub_ps(x, one);
+    e              = _mm512_mask_sub_ps(e, mask, e, one);
+
+    __m512 z = _mm512_mul_ps(x, x);
+
+    __m512 y = _mm512_set1_ps(7.0376836292E-2f);
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-1.1514610310E-1f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.1676998740E-1f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-1.2420140846E-1f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.4249322787E-1f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-1.6668057665E-1f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(2.0000714765E-1f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-2.4999993993E-1f));
+    y        = _mm512_fmadd_ps(y, x, _mm512_set1_ps(3.3333331174E-1f));
+    y        = _mm512_mul_ps(_mm512_mul_ps(y, x), z);
+
+    y = _mm512_fmadd_ps(e, _mm512_set1_ps(-2.12194440e-4f), y);
+    y = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+    x = _mm512_add_ps(x, y);
+    x = _mm512_fmadd_ps(e, _mm512_set1_ps(0.693359375f), x);
+
+    // Special values
+    x = _mm512_mask_mov_ps(x, zero_mask, _mm512_set1_ps(-std::numeric_limits<float>::infinity()));
+    x = _mm512_mask_mov_ps(x, inf_mask, inf);
+    x = _mm512_mask_mov_ps(x, invalid_mask, _mm512_set1_ps(std::numeric_limits<float>::quiet_NaN()));
+
+    return x;
+}
+
+/*!
+ * \brief AVX-512-Vectorized sinus or cosinus in double-precision
+ * \param x The vector of numbers to compute the sinus or cosinus from
+ * \param cosinus Indicates if the cosinus or the sinus must be computed
+ * \return a vector containing the sinus or cosinus of the input vector values
+ */
+ETL_INLINE_VEC_512D sincos512_pd(__m512d x, bool cosinus) {
+    const __m512i sign_mask = _mm512_set1_epi64(0x8000000000000000LL);
+
+    __m512i sign_bit = _mm512_and_epi64(_mm512_castpd_si512(x), sign_mask);
+
+    x = _mm512_abs_pd(x);
+
+    // infinite and NaN arguments will be NaN
+    __mmask8 invalid_mask = _mm512_cmp_pd_mask(x, _mm512_set1_pd(std::numeric_limits<double>::infinity()), _CMP_NLT_UQ);
+
+    // j = (x * 4 / Pi) rounded to the next even integer
+    __m256i j = _mm512_cvttpd_epi32(_mm512_mul_pd(x, _mm512_set1_pd(1.27323954473516268615)));
+    j         = _mm256_add_epi32(j, _mm256_set1_epi32(1));
+    j         = _mm256_and_si256(j, _mm256_set1_epi32(~1));
+    __m512d y = _mm512_cvtepi32_pd(j);
+
+    __mmask8 swap_mask;
+
+    if (cosinus) {
+        j = _mm256_sub_epi32(j, _mm256_set1_epi32(2));
+
+        // The sign of x does not matter for the cosinus
+        sign_bit  = _mm512_setzero_si512();
+        swap_mask = static_cast<__mmask8>(_mm512_testn_epi32_mask(_mm512_castsi256_si512(j), _mm512_set1_epi32(4)));
+    } else {
+        swap_mask = static_cast<__mmask8>(_mm512_test_epi32_mask(_mm512_castsi256_si512(j), _mm512_set1_epi32(4)));
+    }
+
+    __mmask8 poly_mask = static_cast<__mmask8>(_mm512_testn_epi32_mask(_mm512_castsi256_si512(j), _mm512_set1_epi32(2)));
+
+    // Extended precision modular arithmetic: x = ((x - y * DP1) - y * DP2) - y * DP3
+    x = _mm512_fnmadd_pd(y, _mm512_set1_pd(7.85398125648498535156E-1), x);
+    x = _mm512_fnmadd_pd(y, _mm512_set1_pd(3.77489470793079817668E-8), x);
+    x = _mm512_fnmadd_pd(y, _mm512_set1_pd(2.69515142907905952645E-15), x);
+
+    __m512d z = _mm512_mul_pd(x, x);
+
+    // Cosinus polynomial (0 <= x <= Pi/4)
+
+    __m512d yc = _mm512_set1_pd(-1.13585365213876817300E-11);
+    yc         = _mm512_fmadd_pd(yc, z, _mm512_set1_pd(2.08757008419747316778E-9));
+    yc         = _mm512_fmadd_pd(yc, z, _mm512_set1_pd(-2.75573141792967388112E-7));
+    yc         = _mm512_fmadd_pd(yc, z, _mm512_set1_pd(2.48015872888517045348E-5));
+    yc         = _mm512_fmadd_pd(yc, z, _mm512_set1_pd(-1.38888888888730564116E-3));
+    yc         = _mm512_fmadd_pd(yc, z, _mm512_set1_pd(4.16666666666665929218E-2));
+    yc         = _mm512_mul_pd(_mm512_mul_pd(yc, z), z);
+    yc         = _mm512_fnmadd_pd(z, _mm512_set1_pd(0.5), yc);
+    yc         = _mm512_add_pd(yc, _mm512_set1_pd(1.0));
+
+    // Sinus polynomial (0 <= x <= Pi/4)
+
+    __m512d ys = _mm512_set1_pd(1.58962301576546568060E-10);
+    ys         = _mm512_fmadd_pd(ys, z, _mm512_set1_pd(-2.50507477628578072866E-8));
+    ys         = _mm512_fmadd_pd(ys, z, _mm512_set1_pd(2.75573136213857245213E-6));
+    ys         = _mm512_fmadd_pd(ys, z, _mm512_set1_pd(-1.98412698295895385996E-4));
+    ys         = _mm512_fmadd_pd(ys, z, _mm512_set1_pd(8.33333333332211858878E-3));
+    ys         = _mm512_fmadd_pd(ys, z, _mm512_set1_pd(-1.66666666666666307295E-1));
+    ys         = _mm512_fmadd_pd(_mm512_mul_pd(ys, z), x, x);
+
+    // select the correct result from the two polynoms and update the sign
+    __m512i r = _mm512_castpd_si512(_mm512_mask_blend_pd(poly_mask, yc, ys));
+    r         = _mm512_xor_epi64(r, sign_bit);
+    r         = _mm512_mask_xor_epi64(r, swap_mask, r, sign_mask);
+
+    return _mm512_mask_mov_pd(_mm512_castsi512_pd(r), invalid_mask, _mm512_set1_pd(std::numeric_limits<double>::quiet_NaN()));
+}
+
+/*!
+ * \brief AVX-512-Vectorized sinus in double-precision
+ *
+ * The maximum error is 1 ULP for |x| < 10^6 and a few ULP up to
+ * 2^30, larger arguments are not supported.
+ *
+ * \param x The vector of numbers to compute the sinus from
+ * \return a vector containing the sinus of the input vector values
+ */
+ETL_INLINE_VEC_512D sin512_pd(__m512d x) {
+    return sincos512_pd(x, false);
+}
+
+/*!
+ * \brief AVX-512-Vectorized cosinus in double-precision
+ *
+ * The maximum error is 1 ULP for |x| < 10^6 and a few ULP up to
+ * 2^30, larger arguments are not supported.
+ *
+ * \param x The vector of numbers to compute the cosinus from
+ * \return a vector containing the cosinus of the input vector values
+ */
+ETL_INLINE_VEC_512D cos512_pd(__m512d x) {
+    return sincos512_pd(x, true);
+}
+
+/*!
+ * \brief AVX-512-Vectorized sinus or cosinus in single-precision
+ * \param x The vector of numbers to compute the sinus or cosinus from
+ * \param cosinus Indicates if the cosinus or the sinus must be computed
+ * \return a vector containing the sinus or cosinus of the input vector values
+ */
+ETL_INLINE_VEC_512 sincos512_ps(__m512 x, bool cosinus) {
+    const __m512i sign_mask = _mm512_set1_epi32(0x80000000);
+
+    __m512i sign_bit = _mm512_and_epi32(_mm512_castps_si512(x), sign_mask);
+
+    x = _mm512_abs_ps(x);
+
+    // infinite and NaN arguments will be NaN
+    __mmask16 invalid_mask = _mm512_cmp_ps_mask(x, _mm512_set1_ps(std::numeric_limits<float>::infinity()), _CMP_NLT_UQ);
+
+    // j = (x * 4 / Pi) rounded to the next even integer
+    __m512i j = _mm512_cvttps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f)));
+    j         = _mm512_add_epi32(j, _mm512_set1_epi32(1));
+    j         = _mm512_and_epi32(j, _mm512_set1_epi32(~1));
+    __m512 y  = _mm512_cvtepi32_ps(j);
+
+    __mmask16 swap_mask;
+
+    if (cosinus) {
+        j = _mm512_sub_epi32(j, _mm512_set1_epi32(2));
+
+        // The sign of x does not matter for the cosinus
+        sign_bit  = _mm512_setzero_si512();
+        swap_mask = _mm512_testn_epi32_mask(j, _mm512_set1_epi32(4));
+    } else {
+        swap_mask = _mm512_test_epi32_mask(j, _mm512_set1_epi32(4));
+    }
+
+    __mmask16 poly_mask = _mm512_testn_epi32_mask(j, _mm512_set1_epi32(2));
+
+    // Extended precision modular arithmetic: x = ((x - y * DP1) - y * DP2) - y * DP3
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(0.78515625f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(2.4187564849853515625e-4f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(3.77489497744594108e-8f), x);
+
+    __m512 z = _mm512_mul_ps(x, x);
+
+    // Cosinus polynomial (0 <= x <= Pi/4)
+
+    __m512 yc = _mm512_set1_ps(2.443315711809948E-005f);
+    yc        = _mm512_fmadd_ps(yc, z, _mm512_set1_ps(-1.388731625493765E-003f));
+    yc        = _mm512_fmadd_ps(yc, z, _mm512_set1_ps(4.166664568298827E-002f));
+    yc        = _mm512_mul_ps(_mm512_mul_ps(yc, z), z);
+    yc        = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), yc);
+    yc        = _mm512_add_ps(yc, _mm512_set1_ps(1.0f));
+
+    // Sinus polynomial (0 <= x <= Pi/4)
+
+    __m512 ys = _mm512_set1_ps(-1.9515295891E-4f);
+    ys        = _mm512_fmadd_ps(ys, z, _mm512_set1_ps(8.3321608736E-3f));
+    ys        = _mm512_fmadd_ps(ys, z, _mm512_set1_ps(-1.6666654611E-1f));
+    ys        = _mm512_fmadd_ps(_mm512_mul_ps(ys, z), x, x);
+
+    // select the correct result from the two polynoms and update the sign
+    __m512i r = _mm512_castps_si512(_mm512_mask_blend_ps(poly_mask, yc, ys));
+    r         = _mm512_xor_epi32(r, sign_bit);
+    r         = _mm512_mask_xor_epi32(r, swap_mask, r, sign_mask);
+
+    return _mm512_mask_mov_ps(_mm512_castsi512_ps(r), invalid_mask, _mm512_set1_ps(std::numeric_limits<float>::quiet_NaN()));
+}
+
+/*!
+ * \brief AVX-512-Vectorized sinus in single-precision
+ *
+ * The maximum error is 1 ULP for |x| <= Pi, it grows with |x| (about 80 ULP at 1000).
+ *
+ * \param x The vector of numbers to compute the sinus from
+ * \return a vector containing the sinus of the input vector values
+ */
+ETL_INLINE_VEC_512 sin512_ps(__m512 x) {
+    return sincos512_ps(x, false);
+}
+
+/*!
+ * \brief AVX-512-Vectorized cosinus in single-precision
+ *
+ * The maximum error is 1 ULP for |x| <= Pi, it grows with |x| (about 80 ULP at 1000).
+ *
+ * \param x The vector of numbers to compute the cosinus from
+ * \return a vector containing the cosinus of the input vector values
+ */
+ETL_INLINE_VEC_512 cos512_ps(__m512 x) {
+    return sincos512_ps(x, true);
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic tangent in single-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_512 tanh512_ps(__m512 x) {
+    const __m512 one = _mm512_set1_ps(1.0f);
+
+    __m512i sign_bit = _mm512_and_epi32(_mm512_castps_si512(x), _mm512_set1_epi32(0x80000000));
+    __m512 z         = _mm512_abs_ps(x);
+
+    // tanh(|x|) = 1 - 2 / (exp(2|x|) + 1), tanh(20) is already 1
+    __m512 e     = exp512_ps(_mm512_mul_ps(_mm512_min_ps(_mm512_set1_ps(20.0f), z), _mm512_set1_ps(2.0f)));
+    __m512 large = _mm512_sub_ps(one, _mm512_div_ps(_mm512_set1_ps(2.0f), _mm512_add_ps(e, one)));
+    large        = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(large), sign_bit));
+
+    // tanh(x) = x + x^3 * P(x^2) for |x| <= 0.625
+
+    __m512 s     = _mm512_mul_ps(x, x);
+    __m512 small = _mm512_set1_ps(-5.70498872745E-3f);
+    small        = _mm512_fmadd_ps(small, s, _mm512_set1_ps(2.06390887954E-2f));
+    small        = _mm512_fmadd_ps(small, s, _mm512_set1_ps(-5.37397155531E-2f));
+    small        = _mm512_fmadd_ps(small, s, _mm512_set1_ps(1.33314422036E-1f));
+    small        = _mm512_fmadd_ps(small, s, _mm512_set1_ps(-3.33332819422E-1f));
+    small        = _mm512_fmadd_ps(_mm512_mul_ps(small, s), x, x);
+
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(z, _mm512_set1_ps(0.625f), _CMP_GT_OQ), small, large);
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic tangent in double-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_512D tanh512_pd(__m512d x) {
+    const __m512d one = _mm512_set1_pd(1.0);
+
+    __m512i sign_bit = _mm512_and_epi64(_mm512_castpd_si512(x), _mm512_set1_epi64(0x8000000000000000LL));
+    __m512d z        = _mm512_abs_pd(x);
+
+    // tanh(|x|) = 1 - 2 / (exp(2|x|) + 1), tanh(20) is already 1
+    __m512d e     = exp512_pd(_mm512_mul_pd(_mm512_min_pd(_mm512_set1_pd(20.0), z), _mm512_set1_pd(2.0)));
+    __m512d large = _mm512_sub_pd(one, _mm512_div_pd(_mm512_set1_pd(2.0), _mm512_add_pd(e, one)));
+    large         = _mm512_castsi512_pd(_mm512_or_epi64(_mm512_castpd_si512(large), sign_bit));
+
+    // tanh(x) = x + x^3 * P(x^2) / Q(x^2) for |x| <= 0.625
+
+    __m512d s = _mm512_mul_pd(x, x);
+
+    __m512d p = _mm512_set1_pd(-9.64399179425052238628E-1);
+    p         = _mm512_fmadd_pd(p, s, _mm512_set1_pd(-9.92877231001918586564E1));
+    p         = _mm512_fmadd_pd(p, s, _mm512_set1_pd(-1.61468768441708447952E3));
+
+    __m512d q = _mm512_add_pd(s, _mm512_set1_pd(1.12811678491632931402E2));
+    q         = _mm512_fmadd_pd(q, s, _mm512_set1_pd(2.23548839060100448583E3));
+    q         = _mm512_fmadd_pd(q, s, _mm512_set1_pd(4.84406305325125486048E3));
+
+    __m512d small = _mm512_fmadd_pd(_mm512_mul_pd(x, s), _mm512_div_pd(p, q), x);
+
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(z, _mm512_set1_pd(0.625), _CMP_GT_OQ), small, large);
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic sinus in single-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_512 sinh512_ps(__m512 x) {
+    const __m512 half = _mm512_set1_ps(0.5f);
+
+    __m512i sign_bit = _mm512_and_epi32(_mm512_castps_si512(x), _mm512_set1_epi32(0x80000000));
+    __m512 z         = _mm512_abs_ps(x);
+
+    // sinh(|x|) = exp(|x|) / 2 - 1 / (2 * exp(|x|))
+    __m512 e     = exp512_ps(z);
+    __m512 large = _mm512_sub_ps(_mm512_mul_ps(half, e), _mm512_div_ps(half, e));
+    large        = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(large), sign_bit));
+
+    // sinh(x) = x + x^3 * P(x^2) for |x| <= 1
+
+    __m512 s     = _mm512_mul_ps(x, x);
+    __m512 small = _mm512_set1_ps(2.03721912945E-4f);
+    small        = _mm512_fmadd_ps(small, s, _mm512_set1_ps(8.33028376239E-3f));
+    small        = _mm512_fmadd_ps(small, s, _mm512_set1_ps(1.66667160211E-1f));
+    small        = _mm512_fmadd_ps(_mm512_mul_ps(small, s), x, x);
+
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(z, _mm512_set1_ps(1.0f), _CMP_GT_OQ), small, large);
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic sinus in double-precision
+ *
+ * The maximum error is 3 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_512D sinh512_pd(__m512d x) {
+    const __m512d half = _mm512_set1_pd(0.5);
+
+    __m512i sign_bit = _mm512_and_epi64(_mm512_castpd_si512(x), _mm512_set1_epi64(0x8000000000000000LL));
+    __m512d z        = _mm512_abs_pd(x);
+
+    // sinh(|x|) = exp(|x|) / 2 - 1 / (2 * exp(|x|))
+    __m512d e     = exp512_pd(z);
+    __m512d large = _mm512_sub_pd(_mm512_mul_pd(half, e), _mm512_div_pd(half, e));
+    large         = _mm512_castsi512_pd(_mm512_or_epi64(_mm512_castpd_si512(large), sign_bit));
+
+    // sinh(x) = x + x^3 * P(x^2) / Q(x^2) for |x| <= 1
+
+    __m512d s = _mm512_mul_pd(x, x);
+
+    __m512d p = _mm512_set1_pd(-7.89474443963537015605E-1);
+    p         = _mm512_fmadd_pd(p, s, _mm512_set1_pd(-1.63725857525983828727E2));
+    p         = _mm512_fmadd_pd(p, s, _mm512_set1_pd(-1.15614435765005216044E4));
+    p         = _mm512_fmadd_pd(p, s, _mm512_set1_pd(-3.51754964808151394800E5));
+
+    __m512d q = _mm512_add_pd(s, _mm512_set1_pd(-2.77711081420602794433E2));
+    q         = _mm512_fmadd_pd(q, s, _mm512_set1_pd(3.61578279834431989373E4));
+    q         = _mm512_fmadd_pd(q, s, _mm512_set1_pd(-2.11052978884890840399E6));
+
+    __m512d small = _mm512_fmadd_pd(_mm512_mul_pd(x, s), _mm512_div_pd(p, q), x);
+
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(z, _mm512_set1_pd(1.0), _CMP_GT_OQ), small, large);
+}
+
+} //end of namespace etl
+
+#endif //__AVX512F__
@@ -10,8 +10,6 @@
  * \brief Contains AVX-512 vectorized functions for the vectorized assignment of expressions
  */
 
-//TODO Implementation of AVX-512 complex multiplication and division
-
 #pragma once
 
 #ifdef __AVX512F__
@@ -19,19 +17,56 @@
 #include <immintrin.h>
 
 #include "etl/inline.hpp"
+#include "etl/avx512_exp.hpp"
 
 #ifdef VECT_DEBUG
 #include <iostream>
 #endif
 
-#define ETL_INLINE_VEC_VOID ETL_STATIC_INLINE(void)
-#define ETL_INLINE_VEC_512 ETL_STATIC_INLINE(__m512)
-#define ETL_INLINE_VEC_512D ETL_STATIC_INLINE(__m512d)
-#define ETL_OUT_VEC_2512ETL_OUT_INLINE(__m512)
-#define ETL_OUT_VEC_512D ETL_OUT_INLINE(__m512d)
-
 namespace etl {
 
+/*!
+ * \brief AVX-512 SIMD float type
+ */
+using avx512_simd_float = simd_pack<vector_mode_t::AVX512, float, __m512>;
+
+/*!
+ * \brief AVX-512 SIMD double type
+ */
+using avx512_simd_double = simd_pack<vector_mode_t::AVX512, double, __m512d>;
+
+/*!
+ * \brief AVX-512 SIMD complex float type
+ */
+template<typename T>
+using avx512_simd_complex_float = simd_pack<vector_mode_t::AVX512, T, __m512>;
+
+/*!
+ * \brief AVX-512 SIMD complex double type
+ */
+template<typename T>
+using avx512_simd_complex_double = simd_pack<vector_mode_t::AVX512, T, __m512d>;
+
+/*!
+ * \brief AVX-512 SIMD byte type
+ */
+using avx512_simd_byte = simd_pack<vector_mode_t::AVX512, int8_t, __m512i>;
+
+/*!
+ * \brief AVX-512 SIMD short type
+ */
+using avx512_simd_short = simd_pack<vector_mode_t::AVX512, int16_t, __m512i>;
+
+/*!
+ * \brief AVX-512 SIMD int type
+ */
+using avx512_simd_int = simd_pack<vector_mode_t::AVX512, int32_t, __m512i>;
+
+/*!
+ * \brief AVX-512 SIMD long type
+ */
+using avx512_simd_long = simd_pack<vector_mode_t::AVX512, int64_t, __m512i>;
+
 /*!
  * \brief Define traits to get vectorization information for types in AVX512 vector mode.
  */
@@ -53,7 +88,7 @@ struct avx512_intrinsic_traits<float> {
     static constexpr size_t size      = 16; ///< Numbers of elements in a vector
     static constexpr size_t alignment = 64;///< Necessary alignment, in bytes, for this type
 
-    using intrinsic_type = __m512; ///< The vector type
+    using intrinsic_type = avx512_simd_float; ///< The vector type
 };
 
 /*!
@@ -65,7 +100,7 @@ struct avx512_intrinsic_traits<double> {
     static constexpr size_t size      = 8; ///< Numbers of elements in a vector
     static constexpr size_t alignment = 64;///< Necessary alignment, in bytes, for this type
 
-    using intrinsic_type = __m512d; ///< The vector type
+    using intrinsic_type = avx512_simd_double; ///< The vector type
 };
 
 /*!
@@ -77,7 +112,7 @@ struct avx512_intrinsic_traits<std::complex<float>> {
     static constexpr size_t size      = 8; ///< Numbers of elements in a vector
     static constexpr size_t alignment = 64;///< Necessary alignment, in bytes, for this type
 
-    using intrinsic_type = __m512; ///< The vector type
+    using intrinsic_type = avx512_simd_complex_float<std::complex<float>>; ///< The vector type
 };
 
 /*!
@@ -89,7 +124,7 @@ struct avx512_intrinsic_traits<std::complex<double>> {
     static constexpr size_t size      = 4; ///< Numbers of elements in a vector
     static constexpr size_t alignment = 64;///< Necessary alignment, in bytes, for this type
 
-    using intrinsic_type = __m512d; ///< The vector type
+    using intrinsic_type = avx512_simd_complex_double<std::complex<double>>; ///< The vector type
 };
 
 /*!
@@ -101,7 +136,7 @@ struct avx512_intrinsic_traits<etl::complex<float>> {
     static constexpr size_t size      = 8; ///< Numbers of elements in a vector
     static constexpr size_t alignment = 64;///< Necessary alignment, in bytes, for this type
 
-    using intrinsic_type = __m512; ///< The vector type
+    using intrinsic_type = avx512_simd_complex_float<etl::complex<float>>; ///< The vector type
 };
 
 /*!
@@ -113,7 +148,59 @@ struct avx512_intrinsic_traits<etl::complex<double>> {
     static constexpr size_t size      = 4; ///< Numbers of elements in a vector
     static constexpr size_t alignment = 64;///< Necessary alignment, in bytes, for this type
 
-    using intrinsic_type = __m512d; ///< The vector type
+    using intrinsic_type = avx512_simd_complex_double<etl::complex<double>>; ///< The vector type
+};
+
+#ifdef __AVX512BW__
+
+/*!
+ * \copydoc avx512_intrinsic_traits
+ */
+template <>
+struct avx512_intrinsic_traits<int8_t> {
+    static constexpr bool vectorizable     = true; ///< Boolean flag indicating is vectorizable or not
+    static constexpr size_t size      = 64;  ///< Numbers of elements in a vector
+    static constexpr size_t alignment = 64;  ///< Necessary alignment, in bytes, for this type
+
+    using intrinsic_type = avx512_simd_byte; ///< The vector type
+};
+
+/*!
+ * \copydoc avx512_intrinsic_traits
+ */
+template <>
+struct avx512_intrinsic_traits<int16_t> {
+    static constexpr bool vectorizable     = true; ///< Boolean flag indicating is vectorizable or not
+    static constexpr size_t size      = 32;  ///< Numbers of elements in a vector
+    static constexpr size_t alignment = 64;  ///< Necessary alignment, in bytes, for this type
+
+    using intrinsic_type = avx512_simd_short; ///< The vector type
+};
+
+#endif
+
+/*!
+ * \copydoc avx512_intrinsic_traits
+ */
+template <>
+struct avx512_intrinsic_traits<int32_t> {
+    static constexpr bool vectorizable     = true; ///< Boolean flag indicating is vectorizable or not
+    static constexpr size_t size      = 16;  ///< Numbers of elements in a vector
+    static constexpr size_t alignment = 64;  ///< Necessary alignment, in bytes, for this type
+
+    using intrinsic_type = avx512_simd_int; ///< The vector type
+};
+
+/*!
+ * \copydoc avx512_intrinsic_traits
+ */
+template <>
+struct avx512_intrinsic_traits<int64_t> {
+    static constexpr bool vectorizable     = true; ///< Boolean flag indicating is vectorizable or not
+    static constexpr size_t size      = 8;   ///< Numbers of elements in a vector
+    static constexpr size_t alignment = 64;  ///< Necessary alignment, in bytes, for this type
+
+    using intrinsic_type = avx512_simd_long; ///< The vector type
 };
 
 /*!
@@ -194,424 +281,1127 @@ struct avx512_vec {
 
 #endif
 
+    /*!
+     * \brief Extract the lower 256 bits of the given vector
+     */
+    ETL_STATIC_INLINE(__m256) lower(__m512 x) {
+        return _mm512_castps512_ps256(x);
+    }
+
+    /*!
+     * \brief Extract the upper 256 bits of the given vector
+     */
+    ETL_STATIC_INLINE(__m256) upper(__m512 x) {
+        return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1));
+    }
+
+    /*!
+     * \brief Extract the lower 256 bits of the given vector
+     */
+    ETL_STATIC_INLINE(__m256d) lower(__m512d x) {
+        return _mm512_castpd512_pd256(x);
+    }
+
+    /*!
+     * \brief Extract the upper 256 bits of the given vector
+     */
+    ETL_STATIC_INLINE(__m256d) upper(__m512d x) {
+        return _mm512_extractf64x4_pd(x, 1);
+    }
+
     /*!
      * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID storeu(float* memory, __m512 value) {
-        _mm512_storeu_ps(memory, value);
+    ETL_STATIC_INLINE(void) storeu(int8_t* memory, avx512_simd_byte value) {
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(memory), value.value);
     }
 
     /*!
      * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID storeu(double* memory, __m512d value) {
-        _mm512_storeu_pd(memory, value);
+    ETL_STATIC_INLINE(void) storeu(int16_t* memory, avx512_simd_short value) {
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(memory), value.value);
     }
 
     /*!
      * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID storeu(std::complex<float>* memory, __m512 value) {
-        _mm512_storeu_ps(reinterpret_cast<float*>(memory), value);
+    ETL_STATIC_INLINE(void) storeu(int32_t* memory, avx512_simd_int value) {
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(memory), value.value);
     }
 
     /*!
      * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID storeu(std::complex<double>* memory, __m512d value) {
-        _mm512_storeu_pd(reinterpret_cast<double*>(memory), value);
+    ETL_STATIC_INLINE(void) storeu(int64_t* memory, avx512_simd_long value) {
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(memory), value.value);
     }
 
     /*!
      * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID storeu(etl::complex<float>* memory, __m512 value) {
-        _mm512_storeu_ps(reinterpret_cast<float*>(memory), value);
+    ETL_STATIC_INLINE(void) storeu(float* memory, avx512_simd_float value) {
+        _mm512_storeu_ps(memory, value.value);
     }
 
     /*!
      * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID storeu(etl::complex<double>* memory, __m512d value) {
-        _mm512_storeu_pd(reinterpret_cast<double*>(memory), value);
+    ETL_STATIC_INLINE(void) storeu(double* memory, avx512_simd_double value) {
+        _mm512_storeu_pd(memory, value.value);
     }
 
     /*!
-     * \brief Aligned store of the given packed vector at the
+     * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID store(float* memory, __m512 value) {
-        _mm512_store_ps(memory, value);
+    ETL_STATIC_INLINE(void) storeu(std::complex<float>* memory, avx512_simd_complex_float<std::complex<float>> value) {
+        _mm512_storeu_ps(reinterpret_cast<float*>(memory), value.value);
     }
 
     /*!
-     * \brief Aligned store of the given packed vector at the
+     * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID store(double* memory, __m512d value) {
-        _mm512_store_pd(memory, value);
+    ETL_STATIC_INLINE(void) storeu(std::complex<double>* memory, avx512_simd_complex_double<std::complex<double>> value) {
+        _mm512_storeu_pd(reinterpret_cast<double*>(memory), value.value);
     }
 
     /*!
-     * \brief Aligned store of the given packed vector at the
+     * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID store(std::complex<float>* memory, __m512 value) {
-        _mm512_store_ps(reinterpret_cast<float*>(memory), value);
+    ETL_STATIC_INLINE(void) storeu(etl::complex<float>* memory, avx512_simd_complex_float<etl::complex<float>> value) {
+        _mm512_storeu_ps(reinterpret_cast<float*>(memory), value.value);
     }
 
     /*!
-     * \brief Aligned store of the given packed vector at the
+     * \brief Unaligned store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID store(std::complex<double>* memory, __m512d value) {
-        _mm512_store_pd(reinterpret_cast<double*>(memory), value);
+    ETL_STATIC_INLINE(void) storeu(etl::complex<double>* memory, avx512_simd_complex_double<etl::complex<double>> value) {
+        _mm512_storeu_pd(reinterpret_cast<double*>(memory), value.value);
     }
 
     /*!
-     * \brief Aligned store of the given packed vector at the
+     * \brief Non-temporal, aligned, store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID store(etl::complex<float>* memory, __m512 value) {
-        _mm512_store_ps(reinterpret_cast<float*>(memory), value);
+    ETL_STATIC_INLINE(void) stream(int8_t* memory, avx512_simd_byte value) {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(memory), value.value);
     }
 
     /*!
-     * \brief Aligned store of the given packed vector at the
+     * \brief Non-temporal, aligned, store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) stream(int16_t* memory, avx512_simd_short value) {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Non-temporal, aligned, store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) stream(int32_t* memory, avx512_simd_int value) {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Non-temporal, aligned, store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID store(etl::complex<double>* memory, __m512d value) {
-        _mm512_store_pd(reinterpret_cast<double*>(memory), value);
+    ETL_STATIC_INLINE(void) stream(int64_t* memory, avx512_simd_long value) {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(memory), value.value);
     }
 
     /*!
      * \brief Non-temporal, aligned, store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID stream(float* memory, __m512 value) {
-        _mm512_stream_ps(memory, value);
+    ETL_STATIC_INLINE(void) stream(float* memory, avx512_simd_float value) {
+        _mm512_stream_ps(memory, value.value);
     }
 
     /*!
      * \brief Non-temporal, aligned, store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID stream(double* memory, __m512d value) {
-        _mm512_stream_pd(memory, value);
+    ETL_STATIC_INLINE(void) stream(double* memory, avx512_simd_double value) {
+        _mm512_stream_pd(memory, value.value);
     }
 
     /*!
      * \brief Non-temporal, aligned, store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID stream(std::complex<float>* memory, __m512 value) {
-        _mm512_stream_ps(reinterpret_cast<float*>(memory), value);
+    ETL_STATIC_INLINE(void) stream(std::complex<float>* memory, avx512_simd_complex_float<std::complex<float>> value) {
+        _mm512_stream_ps(reinterpret_cast<float*>(memory), value.value);
     }
 
     /*!
      * \brief Non-temporal, aligned, store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID stream(std::complex<double>* memory, __m512d value) {
-        _mm512_stream_pd(reinterpret_cast<double*>(memory), value);
+    ETL_STATIC_INLINE(void) stream(std::complex<double>* memory, avx512_simd_complex_double<std::complex<double>> value) {
+        _mm512_stream_pd(reinterpret_cast<double*>(memory), value.value);
     }
 
     /*!
      * \brief Non-temporal, aligned, store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID stream(etl::complex<float>* memory, __m512 value) {
-        _mm512_stream_ps(reinterpret_cast<float*>(memory), value);
+    ETL_STATIC_INLINE(void) stream(etl::complex<float>* memory, avx512_simd_complex_float<etl::complex<float>> value) {
+        _mm512_stream_ps(reinterpret_cast<float*>(memory), value.value);
     }
 
     /*!
      * \brief Non-temporal, aligned, store of the given packed vector at the
      * given memory position
      */
-    ETL_INLINE_VEC_VOID stream(etl::complex<double>* memory, __m512d value) {
-        _mm512_stream_pd(reinterpret_cast<double*>(memory), value);
+    ETL_STATIC_INLINE(void) stream(etl::complex<double>* memory, avx512_simd_complex_double<etl::complex<double>> value) {
+        _mm512_stream_pd(reinterpret_cast<double*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(int8_t* memory, avx512_simd_byte value) {
+        _mm512_store_si512(reinterpret_cast<__m512i*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(int16_t* memory, avx512_simd_short value) {
+        _mm512_store_si512(reinterpret_cast<__m512i*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(int32_t* memory, avx512_simd_int value) {
+        _mm512_store_si512(reinterpret_cast<__m512i*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(int64_t* memory, avx512_simd_long value) {
+        _mm512_store_si512(reinterpret_cast<__m512i*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(float* memory, avx512_simd_float value) {
+        _mm512_store_ps(memory, value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(double* memory, avx512_simd_double value) {
+        _mm512_store_pd(memory, value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(std::complex<float>* memory, avx512_simd_complex_float<std::complex<float>> value) {
+        _mm512_store_ps(reinterpret_cast<float*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(std::complex<double>* memory, avx512_simd_complex_double<std::complex<double>> value) {
+        _mm512_store_pd(reinterpret_cast<double*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(etl::complex<float>* memory, avx512_simd_complex_float<etl::complex<float>> value) {
+        _mm512_store_ps(reinterpret_cast<float*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Aligned store of the given packed vector at the
+     * given memory position
+     */
+    ETL_STATIC_INLINE(void) store(etl::complex<double>* memory, avx512_simd_complex_double<etl::complex<double>> value) {
+        _mm512_store_pd(reinterpret_cast<double*>(memory), value.value);
+    }
+
+    /*!
+     * \brief Return a packed vector of zeroes of the given type
+     */
+    template<typename T>
+    ETL_TMP_INLINE(typename avx512_intrinsic_traits<T>::intrinsic_type) zero();
+
+    /*!
+     * \brief Load a packed vector from the given aligned memory location
+     */
+    ETL_STATIC_INLINE(avx512_simd_byte) load(const int8_t* memory) {
+        return _mm512_load_si512(reinterpret_cast<const __m512i*>(memory));
+    }
+
+    /*!
+     * \brief Load a packed vector from the given aligned memory location
+     */
+    ETL_STATIC_INLINE(avx512_simd_short) load(const int16_t* memory) {
+        return _mm512_load_si512(reinterpret_cast<const __m512i*>(memory));
+    }
+
+    /*!
+     * \brief Load a packed vector from the given aligned memory location
+     */
+    ETL_STATIC_INLINE(avx512_simd_int) load(const int32_t* memory) {
+        return _mm512_load_si512(reinterpret_cast<const __m512i*>(memory));
+    }
+
+    /*!
+     * \brief Load a packed vector from the given aligned memory location
+     */
+    ETL_STATIC_INLINE(avx512_simd_long) load(const int64_t* memory) {
+        return _mm512_load_si512(reinterpret_cast<const __m512i*>(memory));
     }
 
     /*!
      * \brief Load a packed vector from the given aligned memory location
      */
-    ETL_INLINE_VEC_512 load(const float* memory) {
+    ETL_STATIC_INLINE(avx512_simd_float) load(const float* memory) {
         return _mm512_load_ps(memory);
     }
 
     /*!
      * \brief Load a packed vector from the given aligned memory location
      */
-    ETL_INLINE_VEC_512D load(const double* memory) {
+    ETL_STATIC_INLINE(avx512_simd_double) load(const double* memory) {
         return _mm512_load_pd(memory);
     }
 
     /*!
      * \brief Load a packed vector from the given aligned memory location
      */
-    ETL_INLINE_VEC_512 load(const std::complex<float>* memory) {
+    ETL_STATIC_INLINE(avx512_simd_complex_float<std::complex<float>>) load(const std::complex<float>* memory) {
         return _mm512_load_ps(reinterpret_cast<const float*>(memory));
     }
 
     /*!
      * \brief Load a packed vector from the given aligned memory location
      */
-    ETL_INLINE_VEC_512D load(const std::complex<double>* memory) {
+    ETL_STATIC_INLINE(avx512_simd_complex_double<std::complex<double>>) load(const std::complex<double>* memory) {
         return _mm512_load_pd(reinterpret_cast<const double*>(memory));
     }
 
     /*!
      * \brief Load a packed vector from the given aligned memory location
      */
-    ETL_INLINE_VEC_512 load(const etl::complex<float>* memory) {
+    ETL_STATIC_INLINE(avx512_simd_complex_float<etl::complex<float>>) load(const etl::complex<float>* memory) {
         return _mm512_load_ps(reinterpret_cast<const float*>(memory));
     }
 
     /*!
      * \brief Load a packed vector from the given aligned memory location
      */
-    ETL_INLINE_VEC_512D load(const etl::complex<double>* memory) {
+    ETL_STATIC_INLINE(avx512_simd_complex_double<etl::complex<double>>) load(const etl::complex<double>* memory) {
         return _mm512_load_pd(reinterpret_cast<const double*>(memory));
     }
 
     /*!
      * \brief Load a packed vector from the given unaligned memory location
      */
-    ETL_INLINE_VEC_512 loadu(const float* memory) {
+    ETL_STATIC_INLINE(avx512_simd_byte) loadu(const int8_t* memory) {
+        return _mm512_loadu_si512(reinterpret_cast<const __m512i*>(memory));
+    }
+
+    /*!
+     * \brief Load a packed vector from the given unaligned memory location
+     */
+    ETL_STATIC_INLINE(avx512_simd_short) loadu(const int16_t* memory) {
+        return _mm512_loadu_si512(reinterpret_cast<const __m512i*>(memory));
+    }
+
+    /*!
+     * \brief Load a packed vector from the given unaligned memory location
+     */
+    ETL_STATIC_INLINE(avx512_simd_int) loadu(const int32_t* memory) {
+        return _mm512_loadu_si512(reinterpret_cast<const __m512i*>(memory));
+    }
+
+    /*!
+     * \brief Load a packed vector from the given unaligned memory location
+     */
+    ETL_STATIC_INLINE(avx512_simd_long) loadu(const int64_t* memory) {
+        return _mm512_loadu_si512(reinterpret_cast<const __m512i*>(memory));
+    }
+
+    /*!
+     * \brief Load a packed vector from the given unaligned memory location
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) loadu(const float* memory) {
         return _mm512_loadu_ps(memory);
     }
 
     /*!
      * \brief Load a packed vector from the given unaligned memory location
      */
-    ETL_INLINE_VEC_512D loadu(const double* memory) {
+    ETL_STATIC_INLINE(avx512_simd_double) loadu(const double* memory) {
         return _mm512_loadu_pd(memory);
     }
 
     /*!
      * \brief Load a packed vector from the given unaligned memory location
      */
-    ETL_INLINE_VEC_512 loadu(const std::complex<float>* memory) {
+    ETL_STATIC_INLINE(avx512_simd_complex_float<std::complex<float>>) loadu(const std::complex<float>* memory) {
         return _mm512_loadu_ps(reinterpret_cast<const float*>(memory));
     }
 
     /*!
      * \brief Load a packed vector from the given unaligned memory location
      */
-    ETL_INLINE_VEC_512D loadu(const std::complex<double>* memory) {
+    ETL_STATIC_INLINE(avx512_simd_complex_double<std::complex<double>>) loadu(const std::complex<double>* memory) {
         return _mm512_loadu_pd(reinterpret_cast<const double*>(memory));
     }
 
     /*!
      * \brief Load a packed vector from the given unaligned memory location
      */
-    ETL_INLINE_VEC_512 loadu(const etl::complex<float>* memory) {
+    ETL_STATIC_INLINE(avx512_simd_complex_float<etl::complex<float>>) loadu(const etl::complex<float>* memory) {
         return _mm512_loadu_ps(reinterpret_cast<const float*>(memory));
     }
 
     /*!
      * \brief Load a packed vector from the given unaligned memory location
      */
-    ETL_INLINE_VEC_512D loadu(const etl::complex<double>* memory) {
+    ETL_STATIC_INLINE(avx512_simd_complex_double<etl::complex<double>>) loadu(const etl::complex<double>* memory) {
         return _mm512_loadu_pd(reinterpret_cast<const double*>(memory));
     }
 
     /*!
      * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512D set(double value) {
-        return _mm512_set1_pd(value);
+    ETL_STATIC_INLINE(avx512_simd_byte) set(int8_t value) {
+        return _mm512_set1_epi8(value);
     }
 
     /*!
      * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512 set(float value) {
-        return _mm512_set1_ps(value);
+    ETL_STATIC_INLINE(avx512_simd_short) set(int16_t value) {
+        return _mm512_set1_epi16(value);
     }
 
     /*!
-     * \brief Add the two given values and return the result.
+     * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512D add(__m512d lhs, __m512d rhs) {
-        return _mm512_add_pd(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_int) set(int32_t value) {
+        return _mm512_set1_epi32(value);
     }
 
     /*!
-     * \brief Subtract the two given values and return the result.
+     * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512D sub(__m512d lhs, __m512d rhs) {
-        return _mm512_sub_pd(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_long) set(int64_t value) {
+        return _mm512_set1_epi64(value);
     }
 
     /*!
-     * \brief Compute the square root of each element in the given vector
-     * \return a vector containing the square root of each input element
+     * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512D sqrt(__m512d x) {
-        return _mm512_sqrt_pd(x);
+    ETL_STATIC_INLINE(avx512_simd_double) set(double value) {
+        return _mm512_set1_pd(value);
     }
 
     /*!
-     * \brief Compute the negative of each element in the given vector
-     * \return a vector containing the negative of each input element
+     * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512D minus(__m512d x) {
-        return _mm512_xor_pd(x, _mm512_set1_pd(-0.f));
+    ETL_STATIC_INLINE(avx512_simd_float) set(float value) {
+        return _mm512_set1_ps(value);
     }
 
     /*!
-     * \brief Add the two given values and return the result.
+     * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512 add(__m512 lhs, __m512 rhs) {
-        return _mm512_add_ps(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_complex_float<std::complex<float>>) set(std::complex<float> value) {
+        std::complex<float> tmp[]{value, value, value, value, value, value, value, value};
+        return loadu(tmp);
     }
 
     /*!
-     * \brief Subtract the two given values and return the result.
+     * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512 sub(__m512 lhs, __m512 rhs) {
-        return _mm512_sub_ps(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_complex_double<std::complex<double>>) set(std::complex<double> value) {
+        std::complex<double> tmp[]{value, value, value, value};
+        return loadu(tmp);
     }
 
     /*!
-     * \brief Compute the square root of each element in the given vector
-     * \return a vector containing the square root of each input element
+     * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512 sqrt(__m512 lhs) {
-        return _mm512_sqrt_ps(lhs);
+    ETL_STATIC_INLINE(avx512_simd_complex_float<etl::complex<float>>) set(etl::complex<float> value) {
+        etl::complex<float> tmp[]{value, value, value, value, value, value, value, value};
+        return loadu(tmp);
     }
 
     /*!
-     * \brief Compute the negative of each element in the given vector
-     * \return a vector containing the negative of each input element
+     * \brief Fill a packed vector  by replicating a value
      */
-    ETL_INLINE_VEC_512 minus(__m512 x) {
-        return _mm512_xor_ps(x, _mm512_set1_ps(-0.f));
+    ETL_STATIC_INLINE(avx512_simd_complex_double<etl::complex<double>>) set(etl::complex<double> value) {
+        etl::complex<double> tmp[]{value, value, value, value};
+        return loadu(tmp);
     }
 
     /*!
-     * \brief Multiply the two given vectors
+     * \brief Round up each values of the vector and return them
      */
-    template <bool Complex = false>
-    ETL_INLINE_VEC_512 mul(__m512 lhs, __m512 rhs) {
-        return _mm512_mul_ps(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_float) round_up(avx512_simd_float x) {
+        return _mm512_roundscale_ps(x.value, (_MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
     }
 
     /*!
-     * \brief Multiply the two given vectors
+     * \brief Round up each values of the vector and return them
      */
-    template <>
-    ETL_INLINE_VEC_512 mul<true>(__m512 lhs, __m512 rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
+    ETL_STATIC_INLINE(avx512_simd_double) round_up(avx512_simd_double x) {
+        return _mm512_roundscale_pd(x.value, (_MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
     }
 
+    // Addition
+
+#ifdef __AVX512BW__
     /*!
-     * \brief Multiply the two given complex vectors
+     * \brief Add the two given values and return the result.
      */
-    template <bool Complex = false>
-    ETL_INLINE_VEC_512D mul(__m512d lhs, __m512d rhs) {
-        return _mm512_mul_pd(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_byte) add(avx512_simd_byte lhs, avx512_simd_byte rhs) {
+        return _mm512_add_epi8(lhs.value, rhs.value);
     }
 
     /*!
-     * \brief Multiply the two given complex vectors
+     * \brief Add the two given values and return the result.
      */
-    template <>
-    ETL_INLINE_VEC_512D mul<true>(__m512d lhs, __m512d rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
+    ETL_STATIC_INLINE(avx512_simd_short) add(avx512_simd_short lhs, avx512_simd_short rhs) {
+        return _mm512_add_epi16(lhs.value, rhs.value);
     }
+#endif
 
     /*!
-     * \brief Divide the two given vectors
+     * \brief Add the two given values and return the result.
      */
-    template <bool Complex = false>
-    ETL_INLINE_VEC_512 div(__m512 lhs, __m512 rhs) {
-        return _mm512_div_ps(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_int) add(avx512_simd_int lhs, avx512_simd_int rhs) {
+        return _mm512_add_epi32(lhs.value, rhs.value);
     }
 
     /*!
-     * \brief Divide the two given vectors
+     * \brief Add the two given values and return the result.
      */
-    template <>
-    ETL_INLINE_VEC_512 div<true>(__m512 lhs, __m512 rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
+    ETL_STATIC_INLINE(avx512_simd_long) add(avx512_simd_long lhs, avx512_simd_long rhs) {
+        return _mm512_add_epi64(lhs.value, rhs.value);
     }
 
     /*!
-     * \brief Divide the two given vectors
+     * \brief Add the two given values and return the result.
      */
-    template <bool Complex = false>
-    ETL_INLINE_VEC_512D div(__m512d lhs, __m512d rhs) {
-        return _mm512_div_pd(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_float) add(avx512_simd_float lhs, avx512_simd_float rhs) {
+        return _mm512_add_ps(lhs.value, rhs.value);
     }
 
     /*!
-     * \brief Divide the two given vectors
+     * \brief Add the two given values and return the result.
      */
-    template <>
-    ETL_INLINE_VEC_512D div<true>(__m512d lhs, __m512d rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
+    ETL_STATIC_INLINE(avx512_simd_double) add(avx512_simd_double lhs, avx512_simd_double rhs) {
+        return _mm512_add_pd(lhs.value, rhs.value);
     }
 
-#ifdef __INTEL_COMPILER
-
-    //Exponential
-
     /*!
-     * \brief Compute the exponentials of each element of the given vector
+     * \brief Add the two given values and return the result.
      */
-    ETL_INLINE_VEC_512D exp(__m512d x) {
-        return _mm512_exp_pd(x);
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_float<T>) add(avx512_simd_complex_float<T> lhs, avx512_simd_complex_float<T> rhs) {
+        return _mm512_add_ps(lhs.value, rhs.value);
     }
 
     /*!
-     * \brief Compute the exponentials of each element of the given vector
+     * \brief Add the two given values and return the result.
      */
-    ETL_INLINE_VEC_512 exp(__m512 x) {
-        return _mm512_exp_ps(x);
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_double<T>) add(avx512_simd_complex_double<T> lhs, avx512_simd_complex_double<T> rhs) {
+        return _mm512_add_pd(lhs.value, rhs.value);
     }
 
-    //Logarithm
+    // Subtraction
 
+#ifdef __AVX512BW__
     /*!
-     * \brief Compute the logarithm of each element of the given vector
+     * \brief Subtract the two given values and return the result.
      */
-    ETL_INLINE_VEC_512D log(__m512d x) {
-        return _mm512_log_pd(x);
+    ETL_STATIC_INLINE(avx512_simd_byte) sub(avx512_simd_byte lhs, avx512_simd_byte rhs) {
+        return _mm512_sub_epi8(lhs.value, rhs.value);
     }
 
     /*!
-     * \brief Compute the logarithm of each element of the given vector
+     * \brief Subtract the two given values and return the result.
      */
-    ETL_INLINE_VEC_512 log(__m512 x) {
-        return _mm512_log_ps(x);
+    ETL_STATIC_INLINE(avx512_simd_short) sub(avx512_simd_short lhs, avx512_simd_short rhs) {
+        return _mm512_sub_epi16(lhs.value, rhs.value);
     }
+#endif
 
-    //Min
+    /*!
+     * \brief Subtract the two given values and return the result.
+     */
+    ETL_STATIC_INLINE(avx512_simd_int) sub(avx512_simd_int lhs, avx512_simd_int rhs) {
+        return _mm512_sub_epi32(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Subtract the two given values and return the result.
+     */
+    ETL_STATIC_INLINE(avx512_simd_long) sub(avx512_simd_long lhs, avx512_simd_long rhs) {
+        return _mm512_sub_epi64(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Subtract the two given values and return the result.
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) sub(avx512_simd_float lhs, avx512_simd_float rhs) {
+        return _mm512_sub_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Subtract the two given values and return the result.
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) sub(avx512_simd_double lhs, avx512_simd_double rhs) {
+        return _mm512_sub_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Subtract the two given values and return the result.
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_float<T>) sub(avx512_simd_complex_float<T> lhs, avx512_simd_complex_float<T> rhs) {
+        return _mm512_sub_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Subtract the two given values and return the result.
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_double<T>) sub(avx512_simd_complex_double<T> lhs, avx512_simd_complex_double<T> rhs) {
+        return _mm512_sub_pd(lhs.value, rhs.value);
+    }
+
+    // Square root
+
+    /*!
+     * \brief Compute the square root of each element in the given vector
+     * \return a vector containing the square root of each input element
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) sqrt(avx512_simd_float x) {
+        return _mm512_sqrt_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the square root of each element in the given vector
+     * \return a vector containing the square root of each input element
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) sqrt(avx512_simd_double x) {
+        return _mm512_sqrt_pd(x.value);
+    }
+
+    // Negation
+
+    /*!
+     * \brief Compute the negative of each element in the given vector
+     * \return a vector containing the negative of each input element
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) minus(avx512_simd_float x) {
+        // _mm512_xor_ps needs AVX512DQ, the integer version is in AVX512F
+        return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(x.value), _mm512_set1_epi32(0x80000000)));
+    }
+
+    /*!
+     * \brief Compute the negative of each element in the given vector
+     * \return a vector containing the negative of each input element
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) minus(avx512_simd_double x) {
+        // _mm512_xor_pd needs AVX512DQ, the integer version is in AVX512F
+        return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x.value), _mm512_set1_epi64(0x8000000000000000LL)));
+    }
+
+    // Multiplication
+
+#ifdef __AVX512BW__
+    /*!
+     * \brief Multiply the two given vectors of byte
+     */
+    ETL_STATIC_INLINE(avx512_simd_byte) mul(avx512_simd_byte lhs, avx512_simd_byte rhs) {
+        auto aodd    = _mm512_srli_epi16(lhs.value, 8);
+        auto bodd    = _mm512_srli_epi16(rhs.value, 8);
+        auto muleven = _mm512_mullo_epi16(lhs.value, rhs.value);
+        auto mulodd  = _mm512_slli_epi16(_mm512_mullo_epi16(aodd, bodd), 8);
+        return _mm512_mask_blend_epi8(0x5555555555555555ULL, mulodd, muleven);
+    }
+
+    /*!
+     * \brief Multiply the two given vectors of short
+     */
+    ETL_STATIC_INLINE(avx512_simd_short) mul(avx512_simd_short lhs, avx512_simd_short rhs) {
+        return _mm512_mullo_epi16(lhs.value, rhs.value);
+    }
+#endif
+
+    /*!
+     * \brief Multiply the two given vectors of int
+     */
+    ETL_STATIC_INLINE(avx512_simd_int) mul(avx512_simd_int lhs, avx512_simd_int rhs) {
+        return _mm512_mullo_epi32(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Multiply the two given vectors of long
+     */
+    ETL_STATIC_INLINE(avx512_simd_long) mul(avx512_simd_long lhs, avx512_simd_long rhs) {
+#ifdef __AVX512DQ__
+        return _mm512_mullo_epi64(lhs.value, rhs.value);
+#else
+        return _mm512_mullox_epi64(lhs.value, rhs.value);
+#endif
+    }
+
+    /*!
+     * \brief Multiply the two given vectors
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) mul(avx512_simd_float lhs, avx512_simd_float rhs) {
+        return _mm512_mul_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Multiply the two given vectors
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) mul(avx512_simd_double lhs, avx512_simd_double rhs) {
+        return _mm512_mul_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \copydoc avx512_vec::mul
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_float<T>) mul(avx512_simd_complex_float<T> lhs, avx512_simd_complex_float<T> rhs) {
+        //lhs = [x1.real, x1.img, x2.real, x2.img, ...]
+        //rhs = [y1.real, y1.img, y2.real, y2.img, ...]
+
+        //zmm1 = [y1.real, y1.real, y2.real, y2.real, ...]
+        __m512 zmm1 = _mm512_moveldup_ps(rhs.value);
+
+        //zmm2 = [x1.img, x1.real, x2.img, x2.real, ...]
+        __m512 zmm2 = _mm512_permute_ps(lhs.value, 0b10110001);
+
+        //zmm3 = [y1.imag, y1.imag, y2.imag, y2.imag, ...]
+        __m512 zmm3 = _mm512_movehdup_ps(rhs.value);
+
+        //zmm4 = zmm2 * zmm3
+        __m512 zmm4 = _mm512_mul_ps(zmm2, zmm3);
+
+        //result = [(lhs * zmm1) -+ zmm4];
+        return _mm512_fmaddsub_ps(lhs.value, zmm1, zmm4);
+    }
+
+    /*!
+     * \copydoc avx512_vec::mul
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_double<T>) mul(avx512_simd_complex_double<T> lhs, avx512_simd_complex_double<T> rhs) {
+        //lhs = [x1.real, x1.img, x2.real, x2.img, ...]
+        //rhs = [y1.real, y1.img, y2.real, y2.img, ...]
+
+        //zmm1 = [y1.real, y1.real, y2.real, y2.real, ...]
+        __m512d zmm1 = _mm512_movedup_pd(rhs.value);
+
+        //zmm2 = [x1.img, x1.real, x2.img, x2.real, ...]
+        __m512d zmm2 = _mm512_permute_pd(lhs.value, 0b01010101);
+
+        //zmm3 = [y1.imag, y1.imag, y2.imag, y2.imag, ...]
+        __m512d zmm3 = _mm512_permute_pd(rhs.value, 0b11111111);
+
+        //zmm4 = zmm2 * zmm3
+        __m512d zmm4 = _mm512_mul_pd(zmm2, zmm3);
+
+        //result = [(lhs * zmm1) -+ zmm4];
+        return _mm512_fmaddsub_pd(lhs.value, zmm1, zmm4);
+    }
+
+    // Fused Multiply Add (FMA)
+
+#ifdef __AVX512BW__
+    /*!
+     * \brief Fused-Multiply Add of the three given vector of bytes
+     */
+    ETL_STATIC_INLINE(avx512_simd_byte) fmadd(avx512_simd_byte a, avx512_simd_byte b, avx512_simd_byte c){
+        return add(mul(a, b), c);
+    }
+
+    /*!
+     * \brief Fused-Multiply Add of the three given vector of short
+     */
+    ETL_STATIC_INLINE(avx512_simd_short) fmadd(avx512_simd_short a, avx512_simd_short b, avx512_simd_short c){
+        return add(mul(a, b), c);
+    }
+#endif
+
+    /*!
+     * \brief Fused-Multiply Add of the three given vector of int
+     */
+    ETL_STATIC_INLINE(avx512_simd_int) fmadd(avx512_simd_int a, avx512_simd_int b, avx512_simd_int c){
+        return add(mul(a, b), c);
+    }
+
+    /*!
+     * \brief Fused-Multiply Add of the three given vector of longs
+     */
+    ETL_STATIC_INLINE(avx512_simd_long) fmadd(avx512_simd_long a, avx512_simd_long b, avx512_simd_long c){
+        return add(mul(a, b), c);
+    }
+
+    /*!
+     * \copydoc avx512_vec::fmadd
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) fmadd(avx512_simd_float a, avx512_simd_float b, avx512_simd_float c) {
+        return _mm512_fmadd_ps(a.value, b.value, c.value);
+    }
+
+    /*!
+     * \copydoc avx512_vec::fmadd
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) fmadd(avx512_simd_double a, avx512_simd_double b, avx512_simd_double c) {
+        return _mm512_fmadd_pd(a.value, b.value, c.value);
+    }
+
+    /*!
+     * \copydoc avx512_vec::fmadd
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_float<T>) fmadd(avx512_simd_complex_float<T> a, avx512_simd_complex_float<T> b, avx512_simd_complex_float<T> c) {
+        return add(mul(a, b), c);
+    }
+
+    /*!
+     * \copydoc avx512_vec::fmadd
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_double<T>) fmadd(avx512_simd_complex_double<T> a, avx512_simd_complex_double<T> b, avx512_simd_complex_double<T> c) {
+        return add(mul(a, b), c);
+    }
+
+    // Division
+
+    /*!
+     * \brief Divide the two given vectors
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) div(avx512_simd_float lhs, avx512_simd_float rhs) {
+        return _mm512_div_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Divide the two given vectors
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) div(avx512_simd_double lhs, avx512_simd_double rhs) {
+        return _mm512_div_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \copydoc avx512_vec::div
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_float<T>) div(avx512_simd_complex_float<T> lhs, avx512_simd_complex_float<T> rhs) {
+        //lhs = [x1.real, x1.img, x2.real, x2.img ...]
+        //rhs = [y1.real, y1.img, y2.real, y2.img ...]
+
+        //zmm0 = [y1.real, y1.real, y2.real, y2.real, ...]
+        __m512 zmm0 = _mm512_moveldup_ps(rhs.value);
+
+        //zmm1 = [y1.imag, y1.imag, y2.imag, y2.imag, ...]
+        __m512 zmm1 = _mm512_movehdup_ps(rhs.value);
+
+        //zmm2 = [x1.img, x1.real, x2.img, x2.real, ...]
+        __m512 zmm2 = _mm512_permute_ps(lhs.value, 0b10110001);
+
+        //zmm4 = [x.img * y.img, x.real * y.img]
+        __m512 zmm4 = _mm512_mul_ps(zmm2, zmm1);
+
+        //zmm5 = subadd((lhs * zmm0), zmm4)
+        __m512 zmm5 = _mm512_fmsubadd_ps(lhs.value, zmm0, zmm4);
+
+        //zmm3 = [y.imag^2, y.imag^2]
+        __m512 zmm3 = _mm512_mul_ps(zmm1, zmm1);
+
+        //zmm0 = (zmm0 * zmm0 + zmm3)
+        zmm0 = _mm512_fmadd_ps(zmm0, zmm0, zmm3);
+
+        //result = zmm5 / zmm0
+        return _mm512_div_ps(zmm5, zmm0);
+    }
+
+    /*!
+     * \copydoc avx512_vec::div
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(avx512_simd_complex_double<T>) div(avx512_simd_complex_double<T> lhs, avx512_simd_complex_double<T> rhs) {
+        //lhs = [x1.real, x1.img, x2.real, x2.img, ...]
+        //rhs = [y1.real, y1.img, y2.real, y2.img, ...]
+
+        //zmm0 = [y1.real, y1.real, y2.real, y2.real, ...]
+        __m512d zmm0 = _mm512_movedup_pd(rhs.value);
+
+        //zmm1 = [y1.imag, y1.imag, y2.imag, y2.imag, ...]
+        __m512d zmm1 = _mm512_permute_pd(rhs.value, 0b11111111);
+
+        //zmm2 = [x1.img, x1.real, x2.img, x2.real, ...]
+        __m512d zmm2 = _mm512_permute_pd(lhs.value, 0b01010101);
+
+        //zmm4 = [x.img * y.img, x.real * y.img]
+        __m512d zmm4 = _mm512_mul_pd(zmm2, zmm1);
+
+        //zmm5 = subadd((lhs * zmm0), zmm4)
+        __m512d zmm5 = _mm512_fmsubadd_pd(lhs.value, zmm0, zmm4);
+
+        //zmm3 = [y.imag^2, y.imag^2]
+        __m512d zmm3 = _mm512_mul_pd(zmm1, zmm1);
+
+        //zmm0 = (zmm0 * zmm0 + zmm3)
+        zmm0 = _mm512_fmadd_pd(zmm0, zmm0, zmm3);
+
+        //result = zmm5 / zmm0
+        return _mm512_div_pd(zmm5, zmm0);
+    }
+
+#ifndef __INTEL_COMPILER
+
+    // GCC and clang do not have SVML, the transcendental functions use
+    // the kernels from avx512_exp.hpp
+
+    // Cosinus
+
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) cos(avx512_simd_float x) {
+        return etl::cos512_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) cos(avx512_simd_double x) {
+        return etl::cos512_pd(x.value);
+    }
+
+    // Sinus
+
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) sin(avx512_simd_float x) {
+        return etl::sin512_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) sin(avx512_simd_double x) {
+        return etl::sin512_pd(x.value);
+    }
+
+    // Hyperbolic functions
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) tanh(avx512_simd_float x) {
+        return etl::tanh512_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) tanh(avx512_simd_double x) {
+        return etl::tanh512_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) sinh(avx512_simd_float x) {
+        return etl::sinh512_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) sinh(avx512_simd_double x) {
+        return etl::sinh512_pd(x.value);
+    }
+
+    //Exponential
+
+    /*!
+     * \brief Compute the exponentials of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) exp(avx512_simd_float x) {
+        return etl::exp512_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the exponentials of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) exp(avx512_simd_double x) {
+        return etl::exp512_pd(x.value);
+    }
+
+    //Logarithm
+
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) log(avx512_simd_float x) {
+        return etl::log512_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) log(avx512_simd_double x) {
+        return etl::log512_pd(x.value);
+    }
+
+#else //__INTEL_COMPILER
+
+    // Cosinus
+
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) cos(avx512_simd_float x) {
+        return _mm512_cos_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) cos(avx512_simd_double x) {
+        return _mm512_cos_pd(x.value);
+    }
+
+    // Sinus
+
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) sin(avx512_simd_float x) {
+        return _mm512_sin_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) sin(avx512_simd_double x) {
+        return _mm512_sin_pd(x.value);
+    }
+
+    // Hyperbolic functions
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) tanh(avx512_simd_float x) {
+        return _mm512_tanh_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) tanh(avx512_simd_double x) {
+        return _mm512_tanh_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) sinh(avx512_simd_float x) {
+        return _mm512_sinh_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) sinh(avx512_simd_double x) {
+        return _mm512_sinh_pd(x.value);
+    }
+
+    //Exponential
+
+    /*!
+     * \brief Compute the exponentials of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) exp(avx512_simd_double x) {
+        return _mm512_exp_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the exponentials of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) exp(avx512_simd_float x) {
+        return _mm512_exp_ps(x.value);
+    }
+
+    //Logarithm
+
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_double) log(avx512_simd_double x) {
+        return _mm512_log_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx512_simd_float) log(avx512_simd_float x) {
+        return _mm512_log_ps(x.value);
+    }
+
+#endif //__INTEL_COMPILER
+
+    //Min
 
     /*!
      * \brief Compute the minimum between each pair element of the given vectors
      */
-    ETL_INLINE_VEC_512D min(__m512d lhs, __m512d rhs) {
-        return _mm512_min_pd(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_double) min(avx512_simd_double lhs, avx512_simd_double rhs) {
+        return _mm512_min_pd(lhs.value, rhs.value);
     }
 
     /*!
      * \brief Compute the minimum between each pair element of the given vectors
      */
-    ETL_INLINE_VEC_512 min(__m512 lhs, __m512 rhs) {
-        return _mm512_min_ps(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_float) min(avx512_simd_float lhs, avx512_simd_float rhs) {
+        return _mm512_min_ps(lhs.value, rhs.value);
     }
 
     //Max
@@ -619,54 +1409,193 @@ struct avx512_vec {
     /*!
      * \brief Compute the maximum between each pair element of the given vectors
      */
-    ETL_INLINE_VEC_512D max(__m512d lhs, __m512d rhs) {
-        return _mm512_max_pd(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_double) max(avx512_simd_double lhs, avx512_simd_double rhs) {
+        return _mm512_max_pd(lhs.value, rhs.value);
     }
 
     /*!
      * \brief Compute the maximum between each pair element of the given vectors
      */
-    ETL_INLINE_VEC_512 max(__m512 lhs, __m512 rhs) {
-        return _mm512_max_ps(lhs, rhs);
+    ETL_STATIC_INLINE(avx512_simd_float) max(avx512_simd_float lhs, avx512_simd_float rhs) {
+        return _mm512_max_ps(lhs.value, rhs.value);
     }
 
-#endif //__INTEL_COMPILER
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    ETL_STATIC_INLINE(float) hadd(avx512_simd_float in) {
+        const __m256 x256 = _mm256_add_ps(lower(in.value), upper(in.value));
+        const __m128 x128 = _mm_add_ps(_mm256_extractf128_ps(x256, 1), _mm256_castps256_ps128(x256));
+        const __m128 x64  = _mm_add_ps(x128, _mm_movehl_ps(x128, x128));
+        const __m128 x32  = _mm_add_ss(x64, _mm_shuffle_ps(x64, x64, 0x55));
+        return _mm_cvtss_f32(x32);
+    }
+
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    ETL_STATIC_INLINE(double) hadd(avx512_simd_double in) {
+        const __m256d x256 = _mm256_add_pd(lower(in.value), upper(in.value));
+        const __m128d x128 = _mm_add_pd(_mm256_extractf128_pd(x256, 1), _mm256_castpd256_pd128(x256));
+        const __m128d x64  = _mm_add_sd(x128, _mm_unpackhi_pd(x128, x128));
+        return _mm_cvtsd_f64(x64);
+    }
+
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    ETL_STATIC_INLINE(int8_t) hadd(avx512_simd_byte in) {
+        int8_t acc = 0;
+
+        for (size_t i = 0; i < 64; ++i) {
+            acc += in[i];
+        }
+
+        return acc;
+    }
+
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    ETL_STATIC_INLINE(int16_t) hadd(avx512_simd_short in) {
+        int16_t acc = 0;
+
+        for (size_t i = 0; i < 32; ++i) {
+            acc += in[i];
+        }
+
+        return acc;
+    }
+
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    ETL_STATIC_INLINE(int32_t) hadd(avx512_simd_int in) {
+        return _mm512_reduce_add_epi32(in.value);
+    }
+
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    ETL_STATIC_INLINE(int64_t) hadd(avx512_simd_long in) {
+        return _mm512_reduce_add_epi64(in.value);
+    }
+
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(T) hadd(avx512_simd_complex_float<T> in) {
+        return in[0] + in[1] + in[2] + in[3] + in[4] + in[5] + in[6] + in[7];
+    }
+
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    template<typename T>
+    ETL_STATIC_INLINE(T) hadd(avx512_simd_complex_double<T> in) {
+        return in[0] + in[1] + in[2] + in[3];
+    }
 };
 
+#ifdef __AVX512BW__
+
 /*!
- * \copydoc sse_vec::mul
+ * \copydoc avx512_vec::zero
  */
-template <>
-ETL_OUT_VEC_512 avx512_vec::mul<true>(__m512 lhs, __m512 rhs) {
-    cpp_unreachable("Not yet implemented");
-    return lhs;
+template<>
+ETL_OUT_INLINE(avx512_simd_byte) avx512_vec::zero<int8_t>() {
+    return _mm512_setzero_si512();
 }
 
 /*!
- * \copydoc sse_vec::mul
+ * \copydoc avx512_vec::zero
  */
-template <>
-ETL_OUT_VEC_512D avx512_vec::mul<true>(__m512d lhs, __m512d rhs) {
-    cpp_unreachable("Not yet implemented");
-    return lhs;
+template<>
+ETL_OUT_INLINE(avx512_simd_short) avx512_vec::zero<int16_t>() {
+    return _mm512_setzero_si512();
 }
 
+#endif
+
 /*!
- * \copydoc sse_vec::div
+ * \copydoc avx512_vec::zero
  */
-template <>
-ETL_OUT_VEC_512 avx512_vec::div<true>(__m512 lhs, __m512 rhs) {
-    cpp_unreachable("Not yet implemented");
-    return lhs;
+template<>
+ETL_OUT_INLINE(avx512_simd_int) avx512_vec::zero<int32_t>() {
+    return _mm512_setzero_si512();
 }
 
 /*!
- * \copydoc sse_vec::div
+ * \copydoc avx512_vec::zero
  */
-template <>
-ETL_OUT_VEC_512D avx512_vec::div<true>(__m512d lhs, __m512d rhs) {
-    cpp_unreachable("Not yet implemented");
-    return lhs;
+template<>
+ETL_OUT_INLINE(avx512_simd_long) avx512_vec::zero<int64_t>() {
+    return _mm512_setzero_si512();
+}
+
+/*!
+ * \copydoc avx512_vec::zero
+ */
+template<>
+ETL_OUT_INLINE(avx512_simd_float) avx512_vec::zero<float>() {
+    return _mm512_setzero_ps();
+}
+
+/*!
+ * \copydoc avx512_vec::zero
+ */
+template<>
+ETL_OUT_INLINE(avx512_simd_double) avx512_vec::zero<double>() {
+    return _mm512_setzero_pd();
+}
+
+/*!
+ * \copydoc avx512_vec::zero
+ */
+template<>
+ETL_OUT_INLINE(avx512_simd_complex_float<etl::complex<float>>) avx512_vec::zero<etl::complex<float>>() {
+    return _mm512_setzero_ps();
+}
+
+/*!
+ * \copydoc avx512_vec::zero
+ */
+template<>
+ETL_OUT_INLINE(avx512_simd_complex_double<etl::complex<double>>) avx512_vec::zero<etl::complex<double>>() {
+    return _mm512_setzero_pd();
+}
+
+/*!
+ * \copydoc avx512_vec::zero
+ */
+template<>
+ETL_OUT_INLINE(avx512_simd_complex_float<std::complex<float>>) avx512_vec::zero<std::complex<float>>() {
+    return _mm512_setzero_ps();
+}
+
+/*!
+ * \copydoc avx512_vec::zero
+ */
+template<>
+ETL_OUT_INLINE(avx512_simd_complex_double<std::complex<double>>) avx512_vec::zero<std::complex<double>>() {
+    return _mm512_setzero_pd();
 }
 
 } //end of namespace etl
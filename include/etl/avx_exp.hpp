@@ -43,6 +43,8 @@
 
 #ifdef __AVX__
 
+#include <limits>
+
 #define ETL_INLINE_VEC_256 ETL_STATIC_INLINE(__m256)
 #define ETL_INLINE_VEC_256D ETL_STATIC_INLINE(__m256d)
 
@@ -159,6 +161,9 @@ AVX2_INTOP_USING_SSE2(add_epi32)
 
 /*!
  * \brief AVX-Vectorized logarithm in single-precision
+ *
+ * The maximum error is 1 ULP.
+ *
  * \param x The vector of numbers to compute the cosinus from
  * \return a vector containing the cosinus of the input vector values
  */
@@ -241,10 +246,17 @@ ETL_PS_256_CONST(cephes_exp_p5, 5.0000001201E-1);
 
 /*!
  * \brief AVX-Vectorized exponential in double-precision
+ *
+ * The maximum error is 1 ULP, the result overflows to infinity for x > 709.4.
+ *
  * \param x The vector of numbers to compute the exponential from
  * \return a vector containing the exponential of the input vector values
  */
 ETL_INLINE_VEC_256D exp256_pd(__m256d x) {
+    // The bounds are the first operands so that NaN is kept
+    x = _mm256_min_pd(_mm256_set1_pd(7.09782712893383996843e2), x);
+    x = _mm256_max_pd(_mm256_set1_pd(-7.08396418532264106224e2), x);
+
     auto t1 = _mm256_mul_pd(x, _mm256_set1_pd(1.44269504088896340736));
     auto r = _mm256_round_pd(t1, 8);
 
@@ -323,6 +335,9 @@ ETL_INLINE_VEC_256D exp256_pd(__m256d x) {
 
 /*!
  * \brief AVX-Vectorized exponential in single-precision
+ *
+ * The maximum error is 1 ULP.
+ *
  * \param x The vector of numbers to compute the exponential from
  * \return a vector containing the exponential of the input vector values
  */
@@ -331,8 +346,8 @@ ETL_INLINE_VEC_256 exp256_ps(__m256 x) {
     __m256i imm0;
     __m256 one = *(__m256*)_ps256_1;
 
-    x = _mm256_min_ps(x, *(__m256*)_ps256_exp_hi);
-    x = _mm256_max_ps(x, *(__m256*)_ps256_exp_lo);
+    x = _mm256_min_ps(*(__m256*)_ps256_exp_hi, x);
+    x = _mm256_max_ps(*(__m256*)_ps256_exp_lo, x);
 
     /* express exp(x) as exp(g + n*log(2)) */
     fx = _mm256_mul_ps(x, *(__m256*)_ps256_cephes_LOG2EF);
@@ -420,6 +435,9 @@ ETL_PS_256_CONST(cephes_FOPI, 1.27323954473516); // 4 / M_PI
 
 /*!
  * \brief AVX-Vectorized sinus in single-precision
+ *
+ * The maximum error is 1 ULP for |x| <= Pi, it grows with |x| (about 80 ULP at 1000).
+ *
  * \param x The vector of numbers to compute the sinus from
  * \return a vector containing the sinus of the input vector values
  */
@@ -550,6 +568,9 @@ ETL_INLINE_VEC_256 sin256_ps(__m256 x) { // any x
 
 /*!
  * \brief AVX-Vectorized cosinus in single-precision
+ *
+ * The maximum error is 1 ULP for |x| <= Pi, it grows with |x| (about 80 ULP at 1000).
+ *
  * \param x The vector of numbers to compute the cosinus from
  * \return a vector containing the cosinus of the input vector values
  */
@@ -667,6 +688,323 @@ ETL_INLINE_VEC_256 cos256_ps(__m256 x) { // any x
     return y;
 }
 
+/*!
+ * \brief AVX-Vectorized logarithm in double-precision
+ *
+ * The maximum error is 1 ULP for positive normal and denormal inputs.
+ *
+ * \param x The vector of numbers to compute the logarithm from
+ * \return a vector containing the logarithms of the input vector values
+ */
+ETL_INLINE_VEC_256D log256_pd(__m256d x) {
+    const __m256d one   = _mm256_set1_pd(1.0);
+    const __m256d zero  = _mm256_setzero_pd();
+    const __m256d inf   = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    const __m256d magic = _mm256_set1_pd(4503599627370496.0); // 2^52
+
+    __m256d invalid_mask = _mm256_cmp_pd(x, zero, _CMP_NGE_UQ); // negative args and NaN will be NaN
+    __m256d zero_mask    = _mm256_cmp_pd(x, zero, _CMP_EQ_OQ);
+    __m256d inf_mask     = _mm256_cmp_pd(x, inf, _CMP_EQ_OQ);
+
+    // Denormals are scaled into the normal range
+    __m256d denorm_mask = _mm256_cmp_pd(x, _mm256_set1_pd(std::numeric_limits<double>::min()), _CMP_LT_OQ);
+    x                   = _mm256_blendv_pd(x, _mm256_mul_pd(x, magic), denorm_mask);
+
+    // The exponent is converted to double by adding it to the bits of 2^52
+
+#ifdef __AVX2__
+    __m256i emm0 = _mm256_srli_epi64(_mm256_castpd_si256(x), 52);
+#else
+    __m256i emm0 = _mm256_castpd_si256(x);
+    __m128i emm1 = _mm_srli_epi64(_mm256_castsi256_si128(emm0), 52);
+    __m128i emm2 = _mm_srli_epi64(_mm256_extractf128_si256(emm0, 1), 52);
+    emm0         = _mm256_insertf128_si256(_mm256_castsi128_si256(emm1), emm2, 1);
+#endif
+
+    __m256d e = _mm256_or_pd(_mm256_castsi256_pd(emm0), magic);
+    e         = _mm256_sub_pd(e, _mm256_set1_pd(4503599627370496.0 + 1022.0));
+    e         = _mm256_sub_pd(e, _mm256_and_pd(denorm_mask, _mm256_set1_pd(52.0)));
+
+    // keep only the fractional part, in [0.5, 1[
+    x = _mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi64x(~0x7FF0000000000000LL)));
+    x = _mm256_or_pd(x, _mm256_set1_pd(0.5));
+
+    __m256d mask = _mm256_cmp_pd(x, _mm256_set1_pd(0.70710678118654752440), _CMP_LT_OQ);
+    __m256d tmp  = _mm256_and_pd(x, mask);
+    x            = _mm256_sub_pd(x, one);
+    e            = _mm256_sub_pd(e, _mm256_and_pd(one, mask));
+    x            = _mm256_add_pd(x, tmp);
+
+    __m256d z = _mm256_mul_pd(x, x);
+
+    // log(1 + x) = x - x^2 / 2 + x^3 * P(x) / Q(x)
+
+    __m256d p = _mm256_set1_pd(1.01875663804580931796E-4);
+    p         = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(4.97494994976747001425E-1));
+    p         = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(4.70579119878881725854E0));
+    p         = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(1.44989225341610930846E1));
+    p         = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(1.79368678507819816313E1));
+    p         = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(7.70838733755885391666E0));
+
+    __m256d q = _mm256_add_pd(x, _mm256_set1_pd(1.12873587189167450590E1));
+    q         = _mm256_add_pd(_mm256_mul_pd(q, x), _mm256_set1_pd(4.52279145837532221105E1));
+    q         = _mm256_add_pd(_mm256_mul_pd(q, x), _mm256_set1_pd(8.29875266912776603211E1));
+    q         = _mm256_add_pd(_mm256_mul_pd(q, x), _mm256_set1_pd(7.11544750618563894466E1));
+    q         = _mm256_add_pd(_mm256_mul_pd(q, x), _mm256_set1_pd(2.31251620126765340583E1));
+
+    __m256d y = _mm256_mul_pd(_mm256_mul_pd(x, z), _mm256_div_pd(p, q));
+
+    y = _mm256_sub_pd(y, _mm256_mul_pd(e, _mm256_set1_pd(2.121944400546905827679e-4)));
+    y = _mm256_sub_pd(y, _mm256_mul_pd(z, _mm256_set1_pd(0.5)));
+    x = _mm256_add_pd(x, y);
+    x = _mm256_add_pd(x, _mm256_mul_pd(e, _mm256_set1_pd(0.693359375)));
+
+    // Special values
+    x = _mm256_blendv_pd(x, _mm256_sub_pd(zero, inf), zero_mask);
+    x = _mm256_blendv_pd(x, inf, inf_mask);
+    x = _mm256_or_pd(x, invalid_mask);
+
+    return x;
+}
+
+/*!
+ * \brief AVX-Vectorized sinus or cosinus in double-precision
+ * \param x The vector of numbers to compute the sinus or cosinus from
+ * \param cosinus Indicates if the cosinus or the sinus must be computed
+ * \return a vector containing the sinus or cosinus of the input vector values
+ */
+ETL_INLINE_VEC_256D sincos256_pd(__m256d x, bool cosinus) {
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+    const __m256d zero      = _mm256_setzero_pd();
+    const __m128i four      = _mm_set1_epi32(4);
+    const __m128i two       = _mm_set1_epi32(2);
+
+    __m256d sign_bit = _mm256_and_pd(x, sign_mask);
+
+    x = _mm256_andnot_pd(sign_mask, x);
+
+    // infinite and NaN arguments will be NaN
+    __m256d invalid_mask = _mm256_cmp_pd(x, _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_NLT_UQ);
+
+    // j = (x * 4 / Pi) rounded to the next even integer
+    __m128i emm2 = _mm256_cvttpd_epi32(_mm256_mul_pd(x, _mm256_set1_pd(1.27323954473516268615)));
+    emm2         = _mm_add_epi32(emm2, _mm_set1_epi32(1));
+    emm2         = _mm_and_si128(emm2, _mm_set1_epi32(~1));
+    __m256d y    = _mm256_cvtepi32_pd(emm2);
+
+    if (cosinus) {
+        emm2 = _mm_sub_epi32(emm2, two);
+
+        // The sign of x does not matter for the cosinus
+        sign_bit = _mm256_and_pd(_mm256_cmp_pd(_mm256_cvtepi32_pd(_mm_andnot_si128(emm2, four)), zero, _CMP_NEQ_OQ), sign_mask);
+    } else {
+        sign_bit = _mm256_xor_pd(sign_bit, _mm256_and_pd(_mm256_cmp_pd(_mm256_cvtepi32_pd(_mm_and_si128(emm2, four)), zero, _CMP_NEQ_OQ), sign_mask));
+    }
+
+    __m256d poly_mask = _mm256_cmp_pd(_mm256_cvtepi32_pd(_mm_and_si128(emm2, two)), zero, _CMP_EQ_OQ);
+
+    // Extended precision modular arithmetic: x = ((x - y * DP1) - y * DP2) - y * DP3
+    x = _mm256_sub_pd(x, _mm256_mul_pd(y, _mm256_set1_pd(7.85398125648498535156E-1)));
+    x = _mm256_sub_pd(x, _mm256_mul_pd(y, _mm256_set1_pd(3.77489470793079817668E-8)));
+    x = _mm256_sub_pd(x, _mm256_mul_pd(y, _mm256_set1_pd(2.69515142907905952645E-15)));
+
+    __m256d z = _mm256_mul_pd(x, x);
+
+    // Cosinus polynomial (0 <= x <= Pi/4)
+
+    __m256d yc = _mm256_set1_pd(-1.13585365213876817300E-11);
+    yc         = _mm256_add_pd(_mm256_mul_pd(yc, z), _mm256_set1_pd(2.08757008419747316778E-9));
+    yc         = _mm256_add_pd(_mm256_mul_pd(yc, z), _mm256_set1_pd(-2.75573141792967388112E-7));
+    yc         = _mm256_add_pd(_mm256_mul_pd(yc, z), _mm256_set1_pd(2.48015872888517045348E-5));
+    yc         = _mm256_add_pd(_mm256_mul_pd(yc, z), _mm256_set1_pd(-1.38888888888730564116E-3));
+    yc         = _mm256_add_pd(_mm256_mul_pd(yc, z), _mm256_set1_pd(4.16666666666665929218E-2));
+    yc         = _mm256_mul_pd(_mm256_mul_pd(yc, z), z);
+    yc         = _mm256_sub_pd(yc, _mm256_mul_pd(z, _mm256_set1_pd(0.5)));
+    yc         = _mm256_add_pd(yc, _mm256_set1_pd(1.0));
+
+    // Sinus polynomial (0 <= x <= Pi/4)
+
+    __m256d ys = _mm256_set1_pd(1.58962301576546568060E-10);
+    ys         = _mm256_add_pd(_mm256_mul_pd(ys, z), _mm256_set1_pd(-2.50507477628578072866E-8));
+    ys         = _mm256_add_pd(_mm256_mul_pd(ys, z), _mm256_set1_pd(2.75573136213857245213E-6));
+    ys         = _mm256_add_pd(_mm256_mul_pd(ys, z), _mm256_set1_pd(-1.98412698295895385996E-4));
+    ys         = _mm256_add_pd(_mm256_mul_pd(ys, z), _mm256_set1_pd(8.33333333332211858878E-3));
+    ys         = _mm256_add_pd(_mm256_mul_pd(ys, z), _mm256_set1_pd(-1.66666666666666307295E-1));
+    ys         = _mm256_mul_pd(_mm256_mul_pd(ys, z), x);
+    ys         = _mm256_add_pd(ys, x);
+
+    // select the correct result from the two polynoms and update the sign
+    y = _mm256_blendv_pd(yc, ys, poly_mask);
+    y = _mm256_xor_pd(y, sign_bit);
+
+    return _mm256_or_pd(y, invalid_mask);
+}
+
+/*!
+ * \brief AVX-Vectorized sinus in double-precision
+ *
+ * The maximum error is 1 ULP for |x| < 10^6 and a few ULP up to
+ * 2^30, larger arguments are not supported.
+ *
+ * \param x The vector of numbers to compute the sinus from
+ * \return a vector containing the sinus of the input vector values
+ */
+ETL_INLINE_VEC_256D sin256_pd(__m256d x) {
+    return sincos256_pd(x, false);
+}
+
+/*!
+ * \brief AVX-Vectorized cosinus in double-precision
+ *
+ * The maximum error is 1 ULP for |x| < 10^6 and a few ULP up to
+ * 2^30, larger arguments are not supported.
+ *
+ * \param x The vector of numbers to compute the cosinus from
+ * \return a vector containing the cosinus of the input vector values
+ */
+ETL_INLINE_VEC_256D cos256_pd(__m256d x) {
+    return sincos256_pd(x, true);
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic tangent in single-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_256 tanh256_ps(__m256 x) {
+    const __m256 one       = _mm256_set1_ps(1.0f);
+    const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+
+    __m256 sign_bit = _mm256_and_ps(x, sign_mask);
+    __m256 z        = _mm256_andnot_ps(sign_mask, x);
+
+    // tanh(|x|) = 1 - 2 / (exp(2|x|) + 1), tanh(20) is already 1
+    __m256 e     = exp256_ps(_mm256_mul_ps(_mm256_min_ps(_mm256_set1_ps(20.0f), z), _mm256_set1_ps(2.0f)));
+    __m256 large = _mm256_sub_ps(one, _mm256_div_ps(_mm256_set1_ps(2.0f), _mm256_add_ps(e, one)));
+    large        = _mm256_or_ps(large, sign_bit);
+
+    // tanh(x) = x + x^3 * P(x^2) for |x| <= 0.625
+
+    __m256 s     = _mm256_mul_ps(x, x);
+    __m256 small = _mm256_set1_ps(-5.70498872745E-3f);
+    small        = _mm256_add_ps(_mm256_mul_ps(small, s), _mm256_set1_ps(2.06390887954E-2f));
+    small        = _mm256_add_ps(_mm256_mul_ps(small, s), _mm256_set1_ps(-5.37397155531E-2f));
+    small        = _mm256_add_ps(_mm256_mul_ps(small, s), _mm256_set1_ps(1.33314422036E-1f));
+    small        = _mm256_add_ps(_mm256_mul_ps(small, s), _mm256_set1_ps(-3.33332819422E-1f));
+    small        = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(small, s), x), x);
+
+    return _mm256_blendv_ps(small, large, _mm256_cmp_ps(z, _mm256_set1_ps(0.625f), _CMP_GT_OQ));
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic tangent in double-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_256D tanh256_pd(__m256d x) {
+    const __m256d one       = _mm256_set1_pd(1.0);
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+
+    __m256d sign_bit = _mm256_and_pd(x, sign_mask);
+    __m256d z        = _mm256_andnot_pd(sign_mask, x);
+
+    // tanh(|x|) = 1 - 2 / (exp(2|x|) + 1), tanh(20) is already 1
+    __m256d e     = exp256_pd(_mm256_mul_pd(_mm256_min_pd(_mm256_set1_pd(20.0), z), _mm256_set1_pd(2.0)));
+    __m256d large = _mm256_sub_pd(one, _mm256_div_pd(_mm256_set1_pd(2.0), _mm256_add_pd(e, one)));
+    large         = _mm256_or_pd(large, sign_bit);
+
+    // tanh(x) = x + x^3 * P(x^2) / Q(x^2) for |x| <= 0.625
+
+    __m256d s = _mm256_mul_pd(x, x);
+
+    __m256d p = _mm256_set1_pd(-9.64399179425052238628E-1);
+    p         = _mm256_add_pd(_mm256_mul_pd(p, s), _mm256_set1_pd(-9.92877231001918586564E1));
+    p         = _mm256_add_pd(_mm256_mul_pd(p, s), _mm256_set1_pd(-1.61468768441708447952E3));
+
+    __m256d q = _mm256_add_pd(s, _mm256_set1_pd(1.12811678491632931402E2));
+    q         = _mm256_add_pd(_mm256_mul_pd(q, s), _mm256_set1_pd(2.23548839060100448583E3));
+    q         = _mm256_add_pd(_mm256_mul_pd(q, s), _mm256_set1_pd(4.84406305325125486048E3));
+
+    __m256d small = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(x, s), _mm256_div_pd(p, q)), x);
+
+    return _mm256_blendv_pd(small, large, _mm256_cmp_pd(z, _mm256_set1_pd(0.625), _CMP_GT_OQ));
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic sinus in single-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_256 sinh256_ps(__m256 x) {
+    const __m256 half      = _mm256_set1_ps(0.5f);
+    const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+
+    __m256 sign_bit = _mm256_and_ps(x, sign_mask);
+    __m256 z        = _mm256_andnot_ps(sign_mask, x);
+
+    // sinh(|x|) = exp(|x|) / 2 - 1 / (2 * exp(|x|))
+    __m256 e     = exp256_ps(z);
+    __m256 large = _mm256_sub_ps(_mm256_mul_ps(half, e), _mm256_div_ps(half, e));
+    large        = _mm256_or_ps(large, sign_bit);
+
+    // sinh(x) = x + x^3 * P(x^2) for |x| <= 1
+
+    __m256 s     = _mm256_mul_ps(x, x);
+    __m256 small = _mm256_set1_ps(2.03721912945E-4f);
+    small        = _mm256_add_ps(_mm256_mul_ps(small, s), _mm256_set1_ps(8.33028376239E-3f));
+    small        = _mm256_add_ps(_mm256_mul_ps(small, s), _mm256_set1_ps(1.66667160211E-1f));
+    small        = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(small, s), x), x);
+
+    return _mm256_blendv_ps(small, large, _mm256_cmp_ps(z, _mm256_set1_ps(1.0f), _CMP_GT_OQ));
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic sinus in double-precision
+ *
+ * The maximum error is 3 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_256D sinh256_pd(__m256d x) {
+    const __m256d half      = _mm256_set1_pd(0.5);
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+
+    __m256d sign_bit = _mm256_and_pd(x, sign_mask);
+    __m256d z        = _mm256_andnot_pd(sign_mask, x);
+
+    // sinh(|x|) = exp(|x|) / 2 - 1 / (2 * exp(|x|))
+    __m256d e     = exp256_pd(z);
+    __m256d large = _mm256_sub_pd(_mm256_mul_pd(half, e), _mm256_div_pd(half, e));
+    large         = _mm256_or_pd(large, sign_bit);
+
+    // sinh(x) = x + x^3 * P(x^2) / Q(x^2) for |x| <= 1
+
+    __m256d s = _mm256_mul_pd(x, x);
+
+    __m256d p = _mm256_set1_pd(-7.89474443963537015605E-1);
+    p         = _mm256_add_pd(_mm256_mul_pd(p, s), _mm256_set1_pd(-1.63725857525983828727E2));
+    p         = _mm256_add_pd(_mm256_mul_pd(p, s), _mm256_set1_pd(-1.15614435765005216044E4));
+    p         = _mm256_add_pd(_mm256_mul_pd(p, s), _mm256_set1_pd(-3.51754964808151394800E5));
+
+    __m256d q = _mm256_add_pd(s, _mm256_set1_pd(-2.77711081420602794433E2));
+    q         = _mm256_add_pd(_mm256_mul_pd(q, s), _mm256_set1_pd(3.61578279834431989373E4));
+    q         = _mm256_add_pd(_mm256_mul_pd(q, s), _mm256_set1_pd(-2.11052978884890840399E6));
+
+    __m256d small = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(x, s), _mm256_div_pd(p, q)), x);
+
+    return _mm256_blendv_pd(small, large, _mm256_cmp_pd(z, _mm256_set1_pd(1.0), _CMP_GT_OQ));
+}
+
 } //end of namespace etl
 
 #endif //__AVX__
@@ -1241,6 +1241,50 @@ struct avx_vec {
         return etl::sin256_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) cos(avx_simd_double x) {
+        return etl::cos256_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) sin(avx_simd_double x) {
+        return etl::sin256_pd(x.value);
+    }
+
+    // Hyperbolic functions
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_float) tanh(avx_simd_float x) {
+        return etl::tanh256_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) tanh(avx_simd_double x) {
+        return etl::tanh256_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_float) sinh(avx_simd_float x) {
+        return etl::sinh256_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) sinh(avx_simd_double x) {
+        return etl::sinh256_pd(x.value);
+    }
+
 #ifndef __INTEL_COMPILER
 
     //Exponential
@@ -1268,6 +1312,13 @@ struct avx_vec {
         return etl::log256_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) log(avx_simd_double x) {
+        return etl::log256_pd(x.value);
+    }
+
 #else //__INTEL_COMPILER
 
     //Exponential
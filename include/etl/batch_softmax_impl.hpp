@@ -19,6 +19,7 @@ namespace etl {
  */
 enum class batch_softmax_impl {
     STD,  ///< Standard implementation
+    VEC,  ///< Vectorized implementation
     CUDNN ///< GPU implementation
 };
 
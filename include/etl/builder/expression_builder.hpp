@@ -15,6 +15,8 @@
 //Include implementations
 #include "etl/impl/dot.hpp"
 #include "etl/impl/sum.hpp"
+#include "etl/impl/variance.hpp"
+#include "etl/impl/minmax.hpp"
 #include "etl/impl/norm.hpp"
 
 #include "etl/builder/binary_expression_builder.hpp"
@@ -120,8 +122,7 @@ auto clip(E&& value, T min, T max) {
  * \brief Apply pow(x, v) on each element x of the ETL expression.
  *
  * This function is not guaranteed to return the same results in
- * different operation modes (CPU, GPU, VEC). It should only be used
- * with positives x.
+ * different operation modes (CPU, GPU).
  *
  * \param value The ETL expression
  * \param v The power
@@ -232,9 +233,9 @@ auto conj(E&& value) -> unary_expr<value_t<E>, detail::build_type<E>, conj_unary
  * \return an expression representing the input expression plus noise
  */
 template <typename E>
-auto uniform_noise(E&& value) -> detail::unary_helper<E, uniform_noise_unary_op> {
+auto uniform_noise(E&& value) {
     static_assert(is_etl_expr<E>, "etl::uniform_noise can only be used on ETL expressions");
-    return detail::unary_helper<E, uniform_noise_unary_op>{value};
+    return detail::make_stateful_unary_expr<E, uniform_noise_unary_op<value_t<E>>>(value);
 }
 
 /*!
@@ -253,9 +254,9 @@ auto uniform_noise(G& g, E&& value) {
  * \return an expression representing the input expression plus noise
  */
 template <typename E>
-auto normal_noise(E&& value) -> detail::unary_helper<E, normal_noise_unary_op> {
+auto normal_noise(E&& value) {
     static_assert(is_etl_expr<E>, "etl::normal_noise can only be used on ETL expressions");
-    return detail::unary_helper<E, normal_noise_unary_op>{value};
+    return detail::make_stateful_unary_expr<E, normal_noise_unary_op<value_t<E>>>(value);
 }
 
 /*!
@@ -274,9 +275,9 @@ auto normal_noise(G& g, E&& value) {
  * \return an expression representing the input expression plus noise
  */
 template <typename E>
-auto logistic_noise(E&& value) -> detail::unary_helper<E, logistic_noise_unary_op> {
+auto logistic_noise(E&& value) {
     static_assert(is_etl_expr<E>, "etl::logistic_noise can only be used on ETL expressions");
-    return detail::unary_helper<E, logistic_noise_unary_op>{value};
+    return detail::make_stateful_unary_expr<E, logistic_noise_unary_op<value_t<E>>>(value);
 }
 
 /*!
@@ -297,10 +298,10 @@ auto logistic_noise(G& g, E&& value) {
  * \return An expression representing the left value plus the noise
  */
 template <typename E, typename T>
-auto ranged_noise(E&& value, T v) -> detail::left_binary_helper_op<E, scalar<value_t<E>>, ranged_noise_binary_op<value_t<E>, value_t<E>>> {
+auto ranged_noise(E&& value, T v) {
     static_assert(is_etl_expr<E>, "etl::ranged_noise can only be used on ETL expressions");
     static_assert(std::is_arithmetic<T>::value, "etl::ranged_noise can only be used with arithmetic values");
-    return {value, scalar<value_t<E>>(v)};
+    return detail::make_stateful_unary_expr<E, ranged_noise_unary_op<value_t<E>>>(value, value_t<E>(v));
 }
 
 // Apply a stable transformation
@@ -703,6 +704,24 @@ value_t<E> amean(E&& values) {
     return asum(values) / etl::size(values);
 }
 
+/*!
+ * \brief Returns the (population) variance of all the values contained in the given expression
+ *
+ * The mean and the variance are computed in a single pass.
+ *
+ * \param values The expression to reduce
+ * \return The variance of the values of the expression
+ */
+template <typename E>
+value_t<E> variance(E&& values) {
+    static_assert(is_etl_expr<E>, "etl::variance can only be used on ETL expressions");
+
+    //Reduction force evaluation
+    force(values);
+
+    return detail::variance_impl::apply(values).variance();
+}
+
 /*!
  * \brief Returns the standard deviation of all the values contained in the given expression
  * \param values The expression to reduce
@@ -712,14 +731,10 @@ template <typename E>
 value_t<E> stddev(E&& values) {
     static_assert(is_etl_expr<E>, "etl::stddev can only be used on ETL expressions");
 
-    auto mean = etl::mean(values);
-
-    double std = 0.0;
-    for (auto value : values) {
-        std += (value - mean) * (value - mean);
-    }
+    //Reduction force evaluation
+    force(values);
 
-    return std::sqrt(std / etl::size(values));
+    return std::sqrt(detail::variance_impl::apply(values).variance());
 }
 
 namespace detail {
@@ -753,15 +768,7 @@ size_t max_index(E&& values) {
     //Reduction force evaluation
     force(values);
 
-    size_t m = 0;
-
-    for (size_t i = 1; i < etl::size(values); ++i) {
-        if (values[i] > values[m]) {
-            m = i;
-        }
-    }
-
-    return m;
+    return detail::max_index_impl::apply(values);
 }
 
 /*!
@@ -790,15 +797,7 @@ size_t min_index(E&& values) {
     //Reduction force evaluation
     force(values);
 
-    size_t m = 0;
-
-    for (size_t i = 1; i < etl::size(values); ++i) {
-        if (values[i] < values[m]) {
-            m = i;
-        }
-    }
-
-    return m;
+    return detail::min_index_impl::apply(values);
 }
 
 /*!
@@ -340,9 +340,9 @@ auto softplus(E&& value) -> detail::unary_helper<E, softplus_unary_op> {
  * \return an expression representing the Bernoulli sampling of the given expression
  */
 template <typename E>
-auto bernoulli(const E& value) -> detail::unary_helper<E, bernoulli_unary_op> {
+auto bernoulli(const E& value) {
     static_assert(is_etl_expr<E>, "etl::bernoulli can only be used on ETL expressions");
-    return detail::unary_helper<E, bernoulli_unary_op>{value};
+    return detail::make_stateful_unary_expr<E, bernoulli_unary_op<value_t<E>>>(value);
 }
 
 /*!
@@ -361,9 +361,9 @@ auto bernoulli(G& g, E&& value) {
  * \return an expression representing the Reverse Bernoulli sampling of the given expression
  */
 template <typename E>
-auto r_bernoulli(const E& value) -> detail::unary_helper<E, reverse_bernoulli_unary_op> {
+auto r_bernoulli(const E& value) {
     static_assert(is_etl_expr<E>, "etl::r_bernoulli can only be used on ETL expressions");
-    return detail::unary_helper<E, reverse_bernoulli_unary_op>{value};
+    return detail::make_stateful_unary_expr<E, reverse_bernoulli_unary_op<value_t<E>>>(value);
 }
 
 /*!
@@ -521,9 +521,9 @@ decltype(auto) softmax_backward(O&& output, E&& errors) {
  * \return the backward activation of the activation function
  */
 template <typename O, typename E>
-auto tanh_backward(O&& output, E&& errors){
+auto tanh_backward(O&& output, E&& errors) {
     static_assert(is_etl_expr<E>, "etl::tanh_derivative can only be used on ETL expressions");
-    return 1.0 - (output >> output) >> errors;
+    return detail::left_binary_helper<O, E, tanh_derivative_binary_op>{output, errors};
 }
 
 /*!
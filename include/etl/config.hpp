@@ -196,6 +196,12 @@ constexpr bool sse3_enabled = ETL_SSE3_BOOL;
  */
 constexpr bool vec_enabled = avx512_enabled || avx_enabled || sse3_enabled;
 
+/*!
+ * \brief Indicates if the hot kernels are compiled for several
+ * instruction sets and selected at runtime from the CPU features.
+ */
+constexpr bool runtime_dispatch = ETL_RUNTIME_DISPATCH_BOOL;
+
 /*!
  * \brief Indicates if the projectis compiled with intel compiler.
  */
@@ -234,6 +234,16 @@ static_assert(false, "EGBLAS is only intended to work with CUBLAS, not alone");
 #define ETL_SSE3_BOOL false
 #endif
 
+// Runtime dispatch is only supported with GCC on x86 (target_clones)
+
+#if defined(ETL_RUNTIME_DISPATCH) && defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) && (defined(__x86_64__) || defined(__i386__))
+#define ETL_RUNTIME_DISPATCH_BOOL true
+#define ETL_TARGET_CLONES __attribute__((target_clones("arch=skylake-avx512", "arch=haswell", "avx", "sse3", "default")))
+#else
+#define ETL_RUNTIME_DISPATCH_BOOL false
+#define ETL_TARGET_CLONES
+#endif
+
 // Configuration flags with values
 
 #define ETL_DEFAULT_CACHE_SIZE 3UL * 1024 * 1024
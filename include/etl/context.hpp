@@ -40,6 +40,7 @@ struct context {
     forced_impl<outer_impl> outer_selector;           ///< Forced selector for outer product
     forced_impl<bias_add_impl> bias_add_selector;           ///< Forced selector for bias_add product
     forced_impl<fft_impl> fft_selector;               ///< Forced selector for fft
+    forced_impl<batch_softmax_impl> batch_softmax_selector; ///< Forced selector for batch softmax
 #endif
 };
 
@@ -70,7 +71,8 @@ inline bool is_something_forced(){
         || c.gemm_selector.forced
         || c.outer_selector.forced
         || c.bias_add_selector.forced
-        || c.fft_selector.forced;
+        || c.fft_selector.forced
+        || c.batch_softmax_selector.forced;
 #else
     return false;
 #endif
@@ -176,6 +178,14 @@ inline forced_impl<fft_impl>& get_forced_impl() {
     return local_context().fft_selector;
 }
 
+/*!
+ * \copydoc get_forced_impl
+ */
+template <>
+inline forced_impl<batch_softmax_impl>& get_forced_impl() {
+    return local_context().batch_softmax_selector;
+}
+
 #endif
 
 /*!
@@ -0,0 +1,201 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Runtime detection of the CPU features and kernels compiled
+ * for several instruction sets.
+ *
+ * When ETL_RUNTIME_DISPATCH is defined, the kernels of this file are
+ * compiled for SSE3, AVX, AVX2 and AVX-512 and the best version is
+ * selected once by the loader from the CPU features. This allows a
+ * binary compiled for a generic target to use the widest vector
+ * instructions available on the machine it runs on.
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief Detect the best vector mode supported by the current CPU
+ * \return the widest vector mode supported by the CPU
+ */
+inline vector_mode_t detect_vector_mode() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) {
+        return vector_mode_t::AVX512;
+    } else if (__builtin_cpu_supports("avx")) {
+        return vector_mode_t::AVX;
+    } else if (__builtin_cpu_supports("sse3")) {
+        return vector_mode_t::SSE3;
+    }
+
+    return vector_mode_t::NONE;
+#else
+    return vector_mode;
+#endif
+}
+
+/*!
+ * \brief Return the best vector mode supported by the current CPU.
+ *
+ * The detection is only done once.
+ *
+ * \return the widest vector mode supported by the CPU
+ */
+inline vector_mode_t runtime_vector_mode() {
+    static const vector_mode_t mode = detect_vector_mode();
+    return mode;
+}
+
+/*!
+ * \brief Indicates if the runtime dispatched kernels should be
+ * preferred over the kernels vectorized at compile-time.
+ *
+ * This is only the case when runtime dispatch is enabled and the CPU
+ * supports a wider vector mode than the one ETL was compiled for.
+ *
+ * \return true if the dispatched kernels should be used, false otherwise
+ */
+inline bool runtime_vector_wider() {
+    return runtime_dispatch && runtime_vector_mode() > vector_mode;
+}
+
+namespace detail {
+
+/*!
+ * \brief Compute the sum of the n elements of a
+ * \param a The input memory
+ * \param n The number of elements
+ * \return the sum of the elements
+ */
+template <typename T>
+ETL_TARGET_CLONES T dispatch_sum(const T* a, size_t n) {
+    // Independent accumulators to let the compiler vectorize the loop
+    T acc[16] = {};
+
+    size_t i = 0;
+
+    for (; i + 15 < n; i += 16) {
+        for (size_t j = 0; j < 16; ++j) {
+            acc[j] += a[i + j];
+        }
+    }
+
+    T r(0);
+
+    for (; i < n; ++i) {
+        r += a[i];
+    }
+
+    for (size_t j = 0; j < 16; ++j) {
+        r += acc[j];
+    }
+
+    return r;
+}
+
+/*!
+ * \brief Compute the dot product of the n elements of a and b
+ * \param a The lhs memory
+ * \param b The rhs memory
+ * \param n The number of elements
+ * \return the dot product
+ */
+template <typename T>
+ETL_TARGET_CLONES T dispatch_dot(const T* a, const T* b, size_t n) {
+    // Independent accumulators to let the compiler vectorize the loop
+    T acc[16] = {};
+
+    size_t i = 0;
+
+    for (; i + 15 < n; i += 16) {
+        for (size_t j = 0; j < 16; ++j) {
+            acc[j] += a[i + j] * b[i + j];
+        }
+    }
+
+    T r(0);
+
+    for (; i < n; ++i) {
+        r += a[i] * b[i];
+    }
+
+    for (size_t j = 0; j < 16; ++j) {
+        r += acc[j];
+    }
+
+    return r;
+}
+
+/*!
+ * \brief Compute the row-major matrix-matrix multiplication c = a * b
+ *
+ * The B matrix is processed by blocks to remain in cache while the
+ * innermost loop is left to the compiler for vectorization.
+ *
+ * \param a The lhs matrix (M x K)
+ * \param b The rhs matrix (K x N)
+ * \param c The output matrix (M x N)
+ * \param M The number of rows of a and c
+ * \param N The number of columns of b and c
+ * \param K The number of columns of a and rows of b
+ */
+template <typename T>
+ETL_TARGET_CLONES void dispatch_gemm_rr(const T* a, const T* b, T* ETL_RESTRICT c, size_t M, size_t N, size_t K) {
+    static constexpr size_t KB = 128;
+    static constexpr size_t NB = 512;
+
+    for (size_t i = 0; i < M * N; ++i) {
+        c[i] = T(0);
+    }
+
+    for (size_t kk = 0; kk < K; kk += KB) {
+        const size_t k_end = std::min(kk + KB, K);
+
+        for (size_t jj = 0; jj < N; jj += NB) {
+            const size_t j_end = std::min(jj + NB, N);
+
+            for (size_t i = 0; i < M; ++i) {
+                T* ETL_RESTRICT c_row = c + i * N;
+
+                for (size_t k = kk; k < k_end; ++k) {
+                    const T a_ik = a[i * K + k];
+                    const T* ETL_RESTRICT b_row = b + k * N;
+
+                    for (size_t j = jj; j < j_end; ++j) {
+                        c_row[j] += a_ik * b_row[j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Assign the n first elements of the expression rhs to lhs
+ *
+ * The expression is inlined into each version of the loop so that
+ * simple expressions can be vectorized by the compiler.
+ *
+ * \param lhs The output memory
+ * \param rhs The expression to assign
+ * \param n The number of elements
+ */
+template <typename T, typename R>
+ETL_TARGET_CLONES void dispatch_assign(T* lhs, R&& rhs, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        lhs[i] = rhs.read_flat(i);
+    }
+}
+
+} //end of namespace detail
+
+} //end of namespace etl
@@ -37,6 +37,7 @@
 #include "etl/util/counters.hpp"
 #include "etl/util/variadic.hpp"
 #include "etl/restrict.hpp"
+#include "etl/cpu_dispatch.hpp"
 #include "etl/eval_visitors.hpp"  //Evaluation visitors
 
 //Forward declarations
@@ -180,6 +181,9 @@
 #include "etl/custom_fast.hpp"
 #include "etl/gpu_dyn.hpp"
 
+// The packed convolution filters
+#include "etl/packed_conv_filter.hpp"
+
 // The adapters
 #include "etl/adapters/symmetric.hpp"
 #include "etl/adapters/hermitian.hpp"
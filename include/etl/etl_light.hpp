@@ -37,6 +37,7 @@
 #include "etl/util/counters.hpp"
 #include "etl/util/variadic.hpp"
 #include "etl/restrict.hpp"
+#include "etl/cpu_dispatch.hpp"
 #include "etl/eval_visitors.hpp"  //Evaluation visitors
 
 //Forward declarations
@@ -9,6 +9,9 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+//Get the implementations
+#include "etl/impl/vec/softmax.hpp"
+
 namespace etl {
 
 /*!
@@ -78,10 +81,17 @@ struct batch_softmax_expr : base_temporary_expr_un<batch_softmax_expr<A, Stable>
      */
     template<typename C>
     constexpr static batch_softmax_impl select_default_impl(bool no_gpu){
-        if (cudnn_enabled && all_homogeneous<A, C> && all_floating<A, C> && !no_gpu) {
+        constexpr bool homo         = all_homogeneous<A, C>;
+        constexpr bool vec_possible = vec_enabled && vectorize_impl && all_vectorizable<vector_mode, A, C> && all_floating<A, C> && homo;
+
+        if (cudnn_enabled && homo && all_floating<A, C> && !no_gpu) {
             return batch_softmax_impl::CUDNN;
         }
 
+        if (vec_possible) {
+            return batch_softmax_impl::VEC;
+        }
+
         return batch_softmax_impl::STD;
     }
 
@@ -92,7 +102,37 @@ struct batch_softmax_expr : base_temporary_expr_un<batch_softmax_expr<A, Stable>
      */
     template<typename C>
     static batch_softmax_impl select_impl(){
-        return select_default_impl<C>(local_context().cpu);
+        auto def = select_default_impl<C>(local_context().cpu);
+
+        if (local_context().batch_softmax_selector.forced) {
+            auto forced = local_context().batch_softmax_selector.impl;
+
+            switch (forced) {
+                //CUDNN cannot always be used
+                case batch_softmax_impl::CUDNN:
+                    if (!cudnn_enabled || !all_floating<A, C> || !all_homogeneous<A, C> || local_context().cpu) {
+                        std::cerr << "Forced selection to CUDNN batch_softmax implementation, but not possible for this expression" << std::endl;
+                        return def;
+                    }
+
+                    return forced;
+
+                //VEC cannot always be used
+                case batch_softmax_impl::VEC:
+                    if (!vec_enabled || !vectorize_impl || !all_vectorizable<vector_mode, A, C> || !all_floating<A, C> || !all_homogeneous<A, C>) {
+                        std::cerr << "Forced selection to VEC batch_softmax implementation, but not possible for this expression" << std::endl;
+                        return def;
+                    }
+
+                    return forced;
+
+                //In other cases, simply use the forced impl
+                default:
+                    return forced;
+            }
+        }
+
+        return def;
     }
 
 #else
@@ -131,15 +171,23 @@ struct batch_softmax_expr : base_temporary_expr_un<batch_softmax_expr<A, Stable>
             } else {
                 impl::cudnn::softmax(a_gpu, c);
             }
+        } else if /*constexpr_select*/ (impl == batch_softmax_impl::VEC) {
+            decltype(auto) a_dma = smart_forward(a);
+
+            if /*constexpr*/ (Stable) {
+                impl::vec::stable_softmax(a_dma, c);
+            } else {
+                impl::vec::softmax(a_dma, c);
+            }
         } else if /*constexpr_select*/ (impl == batch_softmax_impl::STD) {
             if /*constexpr*/ (Stable) {
                 for (size_t i = 0; i < etl::dim<0>(c); ++i) {
-                    c(i) = exp(a(i)) / sum(exp(a(i)));
+                    auto m = max(a(i));
+                    c(i)   = exp(a(i) - m) / sum(exp(a(i) - m));
                 }
             } else {
                 for (size_t i = 0; i < etl::dim<0>(c); ++i) {
-                    auto m = max(a(i));
-                    c(i)   = exp(a(i) - m) / sum(exp(a(i) - m));
+                    c(i) = exp(a(i)) / sum(exp(a(i)));
                 }
             }
         } else {
@@ -274,7 +274,7 @@ conv_2d_valid_multi_expr<detail::build_type<A>, detail::build_type<B>, S1, S2, P
  *
  * \return an expression representing the 'valid' 1D convolution of a and b
  */
-template <size_t S1 = 1, size_t S2 = 1, size_t P1 = 0, size_t P2 = 0, typename A, typename B, typename C>
+template <size_t S1 = 1, size_t S2 = 1, size_t P1 = 0, size_t P2 = 0, typename A, typename B, typename C, cpp_disable_iff(is_packed_conv_filter<B>)>
 auto conv_2d_valid_multi(A&& a, B&& b, C&& c){
     static_assert(all_etl_expr<A, B, C>, "Convolution only supported for ETL expressions");
 
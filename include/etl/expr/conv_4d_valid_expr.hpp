@@ -285,7 +285,7 @@ conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, S1, S2, P1, P2,
  *
  * \return an expression representing the 'valid' 1D convolution of a and b
  */
-template <size_t S1 = 1, size_t S2 = 1, size_t P1 = 0, size_t P2 = 0, typename A, typename B, typename C>
+template <size_t S1 = 1, size_t S2 = 1, size_t P1 = 0, size_t P2 = 0, typename A, typename B, typename C, cpp_disable_iff(is_packed_conv_filter<B>)>
 auto conv_4d_valid(A&& a, B&& b, C&& c){
     static_assert(all_etl_expr<A, B, C>, "Convolution only supported for ETL expressions");
 
@@ -300,6 +300,12 @@ auto conv_4d_valid(A&& a, B&& b, C&& c){
  * The 4D matrix a is assumed to be of [N, C, H, W] dimensions.
  * The 4D matrix b is assumed to be of [K, C, H, W] dimensions.
  *
+ * The GEMM-based implementations use the flipped kernels directly, without
+ * any copy. Kernels that are used for several convolutions can be flipped
+ * once (with deep_fflip_inplace) and then be reused with this function.
+ * An etl::packed_conv_filter also saves the Winograd transforms of the
+ * kernels.
+ *
  * \param a The input expression
  * \param b The kernel expression
  *
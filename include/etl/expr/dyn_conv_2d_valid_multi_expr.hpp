@@ -247,7 +247,7 @@ dyn_conv_2d_valid_multi_expr<detail::build_type<A>, detail::build_type<B>, false
  * \param p2 The second dimension padding (top and bottom)
  * \return an expression representing the valid 2D convolution of a and b
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_disable_iff(is_packed_conv_filter<B>)>
 auto conv_2d_valid_multi(A&& a, B&& b, C&& c, size_t s1, size_t s2, size_t p1, size_t p2){
     static_assert(all_etl_expr<A, B, C>, "Convolution only supported for ETL expressions");
 
@@ -11,6 +11,61 @@
 
 namespace etl {
 
+namespace detail {
+
+/*!
+ * \brief Traits to compute the last dimension of the result of a FFT
+ * from the last dimension of its input.
+ *
+ * By default, the dimensions are preserved.
+ *
+ * \tparam Impl The implementation functor of the FFT
+ */
+template <typename Impl>
+struct fft_last_dim {
+    /*!
+     * \brief Returns the last dimension of the result
+     * \param n The last dimension of the input
+     */
+    static constexpr size_t dim(size_t n) {
+        return n;
+    }
+};
+
+/*!
+ * \copydoc fft_last_dim
+ *
+ * The real FFT only keeps the n / 2 + 1 first coefficients.
+ */
+template <>
+struct fft_last_dim<rfft1_impl> {
+    /*!
+     * \brief Returns the last dimension of the result
+     * \param n The last dimension of the input
+     */
+    static constexpr size_t dim(size_t n) {
+        return n / 2 + 1;
+    }
+};
+
+/*!
+ * \copydoc fft_last_dim
+ *
+ * The inverse real FFT assumes an even output size.
+ */
+template <>
+struct fft_last_dim<irfft1_impl> {
+    /*!
+     * \brief Returns the last dimension of the result
+     * \param n The last dimension of the input
+     */
+    static constexpr size_t dim(size_t n) {
+        return 2 * (n - 1);
+    }
+};
+
+} //end of namespace detail
+
 /*!
  * \brief A transposition expression.
  * \tparam A The transposed type
@@ -149,7 +204,9 @@ struct etl_traits<etl::fft_expr<A, T, Impl>> {
      */
     template <size_t DD>
     static constexpr size_t dim() {
-        return decay_traits<A>::template dim<DD>();
+        return DD == sub_traits::dimensions() - 1
+                   ? detail::fft_last_dim<Impl>::dim(decay_traits<A>::template dim<DD>())
+                   : decay_traits<A>::template dim<DD>();
     }
 
     /*!
@@ -159,7 +216,9 @@ struct etl_traits<etl::fft_expr<A, T, Impl>> {
      * \return the dth dimension of the expression
      */
     static size_t dim(const expr_t& e, size_t d) {
-        return etl::dim(e._a, d);
+        return d == sub_traits::dimensions() - 1
+                   ? detail::fft_last_dim<Impl>::dim(etl::dim(e._a, d))
+                   : etl::dim(e._a, d);
     }
 
     /*!
@@ -168,7 +227,8 @@ struct etl_traits<etl::fft_expr<A, T, Impl>> {
      * \return the size of the expression
      */
     static size_t size(const expr_t& e) {
-        return sub_traits::size(e._a);
+        const size_t last = etl::dim(e._a, sub_traits::dimensions() - 1);
+        return (sub_traits::size(e._a) / last) * detail::fft_last_dim<Impl>::dim(last);
     }
 
     /*!
@@ -176,7 +236,8 @@ struct etl_traits<etl::fft_expr<A, T, Impl>> {
      * \return the size of the expression
      */
     static constexpr size_t size() {
-        return sub_traits::size();
+        return (sub_traits::size() / sub_traits::template dim<sub_traits::dimensions() - 1>())
+               * detail::fft_last_dim<Impl>::dim(sub_traits::template dim<sub_traits::dimensions() - 1>());
     }
 
     /*!
@@ -293,6 +354,77 @@ auto ifft_1d_real(A&& a, C&& c) {
     return c;
 }
 
+/*!
+ * \brief Creates an expression representing the 1D Fast-Fourrier-Transform of the given real expression.
+ *
+ * Only the n / 2 + 1 first coefficients of the spectrum are computed,
+ * the others are their complex conjugates.
+ *
+ * \param a The input expression
+ * \return an expression representing the half-spectrum of the 1D FFT of a
+ */
+template <typename A>
+fft_expr<detail::build_type<A>, detail::fft_value_type<A>, detail::rfft1_impl> rfft_1d(A&& a) {
+    static_assert(is_etl_expr<A>, "FFT only supported for ETL expressions");
+    static_assert(!is_complex<A>, "Real FFT only supported for real expressions");
+    static_assert(decay_traits<A>::dimensions() == 1, "Real FFT only supported for 1D expressions");
+
+    return fft_expr<detail::build_type<A>, detail::fft_value_type<A>, detail::rfft1_impl>{a};
+}
+
+/*!
+ * \brief Creates an expression representing the 1D Fast-Fourrier-Transform of the given real expression, the result will be stored in c
+ * \param a The input expression
+ * \param c The result, of size n / 2 + 1
+ * \return an expression representing the half-spectrum of the 1D FFT of a
+ */
+template <typename A, typename C>
+auto rfft_1d(A&& a, C&& c) {
+    static_assert(all_etl_expr<A, C>, "FFT only supported for ETL expressions");
+    cpp_assert(etl::size(c) == etl::size(a) / 2 + 1, "Invalid size for the result of the real FFT");
+
+    c = rfft_1d(a);
+    return c;
+}
+
+/*!
+ * \brief Creates an expression representing the 1D inverse Fast-Fourrier-Transform of the given half-spectrum.
+ *
+ * The input holds the n / 2 + 1 first coefficients of the spectrum of a
+ * real signal of size n = 2 * (size(a) - 1). The irfft_1d(a, c) form must
+ * be used for odd sizes.
+ *
+ * \param a The input expression
+ * \return an expression representing the real 1D inverse FFT of a
+ */
+template <typename A>
+fft_expr<detail::build_type<A>, detail::ifft_real_value_type<A>, detail::irfft1_impl> irfft_1d(A&& a) {
+    static_assert(is_etl_expr<A>, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>, "Inverse real FFT only supported for complex expressions");
+    static_assert(decay_traits<A>::dimensions() == 1, "Inverse real FFT only supported for 1D expressions");
+
+    return fft_expr<detail::build_type<A>, detail::ifft_real_value_type<A>, detail::irfft1_impl>{a};
+}
+
+/*!
+ * \brief Computes the 1D inverse Fast-Fourrier-Transform of the given half-spectrum and stores it in c.
+ *
+ * The size of the real signal is given by the size of c.
+ *
+ * \param a The input expression, of size size(c) / 2 + 1
+ * \param c The result
+ * \return c
+ */
+template <typename A, typename C>
+decltype(auto) irfft_1d(A&& a, C&& c) {
+    static_assert(all_etl_expr<A, C>, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>, "Inverse real FFT only supported for complex expressions");
+    cpp_assert(etl::size(a) == etl::size(c) / 2 + 1, "Invalid size for the input of the inverse real FFT");
+
+    detail::irfft1_impl::apply(a, c);
+    return std::forward<C>(c);
+}
+
 /*!
  * \brief Creates an expression representing the 2D Fast-Fourrier-Transform of the given expression
  * \param a The input expression
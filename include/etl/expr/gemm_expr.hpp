@@ -15,6 +15,7 @@
 #include "etl/impl/blas/gemm.hpp"
 #include "etl/impl/vec/gemm.hpp"
 #include "etl/impl/vec/gemm_conv.hpp"
+#include "etl/impl/vec/conv_winograd.hpp"
 #include "etl/impl/cublas/gemm.hpp"
 
 namespace etl {
@@ -90,6 +91,11 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
      */
     template <typename AA, typename BB, typename C>
     static constexpr gemm_impl select_default_gemm_impl(bool no_gpu) {
+        //Sparse matrices are only supported by the standard kernels
+        if (is_sparse_matrix<AA> || is_sparse_matrix<BB>) {
+            return gemm_impl::STD;
+        }
+
         //Note since these boolean will be known at compile time, the conditions will be a lot simplified
         constexpr bool blas   = cblas_enabled;
         constexpr bool cublas = cublas_enabled;
@@ -118,7 +124,7 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
     static inline gemm_impl select_gemm_impl() {
         auto def = select_default_gemm_impl<AA, BB, C>(local_context().cpu);
 
-        if (local_context().gemm_selector.forced) {
+        if (local_context().gemm_selector.forced && !is_sparse_matrix<AA> && !is_sparse_matrix<BB>) {
             auto forced = local_context().gemm_selector.impl;
 
             switch (forced) {
@@ -89,6 +89,11 @@ struct gemv_expr : base_temporary_expr_bin<gemv_expr<A, B>, A, B> {
      */
     template <typename C>
     static constexpr gemm_impl select_default_gemv_impl(bool no_gpu) {
+        //Sparse matrices are only supported by the standard kernels
+        if (is_sparse_matrix<A> || is_sparse_matrix<B>) {
+            return gemm_impl::STD;
+        }
+
         constexpr bool homo = all_homogeneous<A, B, C>;
 
         if (cublas_enabled && homo && !no_gpu) {
@@ -114,7 +119,7 @@ struct gemv_expr : base_temporary_expr_bin<gemv_expr<A, B>, A, B> {
      */
     template <typename C>
     static inline gemm_impl select_gemv_impl() {
-        if (local_context().gemm_selector.forced) {
+        if (local_context().gemm_selector.forced && !is_sparse_matrix<A> && !is_sparse_matrix<B>) {
             auto forced = local_context().gemm_selector.impl;
 
             switch (forced) {
@@ -9,9 +9,9 @@
  * \file generator_expr.hpp
  * \brief Contains generator expressions.
  *
- * A generator expression is an expression that yields any number of values, for instance random values. The indexes
- * are not taken into account, but rather the sequence in which the functions are called. This is mostly useful for
- * initializing matrices / vectors.
+ * A generator expression is an expression that yields any number of values, for instance random values. Unless the
+ * generator is indexed, the indexes are not taken into account, but rather the sequence in which the functions are
+ * called. This is mostly useful for initializing matrices / vectors.
 */
 
 #pragma once
@@ -28,6 +28,25 @@ class generator_expr final {
 private:
     mutable Generator generator;
 
+    /*!
+     * \brief Generate the value at the given index
+     * \param i The flat index of the value
+     * \return the generated value
+     */
+    template <typename G = Generator, cpp_enable_iff(is_indexed_op<G>)>
+    typename G::value_type generate(size_t i) const {
+        return generator(i);
+    }
+
+    /*!
+     * \copydoc generate
+     */
+    template <typename G = Generator, cpp_disable_iff(is_indexed_op<G>)>
+    typename G::value_type generate(size_t i) const {
+        cpp_unused(i);
+        return generator();
+    }
+
 public:
     using value_type = typename Generator::value_type; ///< The type of value generated
 
@@ -62,8 +81,7 @@ public:
      * \return a reference to the element at the given index.
      */
     value_type operator[](size_t i) const {
-        cpp_unused(i);
-        return generator();
+        return generate(i);
     }
 
     /*!
@@ -73,8 +91,7 @@ public:
      * \return the value at the given index.
      */
     value_type read_flat(size_t i) const {
-        cpp_unused(i);
-        return generator();
+        return generate(i);
     }
 
     /*!
@@ -209,7 +226,7 @@ struct etl_traits<etl::generator_expr<Generator>> {
     static constexpr bool is_view                 = false;           ///< Indicates if the type is a view
     static constexpr bool is_magic_view           = false;           ///< Indicates if the type is a magic view
     static constexpr bool is_linear               = true;            ///< Indicates if the expression is linear
-    static constexpr bool is_thread_safe          = false;           ///< Indicates if the expression is thread safe
+    static constexpr bool is_thread_safe          = is_indexed_op<Generator>; ///< Indicates if the expression is thread safe
     static constexpr bool is_fast                 = true;            ///< Indicates if the expression is fast
     static constexpr bool is_value                = false;           ///< Indicates if the expression is of value type
     static constexpr bool is_direct               = false;           ///< Indicates if the expression has direct memory access
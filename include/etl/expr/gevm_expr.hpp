@@ -87,6 +87,11 @@ struct gevm_expr : base_temporary_expr_bin<gevm_expr<A, B>, A, B> {
      */
     template <typename C>
     static constexpr gemm_impl select_default_gevm_impl(bool no_gpu) {
+        //Sparse matrices are only supported by the standard kernels
+        if (is_sparse_matrix<A> || is_sparse_matrix<B>) {
+            return gemm_impl::STD;
+        }
+
         constexpr bool vec_possible = all_vectorizable_t<vector_mode, A, B, C> && vec_enabled;
         constexpr bool homo         = all_homogeneous<A, B, C>;
 
@@ -113,7 +118,7 @@ struct gevm_expr : base_temporary_expr_bin<gevm_expr<A, B>, A, B> {
      */
     template <typename C>
     static inline gemm_impl select_gevm_impl() {
-        if (local_context().gemm_selector.forced) {
+        if (local_context().gemm_selector.forced && !is_sparse_matrix<A> && !is_sparse_matrix<B>) {
             auto forced = local_context().gemm_selector.impl;
 
             switch (forced) {
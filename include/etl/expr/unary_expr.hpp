@@ -1061,6 +1061,65 @@ private:
     friend struct optimizable<unary_expr>;
     friend struct transformer<unary_expr>;
 
+    /*!
+     * \brief Apply the operator on the element at the given flat index
+     * \param x The value of the sub expression
+     * \param i The flat index of the element
+     * \return The result of the operator
+     */
+    template <typename O = Op, cpp_enable_iff(is_indexed_op<O>)>
+    T apply_flat(const T& x, size_t i) const {
+        return op.apply(x, i);
+    }
+
+    /*!
+     * \copydoc apply_flat
+     */
+    template <typename O = Op, cpp_disable_iff(is_indexed_op<O>)>
+    T apply_flat(const T& x, size_t i) const {
+        cpp_unused(i);
+        return op.apply(x);
+    }
+
+    /*!
+     * \brief Apply the operator on the element at the given position
+     * \param x The value of the sub expression
+     * \param args The indices of the element
+     * \return The result of the operator
+     */
+    template <typename O = Op, typename... S, cpp_enable_iff(is_indexed_op<O>)>
+    T apply_at(const T& x, S... args) const {
+        return op.apply(x, etl::dyn_index(*this, args...));
+    }
+
+    /*!
+     * \copydoc apply_at
+     */
+    template <typename O = Op, typename... S, cpp_disable_iff(is_indexed_op<O>)>
+    T apply_at(const T& x, S... /*args*/) const {
+        return op.apply(x);
+    }
+
+    /*!
+     * \brief Apply the operator on several elements at once
+     * \param x The vector of values of the sub expression
+     * \param i The flat index of the first element
+     * \return a vector containing the results of the operator
+     */
+    template <typename V, typename O = Op, cpp_enable_iff(is_indexed_op<O>)>
+    typename V::template vec_type<T> load_flat(const typename V::template vec_type<T>& x, size_t i) const {
+        return op.template load<V>(x, i);
+    }
+
+    /*!
+     * \copydoc load_flat
+     */
+    template <typename V, typename O = Op, cpp_disable_iff(is_indexed_op<O>)>
+    typename V::template vec_type<T> load_flat(const typename V::template vec_type<T>& x, size_t i) const {
+        cpp_unused(i);
+        return op.template load<V>(x);
+    }
+
 public:
     using value_type        = T;                              ///< The value type
     using memory_type       = void;                           ///< The memory type
@@ -1099,7 +1158,7 @@ public:
      * \return a reference to the element at the given index.
      */
     value_type operator[](size_t i) const {
-        return op.apply(value[i]);
+        return apply_flat(value[i], i);
     }
 
     /*!
@@ -1109,7 +1168,7 @@ public:
      * \return the value at the given index.
      */
     value_type read_flat(size_t i) const {
-        return op.apply(value.read_flat(i));
+        return apply_flat(value.read_flat(i), i);
     }
 
     /*!
@@ -1120,7 +1179,7 @@ public:
      */
     template <typename V = default_vec>
     vec_type<V> load(size_t i) const {
-        return op.template load<V>(value.template load<V>(i));
+        return load_flat<V>(value.template load<V>(i), i);
     }
 
     /*!
@@ -1131,7 +1190,7 @@ public:
      */
     template <typename V = default_vec>
     vec_type<V> loadu(size_t i) const {
-        return op.template load<V>(value.template loadu<V>(i));
+        return load_flat<V>(value.template loadu<V>(i), i);
     }
 
     /*!
@@ -1160,7 +1219,7 @@ public:
     std::enable_if_t<sizeof...(S) == safe_dimensions<this_type>, value_type> operator()(S... args) const {
         static_assert(cpp::all_convertible_to_v<size_t, S...>, "Invalid size types");
 
-        return op.apply(value(args...));
+        return apply_at(value(args...), args...);
     }
 
     /*!
@@ -19,6 +19,7 @@ namespace etl {
  */
 enum class fft_impl {
     STD,  ///< The standard implementation
+    VEC,  ///< The vectorized implementation
     MKL,  ///< The Intel MKL implementation
     CUFFT ///< The NVidia CuFFT implementation
 };
@@ -757,16 +757,10 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
     using T = value_t<I>;
 
     const size_t K  = etl::dim<0>(kernels);
-    const size_t i1 = etl::dim<0>(input);
-    const size_t i2 = etl::dim<1>(input);
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<1>(conv);
     const size_t f2 = etl::dim<2>(conv);
 
@@ -778,53 +772,20 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
     // Flip the kernels
     prepared_k.deep_fflip_inplace();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
-
-    if(p1 || p2){
-        etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-        input_padded = T(0);
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
-        impl::common::pad_2d_input(input, input_padded, p1, p2);
+    im2col_direct_tr(input_col, input, k1, k2, s1, s2, p1, p2);
 
-        im2col_direct_tr(input_col, input_padded, k1, k2);
-    } else {
-        im2col_direct_tr(input_col, input, k1, k2);
-    }
-
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-        // tmp_result = prepared_k * input_col
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, c1 * c2, k1 * k2,
-            T(1.0),
-            prepared_k.memory_start(), k1 * k2,
-            input_col.memory_start(), c1 * c2,
-            T(0.0),
-            tmp_result.memory_start(), c1 * c2);
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < f1; ++i) {
-                for (size_t j = 0; j < f2; ++j) {
-                    conv(k, i, j) = tmp_result(k, i * s1, j * s2);
-                }
-            }
-        }
-    } else {
-        // conv = prepared_k * input_col
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, c1 * c2, k1 * k2,
-            T(1.0),
-            prepared_k.memory_start(), k1 * k2,
-            input_col.memory_start(), c1 * c2,
-            T(0.0),
-            conv.memory_start(), f1 * f2);
-    }
+    // conv = prepared_k * input_col
+    cblas_gemm(
+        CblasRowMajor,
+        CblasNoTrans, CblasNoTrans,
+        K, f1 * f2, k1 * k2,
+        T(1.0),
+        prepared_k.memory_start(), k1 * k2,
+        input_col.memory_start(), f1 * f2,
+        T(0.0),
+        conv.memory_start(), f1 * f2);
 
     conv.invalidate_gpu();
 }
@@ -840,69 +801,30 @@ void blas_conv2_valid_multi_flipped(I&& input, K_T&& kernels, C&& conv, size_t s
     using T = value_t<I>;
 
     const size_t K  = etl::dim<0>(kernels);
-    const size_t i1 = etl::dim<0>(input);
-    const size_t i2 = etl::dim<1>(input);
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<1>(conv);
     const size_t f2 = etl::dim<2>(conv);
 
     input.ensure_cpu_up_to_date();
     kernels.ensure_cpu_up_to_date();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
-    if(p1 || p2){
-        etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-        input_padded = T(0);
+    im2col_direct_tr(input_col, input, k1, k2, s1, s2, p1, p2);
 
-        impl::common::pad_2d_input(input, input_padded, p1, p2);
-
-        im2col_direct_tr(input_col, input_padded, k1, k2);
-    } else {
-        im2col_direct_tr(input_col, input, k1, k2);
-    }
-
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-        // tmp_result = kernels * input_col
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, c1 * c2, k1 * k2,
-            T(1.0),
-            kernels.memory_start(), k1 * k2,
-            input_col.memory_start(), c1 * c2,
-            T(0.0),
-            tmp_result.memory_start(), c1 * c2);
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < f1; ++i) {
-                for (size_t j = 0; j < f2; ++j) {
-                    conv(k, i, j) = tmp_result(k, i * s1, j * s2);
-                }
-            }
-        }
-    } else {
-        // conv = kernels * input_col
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, c1 * c2, k1 * k2,
-            T(1.0),
-            kernels.memory_start(), k1 * k2,
-            input_col.memory_start(), c1 * c2,
-            T(0.0),
-            conv.memory_start(), f1 * f2);
-    }
+    // conv = kernels * input_col
+    cblas_gemm(
+        CblasRowMajor,
+        CblasNoTrans, CblasNoTrans,
+        K, f1 * f2, k1 * k2,
+        T(1.0),
+        kernels.memory_start(), k1 * k2,
+        input_col.memory_start(), f1 * f2,
+        T(0.0),
+        conv.memory_start(), f1 * f2);
 
     conv.invalidate_gpu();
 }
@@ -956,18 +878,12 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
     using T = value_t<I>;
 
     const size_t N  = etl::dim<0>(input);
-    const size_t i1 = etl::dim<1>(input);
-    const size_t i2 = etl::dim<2>(input);
 
     const size_t K  = etl::dim<0>(kernels);
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
 
@@ -979,55 +895,19 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
     // Flip the kernels
     prepared_k.deep_fflip_inplace();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * c1 * c2);
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * f1 * f2);
 
-    if(p1 || p2){
-        etl::dyn_matrix<T, 3> input_padded(N, i1 + 2 * p1, i2 + 2 * p2);
-        input_padded = T(0);
+    im2col_direct_tr_multi(input_col, input, k1, k2, s1, s2, p1, p2);
 
-        for(size_t i = 0; i < N; ++i){
-            impl::common::pad_2d_input(input(i), input_padded(i), p1, p2);
-        }
-
-        im2col_direct_tr_multi(input_col, input_padded, k1, k2);
-    } else {
-        im2col_direct_tr_multi(input_col, input, k1, k2);
-    }
-
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 4> tmp_result(K, N, c1, c2);
-
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, N * c1 * c2, k1 * k2,
-            T(1.0),
-            prepared_k.memory_start(), k1 * k2,
-            input_col.memory_start(), N * c1 * c2,
-            T(0.0),
-            tmp_result.memory_start(), N * c1 * c2);
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < N; ++i) {
-                for (size_t ii = 0; ii < f1; ++ii) {
-                    for (size_t j = 0; j < f2; ++j) {
-                        conv(k, i, ii, j) = tmp_result(k, i, ii * s1, j * s2);
-                    }
-                }
-            }
-        }
-    } else {
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, N * c1 * c2, k1 * k2,
-            T(1.0),
-            prepared_k.memory_start(), k1 * k2,
-            input_col.memory_start(), N * c1 * c2,
-            T(0.0),
-            conv.memory_start(), N * f1 * f2);
-    }
+    cblas_gemm(
+        CblasRowMajor,
+        CblasNoTrans, CblasNoTrans,
+        K, N * f1 * f2, k1 * k2,
+        T(1.0),
+        prepared_k.memory_start(), k1 * k2,
+        input_col.memory_start(), N * f1 * f2,
+        T(0.0),
+        conv.memory_start(), N * f1 * f2);
 
     conv.invalidate_gpu();
 }
@@ -1043,73 +923,31 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
     using T = value_t<I>;
 
     const size_t N  = etl::dim<0>(input);
-    const size_t i1 = etl::dim<1>(input);
-    const size_t i2 = etl::dim<2>(input);
 
     const size_t K  = etl::dim<0>(kernels);
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
 
     input.ensure_cpu_up_to_date();
     kernels.ensure_cpu_up_to_date();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * c1 * c2);
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * f1 * f2);
 
-    if(p1 || p2){
-        etl::dyn_matrix<T, 3> input_padded(N, i1 + 2 * p1, i2 + 2 * p2);
-        input_padded = T(0);
+    im2col_direct_tr_multi(input_col, input, k1, k2, s1, s2, p1, p2);
 
-        for(size_t i = 0; i < N; ++i){
-            impl::common::pad_2d_input(input(i), input_padded(i), p1, p2);
-        }
-
-        im2col_direct_tr_multi(input_col, input_padded, k1, k2);
-    } else {
-        im2col_direct_tr_multi(input_col, input, k1, k2);
-    }
-
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 4> tmp_result(K, N, c1, c2);
-
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, N * c1 * c2, k1 * k2,
-            T(1.0),
-            kernels.memory_start(), k1 * k2,
-            input_col.memory_start(), N * c1 * c2,
-            T(0.0),
-            tmp_result.memory_start(), N * c1 * c2);
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < N; ++i) {
-                for (size_t ii = 0; ii < f1; ++ii) {
-                    for (size_t j = 0; j < f2; ++j) {
-                        conv(k, i, ii, j) = tmp_result(k, i, ii * s1, j * s2);
-                    }
-                }
-            }
-        }
-    } else {
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, N * c1 * c2, k1 * k2,
-            T(1.0),
-            kernels.memory_start(), k1 * k2,
-            input_col.memory_start(), N * c1 * c2,
-            T(0.0),
-            conv.memory_start(), N * f1 * f2);
-    }
+    cblas_gemm(
+        CblasRowMajor,
+        CblasNoTrans, CblasNoTrans,
+        K, N * f1 * f2, k1 * k2,
+        T(1.0),
+        kernels.memory_start(), k1 * k2,
+        input_col.memory_start(), N * f1 * f2,
+        T(0.0),
+        conv.memory_start(), N * f1 * f2);
 
     conv.invalidate_gpu();
 }
@@ -1154,6 +992,11 @@ void blas_conv2_valid_multi_multi_flipped(I&& input, K_T&& kernels, C&& conv, si
 
 /*!
  * \brief Compute a 4D valid convolution using a BLAS matrix multiplication kernel
+ *
+ * The flipped kernels are used directly in their [K, C, m1, m2] storage,
+ * as a K x (C * m1 * m2) matrix, against the columns of all the channels
+ * of each image.
+ *
  * \param input The input matrix
  * \param kernel The kernel matrix, with flipped kernels
  * \param conv The output matrix
@@ -1162,17 +1005,14 @@ void blas_conv2_valid_multi_multi_flipped(I&& input, K_T&& kernels, C&& conv, si
  * \param p1 The padding of the first dimension
  * \param p2 The padding of the second dimension
  */
-template <typename I_T, typename K_T, typename KS_T, typename C_T>
-void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
     using T = value_t<I_T>;
 
     const auto N = etl::dim<0>(input);  // The number of images
     const auto K = etl::dim<0>(kernel); // The number of kernels
     const auto C = etl::dim<1>(input);  // The number of channels
 
-    const auto n1 = etl::dim<2>(input);
-    const auto n2 = etl::dim<3>(input);
-
     const auto m1 = etl::dim<2>(kernel);
     const auto m2 = etl::dim<3>(kernel);
 
@@ -1180,83 +1020,25 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
     const auto c2 = etl::dim<3>(conv);
 
     input.ensure_cpu_up_to_date();
-    kernels.ensure_cpu_up_to_date();
-
-    conv = T(0.0);
+    kernel.ensure_cpu_up_to_date();
 
     auto batch_fun_n = [&](const size_t first, const size_t last) {
         if (last - first) {
-            // unit-strided result dimensions
-            const size_t sc1 = (n1 - m1 + 2 * p1) + 1;
-            const size_t sc2 = (n2 - m2 + 2 * p2) + 1;
-
-            etl::dyn_matrix<T, 2> input_col(m1 * m2, sc1 * sc2);
-
-            // Optimize for the most common case
-            if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
-                for (size_t i = first; i < last; ++i) {
-                    for (size_t c = 0; c < C; ++c) {
-                        im2col_direct_tr(input_col, input(i)(c), m1, m2);
-
-                        cblas_gemm(
-                            CblasRowMajor,
-                            CblasNoTrans, CblasNoTrans,
-                            K, sc1 * sc2, m1 * m2,
-                            T(1.0),
-                            kernels(c).memory_start(), m1 * m2,
-                            input_col.memory_start(), sc1 * sc2,
-                            T(1.0),
-                            conv(i).memory_start(), sc1 * sc2);
-                    }
-                }
-            } else {
-                etl::dyn_matrix<T, 2> input_padded(n1 + 2 * p1, n2 + 2 * p2);
-                etl::dyn_matrix<T, 3> tmp_result(K, sc1, sc2);
-
-                for (size_t i = first; i < last; ++i) {
-                    for (size_t c = 0; c < C; ++c) {
-                        if (p1 || p2) {
-                            input_padded = T(0.0);
-
-                            impl::common::pad_2d_input(input(i)(c), input_padded, p1, p2);
-
-                            im2col_direct_tr(input_col, input_padded, m1, m2);
-                        } else {
-                            im2col_direct_tr(input_col, input(i)(c), m1, m2);
-                        }
-
-                        if (s1 > 1 || s2 > 1) {
-                            cblas_gemm(
-                                CblasRowMajor,
-                                CblasNoTrans, CblasNoTrans,
-                                K, sc1 * sc2, m1 * m2,
-                                T(1.0),
-                                kernels(c).memory_start(), m1 * m2,
-                                input_col.memory_start(), sc1 * sc2,
-                                T(0.0),
-                                tmp_result.memory_start(), sc1 * sc2);
-
-                            // Strided copy of the large result into the small result
-                            for (size_t k = 0; k < K; ++k) {
-                                for (size_t ii = 0; ii < c1; ++ii) {
-                                    for (size_t j = 0; j < c2; ++j) {
-                                        conv(i, k, ii, j) += tmp_result(k, ii * s1, j * s2);
-                                    }
-                                }
-                            }
-                        } else {
-                            cblas_gemm(
-                                CblasRowMajor,
-                                CblasNoTrans, CblasNoTrans,
-                                K, c1 * c2, m1 * m2,
-                                T(1.0),
-                                kernels(c).memory_start(), m1 * m2,
-                                input_col.memory_start(), sc1 * sc2,
-                                T(1.0),
-                                conv(i).memory_start(), c1 * c2);
-                        }
-                    }
-                }
+            // Only the strided output positions are generated by im2col
+            etl::dyn_matrix<T, 2> input_col(C * m1 * m2, c1 * c2);
+
+            for (size_t i = first; i < last; ++i) {
+                im2col_direct_tr(input_col, input(i), m1, m2, s1, s2, p1, p2);
+
+                cblas_gemm(
+                    CblasRowMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    K, c1 * c2, C * m1 * m2,
+                    T(1.0),
+                    kernel.memory_start(), C * m1 * m2,
+                    input_col.memory_start(), c1 * c2,
+                    T(0.0),
+                    conv(i).memory_start(), c1 * c2);
             }
         }
     };
@@ -1283,7 +1065,7 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
 /*!
  * \brief Compute a 4D valid convolution using a BLAS matrix multiplication kernel
  * \param input The input matrix
- * \param kernel The kernel matrix, with flipped kernels
+ * \param kernel The kernel matrix
  * \param conv The output matrix
  * \param s1 The stride of the first dimension
  * \param s2 The stride of the second dimension
@@ -1293,24 +1075,27 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
 template <typename I_T, typename K_T, typename C_T>
 void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
     const auto K = etl::dim<0>(kernel); // The number of kernels
-    const auto C = etl::dim<1>(input);  // The number of channels
-
-    const auto m1 = etl::dim<2>(kernel);
-    const auto m2 = etl::dim<3>(kernel);
+    const auto C = etl::dim<1>(kernel); // The number of channels
 
-    etl::dyn_matrix<value_t<I_T>, 4> kernels(C, K, m1, m2);
+    // The copy also converts the kernels to the type and the storage order of the input
+    etl::dyn_matrix<value_t<I_T>, 4> prepared_k(K, C, etl::dim<2>(kernel), etl::dim<3>(kernel));
 
-    for(size_t c = 0; c < C; ++c){
-        for(size_t k = 0; k < K; ++k){
-            kernels(c)(k) = fflip(kernel(k)(c));
+    for (size_t k = 0; k < K; ++k) {
+        for (size_t c = 0; c < C; ++c) {
+            prepared_k(k)(c) = fflip(kernel(k)(c));
         }
     }
 
-    blas_conv4_valid_prepared(input, kernel, kernels, conv, s1, s2, p1, p2);
+    blas_conv4_valid_prepared(input, prepared_k, conv, s1, s2, p1, p2);
 }
 
 /*!
  * \brief Compute a 4D valid convolution using a BLAS matrix multiplication kernel
+ *
+ * The kernels are used as they are, without any copy. Flipping the
+ * kernels once and reusing them across calls avoids any preparation of
+ * the kernels.
+ *
  * \param input The input matrix
  * \param kernel The kernel matrix, with flipped kernels
  * \param conv The output matrix
@@ -1319,23 +1104,39 @@ void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s
  * \param p1 The padding of the first dimension
  * \param p2 The padding of the second dimension
  */
-template <typename I_T, typename K_T, typename C_T>
+template <typename I_T, typename K_T, typename C_T, cpp_enable_iff(all_homogeneous<I_T, K_T> && is_row_major<K_T>)>
 void blas_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-    const auto K = etl::dim<0>(kernel); // The number of kernels
-    const auto C = etl::dim<1>(input);  // The number of channels
+    blas_conv4_valid_prepared(input, kernel, conv, s1, s2, p1, p2);
+}
 
-    const auto m1 = etl::dim<2>(kernel);
-    const auto m2 = etl::dim<3>(kernel);
+/*!
+ * \brief Compute a 4D valid convolution using a BLAS matrix multiplication kernel
+ *
+ * The kernels are first converted to the type of the input and to row
+ * major storage.
+ *
+ * \param input The input matrix
+ * \param kernel The kernel matrix, with flipped kernels
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_disable_iff(all_homogeneous<I_T, K_T> && is_row_major<K_T>)>
+void blas_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    const auto K = etl::dim<0>(kernel); // The number of kernels
+    const auto C = etl::dim<1>(kernel); // The number of channels
 
-    etl::dyn_matrix<value_t<I_T>, 4> kernels(C, K, m1, m2);
+    etl::dyn_matrix<value_t<I_T>, 4> prepared_k(K, C, etl::dim<2>(kernel), etl::dim<3>(kernel));
 
-    for(size_t c = 0; c < C; ++c){
-        for(size_t k = 0; k < K; ++k){
-            kernels(c)(k) = kernel(k)(c);
+    for (size_t k = 0; k < K; ++k) {
+        for (size_t c = 0; c < C; ++c) {
+            prepared_k(k)(c) = kernel(k)(c);
         }
     }
 
-    blas_conv4_valid_prepared(input, kernel, kernels, conv, s1, s2, p1, p2);
+    blas_conv4_valid_prepared(input, prepared_k, conv, s1, s2, p1, p2);
 }
 
 /*!
@@ -1359,16 +1160,9 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
     const auto f1 = etl::dim<2>(conv);
     const auto f2 = etl::dim<3>(conv);
 
-    const auto i1 = etl::dim<2>(input);
-    const auto i2 = etl::dim<3>(input);
-
     const auto k1 = etl::dim<2>(kernel);
     const auto k2 = etl::dim<3>(kernel);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     input.ensure_cpu_up_to_date();
     kernel.ensure_cpu_up_to_date();
 
@@ -1377,66 +1171,21 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
 
     auto batch_fun_c = [&](const size_t first, const size_t last) {
         for (size_t c = first; c < last; ++c) {
-            etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+            // Only the strided output positions are generated by im2col
+            etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
             for (size_t i = 0; i < I; ++i) {
-                // Optimize for the most common case
-                if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
-                    im2col_direct_tr(input_col, input(i)(c), k1, k2);
-                    cblas_gemm(
-                        CblasRowMajor,
-                        CblasNoTrans, CblasNoTrans,
-                        K, c1 * c2, k1 * k2,
-                        T(1.0),
-                        kernel(i).memory_start(), k1 * k2,
-                        input_col.memory_start(), c1 * c2,
-                        T(1.0),
-                        conv_temp(c).memory_start(), f1 * f2);
-                } else {
-                    if (p1 || p2) {
-                        etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-                        input_padded = T(0);
-
-                        impl::common::pad_2d_input(input(i)(c), input_padded, p1, p2);
-
-                        im2col_direct_tr(input_col, input_padded, k1, k2);
-                    } else {
-                        im2col_direct_tr(input_col, input(i)(c), k1, k2);
-                    }
-
-                    if (s1 > 1 || s2 > 1) {
-                        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-                        cblas_gemm(
-                            CblasRowMajor,
-                            CblasNoTrans, CblasNoTrans,
-                            K, c1 * c2, k1 * k2,
-                            T(1.0),
-                            kernel(i).memory_start(), k1 * k2,
-                            input_col.memory_start(), c1 * c2,
-                            T(0.0),
-                            tmp_result.memory_start(), c1 * c2);
-
-                        // Strided copy of the large result into the small result
-                        for (size_t k = 0; k < K; ++k) {
-                            for (size_t ii = 0; ii < f1; ++ii) {
-                                for (size_t j = 0; j < f2; ++j) {
-                                    conv_temp(c, k, ii, j) += tmp_result(k, ii * s1, j * s2);
-                                }
-                            }
-                        }
-                    } else {
-                        cblas_gemm(
-                            CblasRowMajor,
-                            CblasNoTrans, CblasNoTrans,
-                            K, c1 * c2, k1 * k2,
-                            T(1.0),
-                            kernel(i).memory_start(), k1 * k2,
-                            input_col.memory_start(), c1 * c2,
-                            T(1.0),
-                            conv_temp(c).memory_start(), f1 * f2);
-                    }
-                }
+                im2col_direct_tr(input_col, input(i)(c), k1, k2, s1, s2, p1, p2);
+
+                cblas_gemm(
+                    CblasRowMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    K, f1 * f2, k1 * k2,
+                    T(1.0),
+                    kernel(i).memory_start(), k1 * k2,
+                    input_col.memory_start(), f1 * f2,
+                    T(1.0),
+                    conv_temp(c).memory_start(), f1 * f2);
             }
         }
 
@@ -1505,16 +1254,10 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
     const auto C = etl::dim<1>(kernel);
     const auto K = etl::dim<1>(input);
 
-    const size_t i1 = etl::dim<2>(input);
-    const size_t i2 = etl::dim<3>(input);
     const size_t k1 = etl::dim<2>(kernel);
     const size_t k2 = etl::dim<3>(kernel);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
 
@@ -1523,79 +1266,25 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
 
     auto batch_fun_n = [&](const size_t first, const size_t last) {
         if (last - first) {
-            etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
-
-            // Optimize for the most common case
-            if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
-                for (size_t i = first; i < last; ++i) {
-                    for (size_t k = 0; k < K; ++k) {
-                        // use im2col on input(i)(k)
-
-                        im2col_direct_tr(input_col, input(i)(k), k1, k2);
-
-                        // conv(i) = kernel(k) * input_col
-                        cblas_gemm(
-                            CblasRowMajor,
-                            CblasNoTrans, CblasNoTrans,
-                            C, c1 * c2, k1 * k2,
-                            T(1.0),
-                            kernel(k).memory_start(), k1 * k2,
-                            input_col.memory_start(), c1 * c2,
-                            T(1.0),
-                            conv(i).memory_start(), f1 * f2);
-                    }
-                }
-            } else {
-                etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-                etl::dyn_matrix<T, 3> tmp_result(C, c1, c2);
-
-                for (size_t i = first; i < last; ++i) {
-                    for (size_t k = 0; k < K; ++k) {
-                        // use im2col on input(i)(k)
-
-                        if (p1 || p2) {
-                            input_padded = T(0);
-
-                            impl::common::pad_2d_input(input(i)(k), input_padded, p1, p2);
-
-                            im2col_direct_tr(input_col, input_padded, k1, k2);
-                        } else {
-                            im2col_direct_tr(input_col, input(i)(k), k1, k2);
-                        }
-
-                        if (s1 > 1 || s2 > 1) {
-                            // tmp_result = kernel(k) * input_col
-                            cblas_gemm(
-                                CblasRowMajor,
-                                CblasNoTrans, CblasNoTrans,
-                                C, c1 * c2, k1 * k2,
-                                T(1.0),
-                                kernel(k).memory_start(), k1 * k2,
-                                input_col.memory_start(), c1 * c2,
-                                T(0.0),
-                                tmp_result.memory_start(), c1 * c2);
-
-                            // Strided copy of the large result into the small result
-                            for (size_t c = 0; c < C; ++c) {
-                                for (size_t m = 0; m < f1; ++m) {
-                                    for (size_t n = 0; n < f2; ++n) {
-                                        conv(i, c, m, n) += tmp_result(c, m * s1, n * s2);
-                                    }
-                                }
-                            }
-                        } else {
-                            // conv(i) = kernel(k) * input_col
-                            cblas_gemm(
-                                CblasRowMajor,
-                                CblasNoTrans, CblasNoTrans,
-                                C, c1 * c2, k1 * k2,
-                                T(1.0),
-                                kernel(k).memory_start(), k1 * k2,
-                                input_col.memory_start(), c1 * c2,
-                                T(1.0),
-                                conv(i).memory_start(), f1 * f2);
-                        }
-                    }
+            // Only the strided output positions are generated by im2col
+            etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
+
+            for (size_t i = first; i < last; ++i) {
+                for (size_t k = 0; k < K; ++k) {
+                    // use im2col on input(i)(k)
+
+                    im2col_direct_tr(input_col, input(i)(k), k1, k2, s1, s2, p1, p2);
+
+                    // conv(i) = kernel(k) * input_col
+                    cblas_gemm(
+                        CblasRowMajor,
+                        CblasNoTrans, CblasNoTrans,
+                        C, f1 * f2, k1 * k2,
+                        T(1.0),
+                        kernel(k).memory_start(), k1 * k2,
+                        input_col.memory_start(), f1 * f2,
+                        T(1.0),
+                        conv(i).memory_start(), f1 * f2);
                 }
             }
         }
@@ -32,12 +32,14 @@ struct conv4_valid_impl {
             impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
         } else {
 #endif
-            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<1>(input), etl::dim<0>(kernel), etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), S1, S2);
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
                 impl::vec::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_valid(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
                 impl::blas::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::VEC) {
@@ -71,12 +73,14 @@ struct conv4_valid_flipped_impl {
             impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
         } else {
 #endif
-            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<1>(input), etl::dim<0>(kernel), etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), S1, S2);
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
                 impl::vec::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
                 impl::blas::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::VEC) {
@@ -109,12 +113,14 @@ struct dyn_conv4_valid_impl {
             impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
         } else {
 #endif
-            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<1>(input), etl::dim<0>(kernel), etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), s1, s2);
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
                 impl::vec::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
                 impl::blas::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::VEC) {
@@ -147,12 +153,14 @@ struct dyn_conv4_valid_flipped_impl {
             impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
         } else {
 #endif
-            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<1>(input), etl::dim<0>(kernel), etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), s1, s2);
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
                 impl::vec::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
                 impl::blas::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::VEC) {
@@ -295,10 +303,12 @@ struct conv4_valid_back_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+        auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<1>(input), etl::dim<1>(kernel), etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), S1, S2);
 
         if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_back(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
+        } else if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::vec::winograd_conv4_valid_back(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
             impl::blas::blas_conv4_valid_back(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::VEC) {
@@ -324,10 +334,12 @@ struct conv4_valid_back_flipped_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+        auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<1>(input), etl::dim<1>(kernel), etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), S1, S2);
 
         if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_back_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
+        } else if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::vec::winograd_conv4_valid_back_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
             impl::blas::blas_conv4_valid_back_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::VEC) {
@@ -352,10 +364,12 @@ struct dyn_conv4_valid_back_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-        auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+        auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<1>(input), etl::dim<1>(kernel), etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), s1, s2);
 
         if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_back(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::vec::winograd_conv4_valid_back(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
             impl::blas::blas_conv4_valid_back(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::VEC) {
@@ -380,10 +394,12 @@ struct dyn_conv4_valid_back_flipped_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-        auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+        auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<1>(input), etl::dim<1>(kernel), etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), s1, s2);
 
         if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_back_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::vec::winograd_conv4_valid_back_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
             impl::blas::blas_conv4_valid_back_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::VEC) {
@@ -419,6 +435,8 @@ struct conv4_full_impl {
                 impl::cudnn::conv4_backward_data_full(smart_forward_gpu(input), smart_forward_gpu(kernel), conv);
             } else if (impl == etl::conv4_impl::VEC) {
                 impl::vec::conv4_full(smart_forward(input), smart_forward(kernel), conv);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_full(smart_forward(input), smart_forward(kernel), conv);
             } else if (impl == etl::conv4_impl::FFT_STD) {
                 impl::standard::conv4_full_fft(smart_forward(input), smart_forward(kernel), conv);
             } else if (impl == etl::conv4_impl::FFT_MKL) {
@@ -459,6 +477,8 @@ struct conv4_full_flipped_impl {
                 impl::cudnn::conv4_backward_data_full_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv);
             } else if (impl == etl::conv4_impl::VEC) {
                 impl::vec::conv4_full_flipped(smart_forward(input), smart_forward(kernel), conv);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_full_flipped(smart_forward(input), smart_forward(kernel), conv);
             } else if (impl == etl::conv4_impl::FFT_STD) {
                 impl::standard::conv4_full_fft_flipped(smart_forward(input), smart_forward(kernel), conv);
             } else if (impl == etl::conv4_impl::FFT_MKL) {
@@ -27,7 +27,7 @@ namespace detail {
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t i1, size_t i2, size_t k1, size_t k2) {
+constexpr etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t ci, size_t co, size_t i1, size_t i2, size_t k1, size_t k2, size_t s1, size_t s2) {
     //Note: since the constexpr values will be known at compile time, the
     //conditions will be a lot simplified
 
@@ -49,7 +49,12 @@ constexpr etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t i1
         if(impl::vec::conv2_possible<vector_mode, I, K, C> && i1 == i2 && i1 > 100){
             return etl::conv4_impl::VEC;
         } else {
-            if (cblas_enabled) {
+            // Winograd is faster than im2col + GEMM, even with BLAS, once
+            // the transforms are amortized over enough channels. It is
+            // only implemented for unit strides.
+            if (impl::vec::winograd_possible<I, K, C> && k1 == 3 && s1 == 1 && s2 == 1 && std::min(ci, co) >= winograd_min_channels) {
+                return etl::conv4_impl::WINOGRAD;
+            } else if (cblas_enabled) {
                 return etl::conv4_impl::BLAS_MKL;
             } else if (impl::vec::conv2_possible<vector_mode, I, K, C>) {
                 return etl::conv4_impl::BLAS_VEC;
@@ -90,6 +95,10 @@ constexpr etl::conv4_impl select_default_conv4_valid_filter_impl(size_t i1, size
         return etl::conv4_impl::STD;
     }
 
+    // Note: WINOGRAD is not used for the filter gradients. The 3x3 kernel
+    // is the output of this convolution while its kernel is the large
+    // output gradient, to which the 3x3 minimal filtering does not apply.
+
     // Small kernels
     if(k1 == k2 && k1 <= 5){
         if(impl::vec::conv2_possible<vector_mode, I, K, C> && i1 == i2 && i1 > 100){
@@ -123,7 +132,7 @@ constexpr etl::conv4_impl select_default_conv4_valid_filter_impl(size_t i1, size
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_default_conv4_valid_back_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+constexpr etl::conv4_impl select_default_conv4_valid_back_impl(size_t ci, size_t co, size_t i1, size_t i2, size_t k1, size_t k2, size_t s1, size_t s2) {
     //Note: since the constexpr values will be known at compile time, the
     //conditions will be a lot simplified
 
@@ -143,7 +152,12 @@ constexpr etl::conv4_impl select_default_conv4_valid_back_impl(size_t i1, size_t
                 return etl::conv4_impl::VEC;
             }
         } else {
-            if (cblas_enabled) {
+            // Winograd is faster than im2col + GEMM, even with BLAS, once
+            // the transforms are amortized over enough channels. It is
+            // only implemented for unit strides.
+            if (impl::vec::winograd_possible<I, K, C> && k1 == 3 && s1 == 1 && s2 == 1 && std::min(ci, co) >= winograd_min_channels) {
+                return etl::conv4_impl::WINOGRAD;
+            } else if (cblas_enabled) {
                 return etl::conv4_impl::BLAS_MKL;
             } else if (impl::vec::conv2_possible<vector_mode, I, K, C>) {
                 return etl::conv4_impl::BLAS_VEC;
@@ -194,6 +208,11 @@ constexpr etl::conv4_impl select_default_conv4_full_impl(bool no_gpu, size_t k1,
         return etl::conv4_impl::FFT_CUFFT;
     }
 
+    // Winograd is much faster than the direct convolution for 3x3 kernels
+    if (impl::vec::winograd_possible<I, K, C> && k1 == 3 && k2 == 3) {
+        return etl::conv4_impl::WINOGRAD;
+    }
+
     // MKL is generally faster than VEC
     // This could be improved for small batch size where VEC is interesting
     if (impl::blas::conv2_possible<I, K, C>) {
@@ -223,7 +242,7 @@ constexpr etl::conv4_impl select_default_conv4_full_impl(bool no_gpu, size_t k1,
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+inline etl::conv4_impl select_conv4_valid_impl(size_t ci, size_t co, size_t i1, size_t i2, size_t k1, size_t k2, size_t s1, size_t s2) {
     if (local_context().conv4_selector.forced) {
         auto forced = local_context().conv4_selector.impl;
 
@@ -233,7 +252,7 @@ inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1,
         case etl::conv4_impl::VEC:
                 if (!impl::vec::conv2_possible<vector_mode, I, K, C>) {                                                                             // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to VEC conv4 implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2);                                                             // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, ci, co, i1, i2, k1, k2, s1, s2);                                                             // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                  // COVERAGE_EXCLUDE_LINE
 
                 return forced;
@@ -242,7 +261,7 @@ inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1,
         case etl::conv4_impl::BLAS_MKL:
                 if (!cblas_enabled) {                                                                                             // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to BLAS conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2);                                                               // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, ci, co, i1, i2, k1, k2, s1, s2);                                                               // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                    // COVERAGE_EXCLUDE_LINE
 
                 return forced;
@@ -251,17 +270,26 @@ inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1,
         case etl::conv4_impl::CUDNN:
                 if (!impl::cudnn::conv_possible<I, K, C> || local_context().cpu) {                                                                                             // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to CUDNN conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2);                                                               // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, ci, co, i1, i2, k1, k2, s1, s2);                                                               // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                    // COVERAGE_EXCLUDE_LINE
 
                 return forced;
 
+            //WINOGRAD cannot always be used
+            case etl::conv4_impl::WINOGRAD:
+                if (!impl::vec::winograd_possible<I, K, C>) {                                                                               // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to WINOGRAD conv4_valid implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, ci, co, i1, i2, k1, k2, s1, s2);                                                  // COVERAGE_EXCLUDE_LINE
+                }                                                                                                                     // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
             default:
                 return forced;
         }
     }
 
-    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2);
+    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, ci, co, i1, i2, k1, k2, s1, s2);
 }
 
 /*!
@@ -296,6 +324,11 @@ inline etl::conv4_impl select_conv4_valid_filter_impl(size_t i1, size_t i2, size
 
                 return forced;
 
+            //WINOGRAD is not implemented for the filter gradients
+        case etl::conv4_impl::WINOGRAD:
+                std::cerr << "Forced selection to WINOGRAD conv4_valid_filter implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
+                return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2);                                                     // COVERAGE_EXCLUDE_LINE
+
             default:
                 return forced;
         }
@@ -314,7 +347,7 @@ inline etl::conv4_impl select_conv4_valid_filter_impl(size_t i1, size_t i2, size
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv4_impl select_conv4_valid_back_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+inline etl::conv4_impl select_conv4_valid_back_impl(size_t ci, size_t co, size_t i1, size_t i2, size_t k1, size_t k2, size_t s1, size_t s2) {
     if (local_context().conv4_selector.forced) {
         auto forced = local_context().conv4_selector.impl;
 
@@ -324,7 +357,7 @@ inline etl::conv4_impl select_conv4_valid_back_impl(size_t i1, size_t i2, size_t
         case etl::conv4_impl::VEC:
                 if (!impl::vec::conv2_possible<vector_mode, I, K, C>) {                                                                             // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to VEC conv4_valid_back implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_back_impl<I, K, C>(i1, i2, k1, k2);                                                             // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_back_impl<I, K, C>(ci, co, i1, i2, k1, k2, s1, s2);                                                             // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                  // COVERAGE_EXCLUDE_LINE
 
                 return forced;
@@ -333,17 +366,26 @@ inline etl::conv4_impl select_conv4_valid_back_impl(size_t i1, size_t i2, size_t
         case etl::conv4_impl::BLAS_MKL:
                 if (!cblas_enabled) {                                                                                             // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to BLAS conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_back_impl<I, K, C>(i1, i2, k1, k2);                                                               // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_back_impl<I, K, C>(ci, co, i1, i2, k1, k2, s1, s2);                                                               // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                    // COVERAGE_EXCLUDE_LINE
 
                 return forced;
 
+            //WINOGRAD cannot always be used
+            case etl::conv4_impl::WINOGRAD:
+                if (!impl::vec::winograd_possible<I, K, C>) {                                                                               // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to WINOGRAD conv4_valid_back implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_back_impl<I, K, C>(ci, co, i1, i2, k1, k2, s1, s2);                                                  // COVERAGE_EXCLUDE_LINE
+                }                                                                                                                     // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
             default:
                 return forced;
         }
     }
 
-    return select_default_conv4_valid_back_impl<I, K, C>(i1, i2, k1, k2);
+    return select_default_conv4_valid_back_impl<I, K, C>(ci, co, i1, i2, k1, k2, s1, s2);
 }
 
 /*!
@@ -395,6 +437,15 @@ inline etl::conv4_impl select_conv4_full_impl(size_t k1, size_t k2) {
 
                 return forced;
 
+            //WINOGRAD cannot always be used
+            case etl::conv4_impl::WINOGRAD:
+                if (!impl::vec::winograd_possible<I, K, C>) {                                                                               // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to WINOGRAD conv4_full implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_full_impl<I, K, C>(local_context().cpu, k1, k2);                                                  // COVERAGE_EXCLUDE_LINE
+                }                                                                                                                     // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
             default:
                 return forced;
         }
@@ -416,8 +467,8 @@ inline etl::conv4_impl select_conv4_full_impl(size_t k1, size_t k2) {
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
-    return select_default_conv4_valid_impl<I, K, C>(false, i1, i2, k1, k2);
+constexpr etl::conv4_impl select_conv4_valid_impl(size_t ci, size_t co, size_t i1, size_t i2, size_t k1, size_t k2, size_t s1, size_t s2) {
+    return select_default_conv4_valid_impl<I, K, C>(false, ci, co, i1, i2, k1, k2, s1, s2);
 }
 
 /*!
@@ -446,8 +497,8 @@ constexpr etl::conv4_impl select_conv4_valid_filter_impl(size_t i1, size_t i2, s
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_conv4_valid_back_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
-    return select_default_conv4_valid_back_impl<I, K, C>(i1, i2, k1, k2);
+constexpr etl::conv4_impl select_conv4_valid_back_impl(size_t ci, size_t co, size_t i1, size_t i2, size_t k1, size_t k2, size_t s1, size_t s2) {
+    return select_default_conv4_valid_back_impl<I, K, C>(ci, co, i1, i2, k1, k2, s1, s2);
 }
 
 /*!
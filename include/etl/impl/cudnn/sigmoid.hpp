@@ -160,6 +160,17 @@ void relu_backward(O&& o, E&& e, C&& y) {
     backward_activation(o, e, y, CUDNN_ACTIVATION_RELU);
 }
 
+/*!
+ * \brief Compute the backward tanh of o/e and store the result in y
+ * \param o The a expression
+ * \param e The b expression
+ * \param y The c expression
+ */
+template <typename O, typename E, typename C>
+void tanh_backward(O&& o, E&& e, C&& y) {
+    backward_activation(o, e, y, CUDNN_ACTIVATION_TANH);
+}
+
 /*!
  * \brief Compute a softmax activation of x and store the result in y
  * \param x The a expression
@@ -271,6 +282,20 @@ void relu_backward(O&& o, E&& e, C&& y) {
     cpp_unreachable("CUDNN not available/enabled");
 }
 
+/*!
+ * \brief Compute the backward tanh of o/e and store the result in y
+ * \param o The a expression
+ * \param e The b expression
+ * \param y The c expression
+ */
+template <typename O, typename E, typename C>
+void tanh_backward(O&& o, E&& e, C&& y) {
+    cpp_unused(o);
+    cpp_unused(e);
+    cpp_unused(y);
+    cpp_unreachable("CUDNN not available/enabled");
+}
+
 /*!
  * \brief Compute the softmax of x (batch) and store the result in y
  * \param x The a expression
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "etl/impl/std/fft.hpp"
+#include "etl/impl/vec/fft.hpp"
 #include "etl/impl/blas/fft.hpp"
 #include "etl/impl/cufft/fft.hpp"
 
@@ -37,11 +38,14 @@ constexpr fft_impl select_default_fft1_impl(bool no_gpu) {
     //Note since these boolean will be known at compile time, the conditions will be a lot simplified
     constexpr bool mkl   = mkl_enabled;
     constexpr bool cufft = cufft_enabled;
+    constexpr bool vec   = vec_enabled && vectorize_impl;
 
     if (cufft && !no_gpu) {
         return fft_impl::CUFFT;
     } else if (mkl) {
         return fft_impl::MKL;
+    } else if (vec) {
+        return fft_impl::VEC;
     } else {
         return fft_impl::STD;
     }
@@ -60,6 +64,7 @@ constexpr fft_impl select_default_fft1_many_impl(bool no_gpu) {
     //Note since these boolean will be known at compile time, the conditions will be a lot simplified
     constexpr bool mkl   = mkl_enabled;
     constexpr bool cufft = cufft_enabled;
+    constexpr bool vec   = vec_enabled && vectorize_impl;
 
     //Note: more testing would probably improve this selection
 
@@ -67,6 +72,8 @@ constexpr fft_impl select_default_fft1_many_impl(bool no_gpu) {
         return fft_impl::CUFFT;
     } else if (mkl) {
         return fft_impl::MKL;
+    } else if (vec) {
+        return fft_impl::VEC;
     } else {
         return fft_impl::STD;
     }
@@ -84,11 +91,14 @@ constexpr fft_impl select_default_ifft1_impl(bool no_gpu) {
     //Note since these boolean will be known at compile time, the conditions will be a lot simplified
     constexpr bool mkl   = mkl_enabled;
     constexpr bool cufft = cufft_enabled;
+    constexpr bool vec   = vec_enabled && vectorize_impl;
 
     if (cufft && !no_gpu) {
         return fft_impl::CUFFT;
     } else if (mkl) {
         return fft_impl::MKL;
+    } else if (vec) {
+        return fft_impl::VEC;
     } else {
         return fft_impl::STD;
     }
@@ -107,11 +117,14 @@ constexpr fft_impl select_default_fft2_impl(bool no_gpu) {
     //Note since these boolean will be known at compile time, the conditions will be a lot simplified
     constexpr bool mkl   = mkl_enabled;
     constexpr bool cufft = cufft_enabled;
+    constexpr bool vec   = vec_enabled && vectorize_impl;
 
     if (cufft && !no_gpu) {
         return fft_impl::CUFFT;
     } else if (mkl) {
         return fft_impl::MKL;
+    } else if (vec) {
+        return fft_impl::VEC;
     } else {
         return fft_impl::STD;
     }
@@ -131,6 +144,7 @@ constexpr fft_impl select_default_fft2_many_impl(bool no_gpu) {
     //Note since these boolean will be known at compile time, the conditions will be a lot simplified
     constexpr bool mkl   = mkl_enabled;
     constexpr bool cufft = cufft_enabled;
+    constexpr bool vec   = vec_enabled && vectorize_impl;
 
     //Note: more testing would probably improve this selection
 
@@ -138,6 +152,8 @@ constexpr fft_impl select_default_fft2_many_impl(bool no_gpu) {
         return fft_impl::CUFFT;
     } else if (mkl) {
         return fft_impl::MKL;
+    } else if (vec) {
+        return fft_impl::VEC;
     } else {
         return fft_impl::STD;
     }
@@ -157,6 +173,7 @@ inline fft_impl select_forced_fft_impl(fft_impl def) {
     //Note since these boolean will be known at compile time, the conditions will be a lot simplified
     constexpr bool mkl   = mkl_enabled;
     constexpr bool cufft = cufft_enabled;
+    constexpr bool vec   = vec_enabled && vectorize_impl;
 
     if (local_context().fft_selector.forced) {
         auto forced = local_context().fft_selector.impl;
@@ -171,6 +188,15 @@ inline fft_impl select_forced_fft_impl(fft_impl def) {
 
                 return forced;
 
+            //VEC cannot always be used
+            case fft_impl::VEC:
+                if (!vec) {                                                                                                       //COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to VEC fft implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                    return def;                                                                                                   //COVERAGE_EXCLUDE_LINE
+                }                                                                                                                 //COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
             //CUFFT cannot always be used
             case fft_impl::CUFFT:
                 if (!cufft || local_context().cpu) {                                                                                //COVERAGE_EXCLUDE_LINE
@@ -313,6 +339,8 @@ struct fft1_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::fft1(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::fft1(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::fft1(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
@@ -343,6 +371,8 @@ struct ifft1_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::ifft1(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::ifft1(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::ifft1(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
@@ -373,6 +403,8 @@ struct ifft1_real_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::ifft1_real(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::ifft1_real(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::ifft1_real(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
@@ -381,6 +413,50 @@ struct ifft1_real_impl {
     }
 };
 
+/*!
+ * \brief Functor for 1D FFT of a real signal (half-spectrum)
+ */
+struct rfft1_impl {
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    template<typename A>
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        etl::impl::standard::rfft1(smart_forward(a), c);
+    }
+};
+
+/*!
+ * \brief Functor for 1D IFFT of a half-spectrum (real)
+ */
+struct irfft1_impl {
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    template<typename A>
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        etl::impl::standard::irfft1(smart_forward(a), c);
+    }
+};
+
 /*!
  * \brief Functor for 2D FFT
  */
@@ -403,6 +479,8 @@ struct fft2_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::fft2(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::fft2(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::fft2(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
@@ -433,6 +511,8 @@ struct ifft2_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::ifft2(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::ifft2(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::ifft2(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
@@ -463,6 +543,8 @@ struct ifft2_real_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::ifft2_real(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::ifft2_real(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::ifft2_real(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
@@ -493,6 +575,8 @@ struct fft1_many_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::fft1_many(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::fft1_many(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::fft1_many(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
@@ -523,6 +607,8 @@ struct fft2_many_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::fft2_many(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::fft2_many(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::fft2_many(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
@@ -553,6 +639,8 @@ struct ifft1_many_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::ifft1_many(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::ifft1_many(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::ifft1_many(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
@@ -583,6 +671,8 @@ struct ifft2_many_impl {
 
         if /*constexpr_select*/ (impl == fft_impl::STD) {
             etl::impl::standard::ifft2_many(smart_forward(a), c);
+        } else if /*constexpr_select*/ (impl == fft_impl::VEC) {
+            etl::impl::vec::ifft2_many(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::MKL) {
             etl::impl::blas::ifft2_many(smart_forward(a), c);
         } else if /*constexpr_select*/ (impl == fft_impl::CUFFT) {
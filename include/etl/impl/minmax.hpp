@@ -0,0 +1,133 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the "max_index" and "min_index" reductions.
+ *
+ * The selection reuses the selector of the "sum" reduction.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/minmax.hpp"
+#include "etl/impl/vec/minmax.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Select the minmax implementation for an expression of type E
+ *
+ * This does not consider the local context
+ *
+ * \tparam E The type of expression
+ * \return The implementation to use
+ */
+template <typename E>
+constexpr etl::sum_impl select_default_minmax_impl() {
+    if (vec_enabled && all_vectorizable<vector_mode, E> && is_floating<E>) {
+        return etl::sum_impl::VEC;
+    }
+
+    return etl::sum_impl::STD;
+}
+
+#ifdef ETL_MANUAL_SELECT
+
+/*!
+ * \brief Select the minmax implementation for an expression of type E
+ * \tparam E The type of expression
+ * \return The implementation to use
+ */
+template <typename E>
+etl::sum_impl select_minmax_impl() {
+    if (local_context().sum_selector.forced) {
+        auto forced = local_context().sum_selector.impl;
+
+        switch (forced) {
+            //VEC cannot always be used
+            case etl::sum_impl::VEC:
+                if (!vec_enabled || !all_vectorizable<vector_mode, E> || !is_floating<E>) {                                                        //COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to VEC minmax implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                    return select_default_minmax_impl<E>();                                                                          //COVERAGE_EXCLUDE_LINE
+                }                                                                                                                  //COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
+            //Only VEC and STD are available
+            case etl::sum_impl::STD:
+                return forced;
+
+            default:
+                return select_default_minmax_impl<E>();
+        }
+    }
+
+    return select_default_minmax_impl<E>();
+}
+
+#else
+
+/*!
+ * \brief Select the minmax implementation for an expression of type E
+ *
+ * This does not consider the local context
+ *
+ * \tparam E The type of expression
+ * \return The implementation to use
+ */
+template <typename E>
+constexpr etl::sum_impl select_minmax_impl() {
+    return select_default_minmax_impl<E>();
+}
+
+#endif
+
+/*!
+ * \brief Max index operation implementation
+ */
+struct max_index_impl {
+    /*!
+     * \brief Apply the functor to e
+     */
+    template <typename E>
+    static size_t apply(const E& e) {
+        constexpr_select const auto impl = select_minmax_impl<E>();
+
+        if /*constexpr_select*/ (impl == etl::sum_impl::VEC) {
+            return impl::vec::max_index(e);
+        } else {
+            return impl::standard::max_index(e);
+        }
+    }
+};
+
+/*!
+ * \brief Min index operation implementation
+ */
+struct min_index_impl {
+    /*!
+     * \brief Apply the functor to e
+     */
+    template <typename E>
+    static size_t apply(const E& e) {
+        constexpr_select const auto impl = select_minmax_impl<E>();
+
+        if /*constexpr_select*/ (impl == etl::sum_impl::VEC) {
+            return impl::vec::min_index(e);
+        } else {
+            return impl::standard::min_index(e);
+        }
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
@@ -14,6 +14,7 @@
 
 //Include the implementations
 #include "etl/impl/std/norm.hpp"
+#include "etl/impl/vec/norm.hpp"
 
 namespace etl {
 
@@ -30,7 +31,11 @@ struct norm_impl {
      */
     template <typename A>
     static value_t<A> apply(const A& a) {
-        return etl::impl::standard::norm(a);
+        if /*constexpr*/ (vec_enabled && all_vectorizable<vector_mode, A> && is_floating<A>) {
+            return etl::impl::vec::norm(a);
+        } else {
+            return etl::impl::standard::norm(a);
+        }
     }
 };
 
@@ -24,11 +24,26 @@ namespace standard {
  * \param b The rhs expression
  * \return the sum
  */
-template <typename A, typename B>
+template <typename A, typename B, cpp_disable_iff(runtime_dispatch && all_dma<A, B> && all_floating<A, B> && std::is_same<value_t<A>, value_t<B>>::value)>
 value_t<A> dot(const A& a, const B& b) {
     return sum(scale(a, b));
 }
 
+/*!
+ * \brief Compute the dot product of a and b with the runtime
+ * dispatched kernel
+ * \param a The lhs expression
+ * \param b The rhs expression
+ * \return the sum
+ */
+template <typename A, typename B, cpp_enable_iff(runtime_dispatch && all_dma<A, B> && all_floating<A, B> && std::is_same<value_t<A>, value_t<B>>::value)>
+value_t<A> dot(const A& a, const B& b) {
+    a.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    return etl::detail::dispatch_dot(a.memory_start(), b.memory_start(), etl::size(a));
+}
+
 } //end of namespace standard
 } //end of namespace impl
 } //end of namespace etl
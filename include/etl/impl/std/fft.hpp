@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 namespace etl {
 
 namespace impl {
@@ -24,6 +28,12 @@ namespace detail {
  */
 constexpr size_t MAX_FACTORS = 32;
 
+/*!
+ * \brief Limit on the number of FFT plans kept in the cache of
+ * each type
+ */
+constexpr size_t MAX_PLANS = 64;
+
 /*!
  * \brief Transform module for a FFT with 2 points
  * \param in The input vector
@@ -435,7 +445,7 @@ inline void fft_factorize(size_t n, size_t* factors, size_t& n_factors) {
  * \return an array containing all the twiddle factors
  */
 template <typename T>
-std::unique_ptr<etl::complex<T>[]> twiddle_compute(const size_t n, size_t* factors, size_t n_factors, etl::complex<T>** twiddle) {
+std::unique_ptr<etl::complex<T>[]> twiddle_compute(const size_t n, const size_t* factors, size_t n_factors, etl::complex<T>** twiddle) {
     std::unique_ptr<etl::complex<T>[]> trig = etl::allocate<etl::complex<T>>(n);
 
     const T d_theta = -2.0 * M_PI / (static_cast<T>(n));
@@ -467,28 +477,110 @@ std::unique_ptr<etl::complex<T>[]> twiddle_compute(const size_t n, size_t* facto
     return trig;
 }
 
+/*!
+ * \brief Precomputed data for the FFT of a given size.
+ *
+ * A plan holds the factorization of the size and the twiddle factors
+ * of the general FFT and, for even sizes, the n / 2 first twiddle
+ * factors, used by the radix-2 FFT and the real FFT. The inverse transforms are computed with the
+ * forward transform of the conjugate and therefore use the same plans.
+ */
+template <typename T>
+struct fft_plan {
+    size_t n;                            ///< The size of the transform
+    size_t factors[MAX_FACTORS];         ///< The factors of the size
+    size_t n_factors = 0;                ///< The number of factors
+    etl::complex<T>* twiddle[MAX_FACTORS]; ///< The twiddle factors of each factor (pointers inside trig)
+
+    std::unique_ptr<etl::complex<T>[]> trig;   ///< The twiddle factors of the general FFT
+    std::unique_ptr<etl::complex<T>[]> half;   ///< The twiddle factors exp(-2 i pi k / n) for k < n / 2 (even sizes)
+
+    /*!
+     * \brief Compute the plan of the FFT of size n
+     * \param size The size of the transform
+     */
+    explicit fft_plan(size_t size) : n(size) {
+        fft_factorize(n, factors, n_factors);
+
+        trig = twiddle_compute(n, factors, n_factors, twiddle);
+
+        if (n % 2 == 0) {
+            half = etl::allocate<etl::complex<T>>(n / 2);
+
+            const T d_theta = -2.0 * M_PI / (static_cast<T>(n));
+
+            for (size_t k = 0; k < n / 2; ++k) {
+                half[k] = etl::complex<T>{std::cos(d_theta * k), std::sin(d_theta * k)};
+            }
+        }
+    }
+};
+
+/*!
+ * \brief Returns the plan of the given type for a transform of size n.
+ *
+ * The plans are computed once and kept in a cache shared by all the
+ * threads. The returned plan remains valid even if it is evicted from
+ * the cache.
+ *
+ * \param n The size of the transform
+ * \tparam Plan The type of plan, constructible from the size
+ * \return the plan for a transform of size n
+ */
+template <typename Plan>
+std::shared_ptr<const Plan> get_cached_plan(size_t n) {
+    static std::mutex lock;
+    static std::unordered_map<size_t, std::shared_ptr<const Plan>> plans;
+
+    std::lock_guard<std::mutex> l(lock);
+
+    auto it = plans.find(n);
+
+    if (it != plans.end()) {
+        return it->second;
+    }
+
+    if (plans.size() >= MAX_PLANS) {
+        plans.clear();
+    }
+
+    auto plan = std::make_shared<const Plan>(n);
+    plans[n]  = plan;
+    return plan;
+}
+
+/*!
+ * \brief Returns the plan of the FFT of size n.
+ * \param n The size of the transform
+ * \return the plan of the FFT of size n
+ */
+template <typename T>
+std::shared_ptr<const fft_plan<T>> get_fft_plan(size_t n) {
+    return get_cached_plan<fft_plan<T>>(n);
+}
+
 /*!
  * \brief Perform the FFT
  * \param r_in The input
  * \param r_out The output
- * \param n The size of the transform
- * \param factors The factors
- * \param n_factors The number of factors
- * \param twiddle The output twiddle factors (pointers inside the main twiddle factors array)
+ * \param plan The plan of the transform
+ * \param tmp A temporary buffer of the size of the transform
  */
 template <typename In, typename T>
-void fft_perform(const In* r_in, etl::complex<T>* r_out, const size_t n, size_t* factors, size_t n_factors, etl::complex<T>** twiddle) {
-    auto tmp = etl::allocate<etl::complex<T>>(n);
+void fft_perform(const In* r_in, etl::complex<T>* r_out, const fft_plan<T>& plan, etl::complex<T>* tmp) {
+    const size_t n = plan.n;
 
-    std::copy_n(r_in, n, tmp.get());
+    std::copy_n(r_in, n, tmp);
 
-    auto* in  = tmp.get();
+    auto* in  = tmp;
     auto* out = r_out;
 
     size_t product = 1;
 
-    for (size_t i = 0; i < n_factors; i++) {
-        size_t factor = factors[i];
+    for (size_t i = 0; i < plan.n_factors; i++) {
+        size_t factor = plan.factors[i];
+
+        const etl::complex<T>* twiddle = plan.twiddle[i];
 
         if (i > 0) {
             std::swap(in, out);
@@ -499,17 +591,17 @@ void fft_perform(const In* r_in, etl::complex<T>* r_out, const size_t n, size_t*
         size_t offset = n / product;
 
         if (factor == 2) {
-            fft_2_point(in, out, product, n, twiddle[i]);
+            fft_2_point(in, out, product, n, twiddle);
         } else if (factor == 3) {
-            fft_3_point(in, out, product, n, twiddle[i], twiddle[i] + offset);
+            fft_3_point(in, out, product, n, twiddle, twiddle + offset);
         } else if (factor == 4) {
-            fft_4_point(in, out, product, n, twiddle[i], twiddle[i] + offset, twiddle[i] + 2 * offset);
+            fft_4_point(in, out, product, n, twiddle, twiddle + offset, twiddle + 2 * offset);
         } else if (factor == 5) {
-            fft_5_point(in, out, product, n, twiddle[i], twiddle[i] + offset, twiddle[i] + 2 * offset, twiddle[i] + 3 * offset);
+            fft_5_point(in, out, product, n, twiddle, twiddle + offset, twiddle + 2 * offset, twiddle + 3 * offset);
         } else if (factor == 7) {
-            fft_7_point(in, out, product, n, twiddle[i], twiddle[i] + offset, twiddle[i] + 2 * offset, twiddle[i] + 3 * offset, twiddle[i] + 4 * offset, twiddle[i] + 5 * offset);
+            fft_7_point(in, out, product, n, twiddle, twiddle + offset, twiddle + 2 * offset, twiddle + 3 * offset, twiddle + 4 * offset, twiddle + 5 * offset);
         } else {
-            fft_n_point(in, out, factor, product, n, twiddle[i]);
+            fft_n_point(in, out, factor, product, n, twiddle);
         }
     }
 
@@ -526,22 +618,10 @@ void fft_perform(const In* r_in, etl::complex<T>* r_out, const size_t n, size_t*
  */
 template <typename In, typename T>
 void fft_n(const In* r_in, etl::complex<T>* r_out, const size_t n) {
-    //0. Factorize
-
-    size_t factors[MAX_FACTORS];
-    size_t n_factors = 0;
-
-    fft_factorize(n, factors, n_factors);
-
-    //1. Precompute twiddle factors (stored in trig)
-
-    etl::complex<T>* twiddle[MAX_FACTORS];
+    auto plan = get_fft_plan<T>(n);
+    auto tmp  = etl::allocate<etl::complex<T>>(n);
 
-    auto trig = twiddle_compute(n, factors, n_factors, twiddle);
-
-    //2. Perform the FFT itself
-
-    fft_perform(r_in, r_out, n, factors, n_factors, twiddle);
+    fft_perform(r_in, r_out, *plan, tmp.get());
 }
 
 /*!
@@ -555,54 +635,32 @@ template <typename In, typename T>
 void fft_n_many(const In* r_in, etl::complex<T>* r_out, const size_t batch, const size_t n) {
     const size_t distance = n; //in/out distance between samples
 
-    //0. Factorize
-
-    size_t factors[MAX_FACTORS];
-    size_t n_factors = 0;
-
-    fft_factorize(n, factors, n_factors);
-
-    //1. Precompute twiddle factors (stored in trig)
-
-    etl::complex<T>* twiddle[MAX_FACTORS];
-
-    auto trig = twiddle_compute(n, factors, n_factors, twiddle);
-
-    //2. Perform all the FFT itself
+    auto plan = get_fft_plan<T>(n);
 
     auto batch_fun_b = [&](const size_t first, const size_t last) {
+        auto tmp = etl::allocate<etl::complex<T>>(n);
+
         for (size_t b = first; b < last; ++b) {
-            fft_perform(r_in + b * distance, r_out + b * distance, n, factors, n_factors, twiddle);
+            fft_perform(r_in + b * distance, r_out + b * distance, *plan, tmp.get());
         }
     };
 
     engine_dispatch_1d(batch_fun_b, 0, batch, 8UL);
 }
 
-/*!
- * \brief Compute many general FFT of all the signals in input
- * \param input The input signal
- * \param batch The number of signals
- * \param n The size of the tranform
- */
-template <typename In>
-void safe_fft_n_many_inplace(In& input, const size_t batch, const size_t n) {
-    input.ensure_cpu_up_to_date();
-
-    fft_n_many(input.memory_start(), input.memory_start(), batch, n);
-
-    input.invalidate_gpu();
-}
-
 /*!
  * \brief Compute the inplace 1D FFT transform of the given input
  * , using radix-2 algorithm
  * \param x The input to be transformed inplace
  * \param N The size of the transform
+ * \param twiddle The N / 2 twiddle factors of the transform
  */
 template <typename T>
-void inplace_radix2_fft1(etl::complex<T>* x, size_t N) {
-    using complex_t = etl::complex<T>;
+void inplace_radix2_fft1(etl::complex<T>* x, size_t N, const etl::complex<T>* twiddle) {
+    //A single point is its own transform
+    if (N < 2) {
+        return;
+    }
 
     //Decimate
     for (size_t a = 0, b = 0; a < N; ++a) {
@@ -617,24 +675,19 @@ void inplace_radix2_fft1(etl::complex<T>* x, size_t N) {
         } while ((b & bit) == 0 && bit != 1);
     }
 
-    constexpr T pi = M_PIl;
-
-    const auto NN = size_t(1) << size_t(std::log2(N));
+    for (size_t m = 2; m <= N; m <<= 1) {
+        const size_t stride = N / m;
 
-    for (size_t s = 1; s <= std::log2(N); ++s) {
-        auto m = size_t(1) << s;
-        complex_t w(1.0, 0.0);
-        complex_t wm(std::cos(2 * -pi / m), std::sin(2 * -pi / m));
         for (size_t j = 0; j < m / 2; ++j) {
-            for (size_t k = j; k < NN; k += m) {
+            const auto w = twiddle[j * stride];
+
+            for (size_t k = j; k < N; k += m) {
                 auto t = w * x[k + m / 2];
 
-                complex_t u  = x[k];
+                auto u       = x[k];
                 x[k]         = u + t;
                 x[k + m / 2] = u - t;
             }
-
-            w *= wm;
         }
     }
 }
@@ -651,7 +704,8 @@ void fft1_kernel(const T1* a, size_t n, std::complex<T>* c) {
     if (n <= 131072 && math::is_power_of_two(n)) {
         std::copy_n(a, n, c);
 
-        detail::inplace_radix2_fft1(reinterpret_cast<etl::complex<T>*>(c), n);
+        auto plan = get_fft_plan<T>(n);
+        detail::inplace_radix2_fft1(reinterpret_cast<etl::complex<T>*>(c), n, plan->half.get());
     } else {
         detail::fft_n(a, reinterpret_cast<etl::complex<T>*>(c), n);
     }
@@ -675,7 +729,8 @@ void ifft1_kernel(const std::complex<T>* a, size_t n, std::complex<T>* c) {
         }
 
         // Forward FFT
-        detail::inplace_radix2_fft1(reinterpret_cast<etl::complex<T>*>(c), n);
+        auto plan = get_fft_plan<T>(n);
+        detail::inplace_radix2_fft1(reinterpret_cast<etl::complex<T>*>(c), n, plan->half.get());
     } else {
         auto a_complex = allocate<complex_t>(n);
         auto x         = a_complex.get();
@@ -700,6 +755,227 @@ void ifft1_kernel(const std::complex<T>* a, size_t n, std::complex<T>* c) {
     }
 }
 
+/*!
+ * \brief Compute the FFT of each column of batch row-major n1 x n2
+ * matrices, in place.
+ *
+ * The columns are processed in strips of fft2_strip_width columns. Each
+ * strip is gathered in a small contiguous buffer, transformed column
+ * after column and scattered back, so that the full matrices never need
+ * to be transposed.
+ *
+ * \param x The matrices
+ * \param batch The number of matrices
+ * \param n1 The number of rows of each matrix
+ * \param n2 The number of columns of each matrix
+ */
+template <typename T>
+void fft_columns_inplace(etl::complex<T>* x, size_t batch, size_t n1, size_t n2) {
+    if (n1 < 2) {
+        return;
+    }
+
+    auto plan = get_fft_plan<T>(n1);
+
+    const bool radix2   = n1 <= 131072 && math::is_power_of_two(n1);
+    const size_t strips = (n2 + fft2_strip_width - 1) / fft2_strip_width;
+
+    auto strip_fun = [&](const size_t first, const size_t last) {
+        auto strip_buffer = etl::allocate<etl::complex<T>>(n1 * fft2_strip_width);
+        auto tmp_buffer   = etl::allocate<etl::complex<T>>(n1);
+
+        auto* strip = strip_buffer.get();
+
+        for (size_t t = first; t < last; ++t) {
+            auto* xx = x + (t / strips) * n1 * n2;
+
+            const size_t c0 = (t % strips) * fft2_strip_width;
+            const size_t w  = std::min(fft2_strip_width, n2 - c0);
+
+            for (size_t i = 0; i < n1; ++i) {
+                for (size_t j = 0; j < w; ++j) {
+                    strip[j * n1 + i] = xx[i * n2 + c0 + j];
+                }
+            }
+
+            for (size_t j = 0; j < w; ++j) {
+                if (radix2) {
+                    inplace_radix2_fft1(strip + j * n1, n1, plan->half.get());
+                } else {
+                    fft_perform(strip + j * n1, strip + j * n1, *plan, tmp_buffer.get());
+                }
+            }
+
+            for (size_t i = 0; i < n1; ++i) {
+                for (size_t j = 0; j < w; ++j) {
+                    xx[i * n2 + c0 + j] = strip[j * n1 + i];
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d(strip_fun, 0, batch * strips, engine_select_parallel(batch * n1 * n2, fft2_many_threshold_n) && batch * strips > 1);
+}
+
+/*!
+ * \brief Compute the 2D FFT of batch row-major n1 x n2 matrices, in place.
+ *
+ * The rows are transformed first and then the columns, by strips, without
+ * transposing the matrices.
+ *
+ * \param x The matrices
+ * \param batch The number of matrices
+ * \param n1 The number of rows of each matrix
+ * \param n2 The number of columns of each matrix
+ */
+template <typename T>
+void fft2_inplace(etl::complex<T>* x, size_t batch, size_t n1, size_t n2) {
+    const size_t rows = batch * n1;
+
+    if (n2 <= 131072 && math::is_power_of_two(n2)) {
+        auto plan = get_fft_plan<T>(n2);
+
+        auto batch_fun_b = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                inplace_radix2_fft1(x + i * n2, n2, plan->half.get());
+            }
+        };
+
+        engine_dispatch_1d(batch_fun_b, 0, rows, 8UL);
+    } else {
+        fft_n_many(x, x, rows, n2);
+    }
+
+    fft_columns_inplace(x, batch, n1, n2);
+}
+
+/*!
+ * \brief Compute the 2D FFT of the given matrix, in place
+ * \param input The matrix
+ * \param n1 The number of rows of the matrix
+ * \param n2 The number of columns of the matrix
+ */
+template <typename In>
+void safe_fft2_inplace(In& input, const size_t n1, const size_t n2) {
+    input.ensure_cpu_up_to_date();
+
+    fft2_inplace(input.memory_start(), 1, n1, n2);
+
+    input.invalidate_gpu();
+}
+
+/*!
+ * \brief Kernel for the 1D FFT of a real signal.
+ *
+ * Only the n / 2 + 1 first coefficients of the Hermitian spectrum are
+ * computed. For even sizes, the even and odd samples are packed as one
+ * complex signal of size n / 2 whose transform is then split back.
+ *
+ * \param a The input signal
+ * \param n The size of the tranform
+ * \param c The output half-spectrum
+ */
+template <typename T>
+void rfft1_kernel(const T* a, size_t n, std::complex<T>* c) {
+    using complex_t = std::complex<T>;
+
+    if (n % 2 == 1) {
+        auto full = allocate<complex_t>(n);
+
+        std::copy_n(a, n, full.get());
+
+        fft1_kernel(full.get(), n, full.get());
+
+        std::copy_n(full.get(), n / 2 + 1, c);
+
+        return;
+    }
+
+    const size_t h = n / 2;
+
+    auto z_buffer = allocate<complex_t>(h);
+    auto z        = z_buffer.get();
+
+    for (size_t k = 0; k < h; ++k) {
+        z[k] = complex_t(a[2 * k], a[2 * k + 1]);
+    }
+
+    fft1_kernel(z, h, z);
+
+    auto plan           = get_fft_plan<T>(n);
+    const auto* twiddle = reinterpret_cast<const complex_t*>(plan->half.get());
+
+    for (size_t k = 0; k <= h; ++k) {
+        const complex_t zk = z[k % h];
+        const complex_t zc = std::conj(z[(h - k) % h]);
+
+        const complex_t even = (zk + zc) * T(0.5);
+        const complex_t odd  = (zk - zc) * complex_t(T(0), T(-0.5));
+
+        c[k] = even + (k < h ? twiddle[k] : complex_t(T(-1), T(0))) * odd;
+    }
+}
+
+/*!
+ * \brief Kernel for the 1D inverse FFT of a Hermitian spectrum.
+ *
+ * The input is the n / 2 + 1 first coefficients of the spectrum of a
+ * real signal of size n, as computed by rfft1_kernel.
+ *
+ * \param a The input half-spectrum
+ * \param n The size of the tranform
+ * \param c The output real signal
+ */
+template <typename T>
+void irfft1_kernel(const std::complex<T>* a, size_t n, T* c) {
+    using complex_t = std::complex<T>;
+
+    if (n % 2 == 1) {
+        auto full_buffer = allocate<complex_t>(n);
+        auto full        = full_buffer.get();
+
+        full[0] = a[0];
+
+        for (size_t k = 1; k <= n / 2; ++k) {
+            full[k]     = a[k];
+            full[n - k] = std::conj(a[k]);
+        }
+
+        ifft1_kernel(full, n, full);
+
+        for (size_t i = 0; i < n; ++i) {
+            c[i] = full[i].real();
+        }
+
+        return;
+    }
+
+    const size_t h = n / 2;
+
+    auto plan           = get_fft_plan<T>(n);
+    const auto* twiddle = reinterpret_cast<const complex_t*>(plan->half.get());
+
+    auto z_buffer = allocate<complex_t>(h);
+    auto z        = z_buffer.get();
+
+    for (size_t k = 0; k < h; ++k) {
+        const complex_t xk = a[k];
+        const complex_t xc = std::conj(a[h - k]);
+
+        const complex_t even = (xk + xc) * T(0.5);
+        const complex_t odd  = (xk - xc) * T(0.5) * std::conj(twiddle[k]);
+
+        z[k] = even + complex_t(T(0), T(1)) * odd;
+    }
+
+    ifft1_kernel(z, h, z);
+
+    for (size_t k = 0; k < h; ++k) {
+        c[2 * k]     = z[k].real();
+        c[2 * k + 1] = z[k].imag();
+    }
+}
+
 /*!
  * \brief Performs a 1D full convolution using FFT
  * \param a The input
@@ -711,31 +987,65 @@ void ifft1_kernel(const std::complex<T>* a, size_t n, std::complex<T>* c) {
 template<typename T>
 void conv1_full_kernel(const T* a, size_t m, const T* b, size_t n, T* c){
     const size_t size = m + n - 1;
+    const size_t half = size / 2 + 1;
+
+    auto padded   = allocate<T>(size);
+    auto a_buffer = allocate<std::complex<T>>(half);
+    auto b_buffer = allocate<std::complex<T>>(half);
+
+    auto a_fft = a_buffer.get();
+    auto b_fft = b_buffer.get();
 
-    dyn_matrix<etl::complex<T>, 1> a_padded(size);
-    dyn_matrix<etl::complex<T>, 1> b_padded(size);
+    std::fill_n(padded.get(), size, T(0));
+    direct_copy(a, a + m, padded.get());
 
-    direct_copy(a, a + m, a_padded.memory_start());
-    direct_copy(b, b + n, b_padded.memory_start());
+    rfft1_kernel(padded.get(), size, a_fft);
 
-    detail::fft1_kernel(reinterpret_cast<std::complex<T>*>(a_padded.memory_start()), size, reinterpret_cast<std::complex<T>*>(a_padded.memory_start()));
-    detail::fft1_kernel(reinterpret_cast<std::complex<T>*>(b_padded.memory_start()), size, reinterpret_cast<std::complex<T>*>(b_padded.memory_start()));
+    std::fill_n(padded.get(), size, T(0));
+    direct_copy(b, b + n, padded.get());
 
-    a_padded.validate_cpu();
-    a_padded.invalidate_gpu();
+    rfft1_kernel(padded.get(), size, b_fft);
+
+    for (size_t i = 0; i < half; ++i) {
+        a_fft[i] *= b_fft[i];
+    }
+
+    irfft1_kernel(a_fft, size, c);
+}
 
-    b_padded.validate_cpu();
-    b_padded.invalidate_gpu();
+/*!
+ * \brief Computes the 2D FFT of a real matrix, zero-padded to s1 x s2.
+ *
+ * Only the s2 / 2 + 1 first columns of the spectrum are computed.
+ *
+ * \param a The input
+ * \param m1 The first dimension of the input
+ * \param m2 The second dimension of the input
+ * \param s1 The first dimension of the transform
+ * \param s2 The second dimension of the transform
+ * \param out The output (s1 x (s2 / 2 + 1))
+ */
+template <typename T1, typename T>
+void rfft2_padded(const T1* a, size_t m1, size_t m2, size_t s1, size_t s2, std::complex<T>* out) {
+    const size_t h2 = s2 / 2 + 1;
 
-    a_padded *= b_padded;
+    auto row_buffer = allocate<T>(s2);
+    auto row        = row_buffer.get();
 
-    a_padded.ensure_cpu_up_to_date();
+    // FFT of the rows, the padding rows have a zero transform
 
-    detail::ifft1_kernel(reinterpret_cast<std::complex<T>*>(a_padded.memory_start()), size, reinterpret_cast<std::complex<T>*>(a_padded.memory_start()));
+    for (size_t i = 0; i < m1; ++i) {
+        std::fill_n(row, s2, T(0));
+        direct_copy_n(a + i * m2, row, m2);
 
-    for (size_t i = 0; i < size; ++i) {
-        c[i] = a_padded[i].real;
+        rfft1_kernel(row, s2, out + i * h2);
     }
+
+    std::fill_n(out + m1 * h2, (s1 - m1) * h2, std::complex<T>(T(0), T(0)));
+
+    // FFT of the columns
+
+    fft_columns_inplace(reinterpret_cast<etl::complex<T>*>(out), 1, s1, h2);
 }
 
 /*!
@@ -751,72 +1061,54 @@ void conv1_full_kernel(const T* a, size_t m, const T* b, size_t n, T* c){
  */
 template<typename T1, typename T2, typename T3>
 void conv2_full_kernel(const T1* a, size_t m1, size_t m2, const T2* b, size_t n1, size_t n2, T3* c, T3 beta){
+    using complex_t = std::complex<T3>;
+
     CPU_SECTION {
         const size_t s1 = m1 + n1 - 1;
         const size_t s2 = m2 + n2 - 1;
-        const size_t n  = s1 * s2;
-
-        // 0. Pad a and b to the size of c
-
-        dyn_matrix<etl::complex<T1>, 2> a_padded(s1, s2);
-        dyn_matrix<etl::complex<T2>, 2> b_padded(s1, s2);
+        const size_t h2 = s2 / 2 + 1;
 
-        for (size_t i = 0; i < m1; ++i) {
-            direct_copy_n(a + i * m2, a_padded.memory_start() + i * s2, m2);
-        }
-
-        a_padded.validate_cpu();
-        a_padded.invalidate_gpu();
+        // 1. Real FFT of a and b, only the half-spectrum is kept
 
-        for (size_t i = 0; i < n1; ++i) {
-            direct_copy_n(b + i * n2, b_padded.memory_start() + i * s2, n2);
-        }
+        auto a_buffer = allocate<complex_t>(h2 * s1);
+        auto b_buffer = allocate<complex_t>(h2 * s1);
 
-        b_padded.validate_cpu();
-        b_padded.invalidate_gpu();
+        auto a_fft = a_buffer.get();
+        auto b_fft = b_buffer.get();
 
-        // 1. FFT of a and b
+        rfft2_padded(a, m1, m2, s1, s2, a_fft);
+        rfft2_padded(b, n1, n2, s1, s2, b_fft);
 
-        // a = fft2(a)
-        detail::safe_fft_n_many_inplace(a_padded, s1, s2);
-        a_padded.transpose_inplace();
-        detail::safe_fft_n_many_inplace(a_padded, s2, s1);
-        a_padded.transpose_inplace();
+        // 2. Elementwise multiplication of a and b
 
-        // b = fft2(b)
-        detail::safe_fft_n_many_inplace(b_padded, s1, s2);
-        b_padded.transpose_inplace();
-        detail::safe_fft_n_many_inplace(b_padded, s2, s1);
-        b_padded.transpose_inplace();
+        for (size_t i = 0; i < h2 * s1; ++i) {
+            a_fft[i] = std::conj(a_fft[i] * b_fft[i]);
+        }
 
-        // 2. Elementwise multiplication of and b
+        // 3. Inverse FFT of the columns, with the conjugate
 
-        a_padded >>= b_padded;
+        fft_columns_inplace(reinterpret_cast<etl::complex<T3>*>(a_fft), 1, s1, h2);
 
-        // 3. Inverse FFT of a
+        // 4. Inverse real FFT of the rows
 
-        // a = conj(a)
-        a_padded = conj(a_padded);
+        auto row_buffer = allocate<T3>(s2);
+        auto row        = row_buffer.get();
 
-        // a = fft2(a)
-        detail::safe_fft_n_many_inplace(a_padded, s1, s2);
-        a_padded.transpose_inplace();
-        detail::safe_fft_n_many_inplace(a_padded, s2, s1);
-        a_padded.transpose_inplace();
+        for (size_t i = 0; i < s1; ++i) {
+            auto* row_fft = a_fft + i * h2;
 
-        // 4. Keep only the real part of the inverse FFT
+            for (size_t k = 0; k < h2; ++k) {
+                row_fft[k] = std::conj(row_fft[k]) / T3(s1);
+            }
 
-        a_padded.ensure_cpu_up_to_date();
+            if (beta == T3(0.0)) {
+                irfft1_kernel(row_fft, s2, c + i * s2);
+            } else {
+                irfft1_kernel(row_fft, s2, row);
 
-        // c = real(conj(a) / n)
-        // Note: Since the conjugate does not change the real part, it is not necessary
-        if (beta == T3(0.0)) {
-            for (size_t i = 0; i < n; ++i) {
-                c[i] = a_padded[i].real / T3(n);
-            }
-        } else {
-            for (size_t i = 0; i < n; ++i) {
-                c[i] = beta * c[i] + a_padded[i].real / T3(n);
+                for (size_t j = 0; j < s2; ++j) {
+                    c[i * s2 + j] = beta * c[i * s2 + j] + row[j];
+                }
             }
         }
     }
@@ -854,6 +1146,38 @@ void ifft1(A&& a, C&& c) {
     c.invalidate_gpu();
 }
 
+/*!
+ * \brief Perform the 1D FFT of the real signal a and store the n / 2 + 1
+ * first coefficients of its spectrum in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void rfft1(A&& a, C&& c) {
+    a.ensure_cpu_up_to_date();
+
+    detail::rfft1_kernel(a.memory_start(), etl::size(a), c.memory_start());
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform the 1D Inverse FFT of the half-spectrum a and store
+ * the real signal in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void irfft1(A&& a, C&& c) {
+    a.ensure_cpu_up_to_date();
+
+    detail::irfft1_kernel(a.memory_start(), etl::size(c), c.memory_start());
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
 /*!
  * \brief Perform many 1D Inverse FFT on a and store the result in c
  * \param a The input expression
@@ -863,10 +1187,15 @@ void ifft1(A&& a, C&& c) {
  */
 template <typename A, typename C>
 void ifft1_many(A&& a, C&& c) {
+    static constexpr size_t N = etl::dimensions<A>();
+
     a.ensure_cpu_up_to_date();
 
-    for (size_t k = 0; k < etl::dim<0>(a); ++k) {
-        detail::ifft1_kernel(a(k).memory_start(), etl::dim<1>(a), c(k).memory_start());
+    auto n     = etl::dim<N - 1>(a); //Size of the transform
+    auto batch = etl::size(a) / n;   //Number of batch
+
+    for (size_t k = 0; k < batch; ++k) {
+        detail::ifft1_kernel(a.memory_start() + k * n, n, c.memory_start() + k * n);
     }
 
     c.validate_cpu();
@@ -916,9 +1245,11 @@ void fft1_many_kernel(const A* a, C* c, size_t batch, size_t n) {
             direct_copy(a, a + batch * n, c);
         }
 
+        auto plan = detail::get_fft_plan<typename C::value_type>(n);
+
         auto batch_fun_b = [&](const size_t first, const size_t last) {
             for (size_t i = first; i < last; ++i) {
-                detail::inplace_radix2_fft1(reinterpret_cast<etl::complex<typename C::value_type>*>(c + i * distance), n);
+                detail::inplace_radix2_fft1(reinterpret_cast<etl::complex<typename C::value_type>*>(c + i * distance), n, plan->half.get());
             }
         };
 
@@ -957,20 +1288,18 @@ void fft1_many(A&& a, C&& c) {
  */
 template <typename A, typename C>
 void fft2(A&& a, C&& c) {
-    //Note: We need dyn here because of transposition inplace
-    auto w = etl::force_temporary_dyn(c);
-
-    //Perform FFT on each rows
-    fft1_many(a, w);
+    using T = typename value_t<C>::value_type;
 
-    w.transpose_inplace();
+    a.ensure_cpu_up_to_date();
 
-    //Perform FFT on each columns
-    fft1_many(w, w);
+    if (reinterpret_cast<const void*>(a.memory_start()) != reinterpret_cast<const void*>(c.memory_start())) {
+        std::copy(a.memory_start(), a.memory_end(), c.memory_start());
+    }
 
-    w.transpose_inplace();
+    detail::fft2_inplace(reinterpret_cast<etl::complex<T>*>(c.memory_start()), 1, etl::dim<0>(a), etl::dim<1>(a));
 
-    c = w;
+    c.validate_cpu();
+    c.invalidate_gpu();
 }
 
 /*!
@@ -1048,22 +1377,25 @@ void ifft2_real(A&& a, C&& c) {
  */
 template <typename A, typename C>
 void fft2_many(A&& a, C&& c) {
-    //Note: we need dyn matrix for inplace rectangular transpose
-    auto w = etl::force_temporary_dyn(c);
+    using T = typename value_t<C>::value_type;
+
+    static constexpr size_t D = etl::dimensions<A>();
 
-    fft1_many(a, w);
+    a.ensure_cpu_up_to_date();
 
-    w.deep_transpose_inplace();
+    if (reinterpret_cast<const void*>(a.memory_start()) != reinterpret_cast<const void*>(c.memory_start())) {
+        std::copy(a.memory_start(), a.memory_end(), c.memory_start());
+    }
 
-    fft1_many(w, w);
+    const size_t n1 = etl::dim<D - 2>(a);
+    const size_t n2 = etl::dim<D - 1>(a);
 
-    w.deep_transpose_inplace();
+    detail::fft2_inplace(reinterpret_cast<etl::complex<T>*>(c.memory_start()), etl::size(a) / (n1 * n2), n1, n2);
 
-    c = w;
+    c.validate_cpu();
+    c.invalidate_gpu();
 }
 
-//Note: CPP17 constexpr
-
 /*!
  * \brief Perform the 1D full convolution of a with b and store the result in c
  * \param a The input matrix
@@ -1190,10 +1522,7 @@ void conv2_full_multi_fft(const II& input, const KK& kernel, CC& conv) {
         a_padded.invalidate_gpu();
 
         // a = fft2(a)
-        detail::safe_fft_n_many_inplace(a_padded, s1, s2);
-        a_padded.transpose_inplace();
-        detail::safe_fft_n_many_inplace(a_padded, s2, s1);
-        a_padded.transpose_inplace();
+        detail::safe_fft2_inplace(a_padded, s1, s2);
 
         auto batch_fun_k = [&](const size_t first, const size_t last) {
             for (size_t k = first; k < last; ++k) {
@@ -1217,10 +1546,7 @@ void conv2_full_multi_fft(const II& input, const KK& kernel, CC& conv) {
                 // 1. FFT of a and b
 
                 // b = fft2(b)
-                detail::safe_fft_n_many_inplace(b_padded, s1, s2);
-                b_padded.transpose_inplace();
-                detail::safe_fft_n_many_inplace(b_padded, s2, s1);
-                b_padded.transpose_inplace();
+                detail::safe_fft2_inplace(b_padded, s1, s2);
 
                 // 2. Elementwise multiplication of and b
 
@@ -1232,10 +1558,7 @@ void conv2_full_multi_fft(const II& input, const KK& kernel, CC& conv) {
                 b_padded = conj(b_padded);
 
                 // a = fft2(a)
-                detail::safe_fft_n_many_inplace(b_padded, s1, s2);
-                b_padded.transpose_inplace();
-                detail::safe_fft_n_many_inplace(b_padded, s2, s1);
-                b_padded.transpose_inplace();
+                detail::safe_fft2_inplace(b_padded, s1, s2);
 
                 // 4. Keep only the real part of the inverse FFT
 
@@ -1341,10 +1664,7 @@ void conv4_full_fft(II&& input, KK&& kernel, CC&& conv) {
                     a_padded.invalidate_gpu();
 
                     // a = fft2(a)
-                    detail::safe_fft_n_many_inplace(a_padded, s1, s2);
-                    a_padded.transpose_inplace();
-                    detail::safe_fft_n_many_inplace(a_padded, s2, s1);
-                    a_padded.transpose_inplace();
+                    detail::safe_fft2_inplace(a_padded, s1, s2);
 
                     for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
                         const auto* b = kernel.memory_start() + k * kernel_k_inc + c * kernel_c_inc; //kernel(k)(c)
@@ -1365,10 +1685,7 @@ void conv4_full_fft(II&& input, KK&& kernel, CC&& conv) {
                         // 1. FFT of a and b
 
                         // b = fft2(b)
-                        detail::safe_fft_n_many_inplace(b_padded, s1, s2);
-                        b_padded.transpose_inplace();
-                        detail::safe_fft_n_many_inplace(b_padded, s2, s1);
-                        b_padded.transpose_inplace();
+                        detail::safe_fft2_inplace(b_padded, s1, s2);
 
                         // 2. Elementwise multiplication of and b
 
@@ -1382,10 +1699,7 @@ void conv4_full_fft(II&& input, KK&& kernel, CC&& conv) {
                         }
 
                         // a = fft2(a)
-                        detail::safe_fft_n_many_inplace(tmp, s1, s2);
-                        tmp.transpose_inplace();
-                        detail::safe_fft_n_many_inplace(tmp, s2, s1);
-                        tmp.transpose_inplace();
+                        detail::safe_fft2_inplace(tmp, s1, s2);
 
                         // 4. Keep only the real part of the inverse FFT
 
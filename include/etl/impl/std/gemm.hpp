@@ -19,7 +19,7 @@ namespace standard {
  * \param b The right input matrix
  * \param c The output matrix
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_disable_iff((runtime_dispatch && all_dma<A, B, C> && all_row_major<A, B, C> && all_floating<A, B, C> && all_homogeneous<A, B, C>) || is_sparse_matrix<A> || is_sparse_matrix<B>)>
 static void mm_mul(A&& a, B&& b, C&& c) {
     static constexpr bool row_major = decay_traits<A>::storage_order == order::RowMajor;
 
@@ -44,6 +44,23 @@ static void mm_mul(A&& a, B&& b, C&& c) {
     }
 }
 
+/*!
+ * \brief Implementation of a row-major matrix-matrix multiplication
+ * with the runtime dispatched kernel
+ * \param a The left input matrix
+ * \param b The right input matrix
+ * \param c The output matrix
+ */
+template <typename A, typename B, typename C, cpp_enable_iff(runtime_dispatch && all_dma<A, B, C> && all_row_major<A, B, C> && all_floating<A, B, C> && all_homogeneous<A, B, C>)>
+static void mm_mul(A&& a, B&& b, C&& c) {
+    a.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    etl::detail::dispatch_gemm_rr(a.memory_start(), b.memory_start(), c.memory_start(), rows(a), columns(b), columns(a));
+
+    c.invalidate_gpu();
+}
+
 /*!
  * \brief Performs the computation c = c + a * b
  * \param c The output
@@ -102,7 +119,7 @@ inline void add_mul(std::complex<T>& c, std::complex<T> a, std::complex<T> b) {
  * \param b The right input matrix
  * \param c The output matrix
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_disable_iff(is_sparse_matrix<B>)>
 static void vm_mul(A&& a, B&& b, C&& c) {
     static constexpr bool row_major = decay_traits<B>::storage_order == order::RowMajor;
 
@@ -131,7 +148,7 @@ static void vm_mul(A&& a, B&& b, C&& c) {
  * \param b The right vector matrix
  * \param c The output matrix
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_disable_iff(is_sparse_matrix<A>)>
 static void mv_mul(A&& a, B&& b, C&& c) {
     static constexpr bool row_major = decay_traits<A>::storage_order == order::RowMajor;
 
@@ -154,6 +171,101 @@ static void mv_mul(A&& a, B&& b, C&& c) {
     }
 }
 
+/*!
+ * \brief Implementation of a sparse matrix-vector multiplication.
+ *
+ * Only the non-zero elements of the matrix are visited and the rows
+ * are computed in parallel.
+ *
+ * \param a The left sparse matrix
+ * \param b The right vector
+ * \param c The output vector
+ */
+template <typename A, typename B, typename C, cpp_enable_iff(is_sparse_matrix<A>)>
+static void mv_mul(A&& a, B&& b, C&& c) {
+    c = 0;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        a.for_each_non_zero(first, last, [&](size_t i, size_t k, value_t<A> v) {
+            //optimized compound add of the multiplication
+            add_mul(c(i), v, b(k));
+        });
+    };
+
+    engine_dispatch_1d(batch_fun, 0, rows(a), engine_select_parallel(a.non_zeros(), parallel_threshold) && rows(a) > 1);
+}
+
+/*!
+ * \brief Implementation of a vector-sparse matrix multiplication.
+ *
+ * Only the non-zero elements of the matrix are visited.
+ *
+ * \param a The left vector
+ * \param b The right sparse matrix
+ * \param c The output vector
+ */
+template <typename A, typename B, typename C, cpp_enable_iff(is_sparse_matrix<B>)>
+static void vm_mul(A&& a, B&& b, C&& c) {
+    c = 0;
+
+    b.for_each_non_zero(0, rows(b), [&](size_t k, size_t j, value_t<B> v) {
+        //optimized compound add of the multiplication
+        add_mul(c(j), a(k), v);
+    });
+}
+
+/*!
+ * \brief Implementation of a sparse matrix-matrix multiplication.
+ *
+ * Each non-zero A(i,k) updates the row i of C with the row k of B. The
+ * rows of C are computed in parallel.
+ *
+ * \param a The left sparse matrix
+ * \param b The right input matrix
+ * \param c The output matrix
+ */
+template <typename A, typename B, typename C, cpp_enable_iff(is_sparse_matrix<A>)>
+static void mm_mul(A&& a, B&& b, C&& c) {
+    c = 0;
+
+    const size_t N = columns(b);
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        a.for_each_non_zero(first, last, [&](size_t i, size_t k, value_t<A> v) {
+            for (size_t j = 0; j < N; ++j) {
+                c(i, j) += v * b(k, j);
+            }
+        });
+    };
+
+    engine_dispatch_1d(batch_fun, 0, rows(a), engine_select_parallel(a.non_zeros() * N, parallel_threshold) && rows(a) > 1);
+}
+
+/*!
+ * \brief Implementation of a dense-sparse matrix-matrix multiplication.
+ *
+ * Each non-zero B(k,j) updates the column j of C with the column k of
+ * A. The rows of C are split between the threads.
+ *
+ * \param a The left input matrix
+ * \param b The right sparse matrix
+ * \param c The output matrix
+ */
+template <typename A, typename B, typename C, cpp_enable_iff(!is_sparse_matrix<A> && is_sparse_matrix<B>)>
+static void mm_mul(A&& a, B&& b, C&& c) {
+    c = 0;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        b.for_each_non_zero(0, rows(b), [&](size_t k, size_t j, value_t<B> v) {
+            for (size_t i = first; i < last; ++i) {
+                c(i, j) += a(i, k) * v;
+            }
+        });
+    };
+
+    engine_dispatch_1d(batch_fun, 0, rows(a), engine_select_parallel(b.non_zeros() * rows(a), parallel_threshold) && rows(a) > 1);
+}
+
 } //end of namespace standard
 
 } //end of namespace impl
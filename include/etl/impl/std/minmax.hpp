@@ -0,0 +1,87 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the "max_index" and "min_index" reductions
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Compute the index of the first extreme element of the input
+ *
+ * Each thread computes the best (value, index) pair of its range, the
+ * pairs are then merged in order so that the first index is kept in
+ * case of ties.
+ *
+ * \param input The input expression
+ * \param better The functor indicating if the first value is strictly better than the second
+ * \return the index of the first extreme element
+ */
+template <typename E, typename Better>
+size_t extremum_index(const E& input, Better better) {
+    using T     = value_t<E>;
+    using acc_t = std::pair<T, size_t>;
+
+    acc_t acc;
+    bool init = false;
+
+    auto acc_functor = [&](const acc_t& partial) {
+        if (!init || better(partial.first, acc.first)) {
+            acc  = partial;
+            init = true;
+        }
+    };
+
+    auto batch_fun = [&input, &better](size_t first, size_t last) {
+        acc_t partial(input[first], first);
+
+        for (size_t i = first + 1; i < last; ++i) {
+            if (better(input[i], partial.first)) {
+                partial.first  = input[i];
+                partial.second = i;
+            }
+        }
+
+        return partial;
+    };
+
+    engine_dispatch_1d_acc<acc_t>(batch_fun, acc_functor, 0, etl::size(input), sum_parallel_threshold);
+
+    return init ? acc.second : 0;
+}
+
+/*!
+ * \brief Compute the index of the first maximum element of the input
+ * \param input The input expression
+ * \return the index of the first maximum element
+ */
+template <typename E>
+size_t max_index(const E& input) {
+    return extremum_index(input, [](value_t<E> a, value_t<E> b) { return a > b; });
+}
+
+/*!
+ * \brief Compute the index of the first minimum element of the input
+ * \param input The input expression
+ * \return the index of the first minimum element
+ */
+template <typename E>
+size_t min_index(const E& input) {
+    return extremum_index(input, [](value_t<E> a, value_t<E> b) { return a < b; });
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
@@ -18,6 +18,33 @@ namespace impl {
 
 namespace standard {
 
+/*!
+ * \brief Compute the sum of a sub part of an expression, using
+ * the runtime dispatched kernel.
+ * \param sub The input expression
+ * \return the sum
+ */
+template <typename E, cpp_enable_iff(runtime_dispatch && is_dma<E> && is_floating<E>)>
+value_t<E> sum_kernel(const E& sub) {
+    return etl::detail::dispatch_sum(sub.memory_start(), etl::size(sub));
+}
+
+/*!
+ * \brief Compute the sum of a sub part of an expression
+ * \param sub The input expression
+ * \return the sum
+ */
+template <typename E, cpp_disable_iff(runtime_dispatch && is_dma<E> && is_floating<E>)>
+value_t<E> sum_kernel(const E& sub) {
+    value_t<E> acc(0);
+
+    for(size_t i = 0; i < etl::size(sub); ++i){
+        acc += sub[i];
+    }
+
+    return acc;
+}
+
 /*!
  * \brief Compute the sum of the input in the given expression
  * \param input The input expression
@@ -34,13 +61,7 @@ value_t<E> sum(const E& input) {
     };
 
     auto batch_fun = [](auto& sub){
-        T acc(0);
-
-        for(size_t i = 0; i < etl::size(sub); ++i){
-            acc += sub[i];
-        }
-
-        return acc;
+        return sum_kernel(sub);
     };
 
     engine_dispatch_1d_acc_slice(input, batch_fun, acc_functor, sum_parallel_threshold);
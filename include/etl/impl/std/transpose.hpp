@@ -44,12 +44,14 @@ void inplace_square_transpose(C&& c) {
     }
 }
 
+namespace detail {
+
 /*!
- * \brief Inplace transposition of the rectangular matrix c
+ * \brief Transpose the rectangular matrix mat through a temporary copy
  * \param mat The matrix to transpose
  */
 template <typename C>
-void inplace_rectangular_transpose(C&& mat) {
+void copy_rectangular_transpose(C&& mat) {
     static constexpr bool row_major = decay_traits<C>::storage_order == order::RowMajor;
 
     auto copy = force_temporary(mat);
@@ -90,6 +92,183 @@ void inplace_rectangular_transpose(C&& mat) {
     }
 }
 
+/*!
+ * \brief Transpose the row-major m x n matrix a inplace.
+ *
+ * The transposition permutation is decomposed into a rotation of the
+ * columns, a permutation inside each row and a permutation inside each
+ * column (Catanzaro et al., "A Decomposition for In-place Matrix
+ * Transposition"). Each row is shuffled through a buffer of n elements and
+ * the columns are shuffled by blocks of transpose_block_size columns, so
+ * that only O(max(m, n)) extra memory is necessary and the accesses remain
+ * contiguous inside the blocks. The column buffers are never wider than the
+ * matrix, so that narrow matrices do not need more than their size.
+ *
+ * \param a The matrix to transpose
+ * \param m The number of rows of a
+ * \param n The number of columns of a
+ */
+template <typename T>
+void inplace_rectangular_transpose_kernel(T* a, size_t m, size_t n) {
+    static constexpr size_t B = transpose_block_size;
+
+    // The width of the column buffers, smaller than B for narrow matrices
+    const size_t S = std::min(B, n);
+
+    size_t c = m;
+    for (size_t r = n; r;) {
+        c = std::exchange(r, c % r);
+    }
+
+    const size_t b      = n / c;
+    const size_t blocks = (n + B - 1) / B;
+
+    const bool parallel = engine_select_parallel(m * n, transpose_parallel_threshold);
+
+    // 1. Rotate the column j down by j / b
+
+    if (c > 1) {
+        auto rotate_fun = [&](const size_t first, const size_t last) {
+            auto buffer = etl::allocate<T>(m * S);
+
+            for (size_t block = first; block < last; ++block) {
+                const size_t j0   = block * B;
+                const size_t cols = std::min(B, n - j0);
+
+                if ((j0 + cols - 1) / b == 0) {
+                    continue;
+                }
+
+                for (size_t i = 0; i < m; ++i) {
+                    size_t k = j0 / b;
+                    size_t t = j0 % b;
+
+                    for (size_t j = 0; j < cols; ++j) {
+                        buffer[i * S + j] = a[(i >= k ? i - k : i + m - k) * n + j0 + j];
+
+                        if (++t == b) {
+                            t = 0;
+                            ++k;
+                        }
+                    }
+                }
+
+                for (size_t i = 0; i < m; ++i) {
+                    std::copy_n(buffer.get() + i * S, cols, a + i * n + j0);
+                }
+            }
+        };
+
+        engine_dispatch_1d(rotate_fun, 0, blocks, parallel && blocks > 1);
+    }
+
+    // 2. Shuffle each row
+
+    const size_t m_n = m % n;
+
+    auto row_fun = [&](const size_t first, const size_t last) {
+        auto buffer = etl::allocate<T>(n);
+
+        for (size_t i = first; i < last; ++i) {
+            for (size_t q = 0; q < c; ++q) {
+                const size_t src = i >= q ? i - q : i + m - q;
+
+                size_t s = (q * b * m + src) % n;
+
+                for (size_t j = q * b; j < (q + 1) * b; ++j) {
+                    buffer[s] = a[i * n + j];
+
+                    s += m_n;
+                    s -= s >= n ? n : 0;
+                }
+            }
+
+            std::copy_n(buffer.get(), n, a + i * n);
+        }
+    };
+
+    engine_dispatch_1d(row_fun, 0, m, parallel && m > 1);
+
+    // 3. Shuffle each column
+
+    auto column_fun = [&](const size_t first, const size_t last) {
+        auto buffer = etl::allocate<T>(m * S);
+
+        for (size_t block = first; block < last; ++block) {
+            const size_t j0   = block * B;
+            const size_t cols = std::min(B, n - j0);
+
+            for (size_t r = 0; r < m; ++r) {
+                // Position (ii, jj) of the element in the original matrix
+                const size_t jj = (r * n + j0) / m;
+
+                size_t ii = (r * n + j0) % m;
+                size_t k  = jj / b;
+                size_t t  = jj % b;
+
+                for (size_t j = 0; j < cols; ++j) {
+                    const size_t src = ii + k;
+
+                    buffer[r * S + j] = a[(src >= m ? src - m : src) * n + j0 + j];
+
+                    if (++ii == m) {
+                        ii = 0;
+
+                        if (++t == b) {
+                            t = 0;
+                            ++k;
+                        }
+                    }
+                }
+            }
+
+            for (size_t r = 0; r < m; ++r) {
+                std::copy_n(buffer.get() + r * S, cols, a + r * n + j0);
+            }
+        }
+    };
+
+    engine_dispatch_1d(column_fun, 0, blocks, parallel && blocks > 1);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Inplace transposition of the rectangular matrix c
+ *
+ * Large matrices are transposed inplace with O(max(N, M)) extra memory,
+ * smaller matrices are transposed from a temporary copy.
+ *
+ * \param mat The matrix to transpose
+ */
+template <typename C, cpp_enable_iff(is_dma<C>)>
+void inplace_rectangular_transpose(C&& mat) {
+    static constexpr bool row_major = decay_traits<C>::storage_order == order::RowMajor;
+
+    if (etl::size(mat) >= inplace_transpose_threshold) {
+        mat.ensure_cpu_up_to_date();
+
+        // The memory of a column-major matrix is the one of its row-major transpose
+        const size_t m = row_major ? etl::dim<0>(mat) : etl::dim<1>(mat);
+        const size_t n = row_major ? etl::dim<1>(mat) : etl::dim<0>(mat);
+
+        detail::inplace_rectangular_transpose_kernel(mat.memory_start(), m, n);
+
+        mat.invalidate_gpu();
+    } else {
+        detail::copy_rectangular_transpose(mat);
+    }
+}
+
+/*!
+ * \brief Inplace transposition of the rectangular matrix c
+ * \param mat The matrix to transpose
+ */
+template <typename C, cpp_disable_iff(is_dma<C>)>
+void inplace_rectangular_transpose(C&& mat) {
+    detail::copy_rectangular_transpose(mat);
+}
+
 /*!
  * \brief Perform an inplace matrix transposition in O(1).
  *
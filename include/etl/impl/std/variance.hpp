@@ -0,0 +1,116 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the "variance" reduction
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Partial state of a single-pass (Welford) computation of the
+ * mean and of the variance.
+ */
+template <typename T>
+struct welford_acc {
+    size_t n = 0; ///< The number of elements
+    T mean   = 0; ///< The mean of the elements
+    T m2     = 0; ///< The sum of the squared deviations from the mean
+
+    /*!
+     * \brief Add a new element to the state
+     * \param x The element to add
+     */
+    void push(T x) {
+        ++n;
+
+        const T delta = x - mean;
+        mean += delta / T(n);
+        m2 += delta * (x - mean);
+    }
+
+    /*!
+     * \brief Merge another partial state into this one (Chan et al.)
+     * \param rhs The state to merge
+     */
+    void merge(const welford_acc& rhs) {
+        if (!rhs.n) {
+            return;
+        }
+
+        if (!n) {
+            *this = rhs;
+            return;
+        }
+
+        const size_t total = n + rhs.n;
+        const T delta      = rhs.mean - mean;
+
+        mean += delta * (T(rhs.n) / T(total));
+        m2 += rhs.m2 + delta * delta * (T(n) * T(rhs.n) / T(total));
+        n = total;
+    }
+
+    /*!
+     * \brief Returns the (population) variance of the elements
+     */
+    T variance() const {
+        return n ? m2 / T(n) : T(0);
+    }
+};
+
+/*!
+ * \brief The Welford state used to compute the variance of an
+ * expression of type E. Integers are accumulated in double precision.
+ */
+template <typename E>
+using welford_t = welford_acc<std::conditional_t<is_floating<E>, value_t<E>, double>>;
+
+} //end of namespace detail
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Compute the mean and the variance of the input in a single pass
+ * \param input The input expression
+ * \return the state of the computation
+ */
+template <typename E>
+etl::detail::welford_t<E> variance(const E& input) {
+    using acc_t = etl::detail::welford_t<E>;
+
+    acc_t acc;
+
+    auto acc_functor = [&acc](const acc_t& partial) {
+        acc.merge(partial);
+    };
+
+    auto batch_fun = [&input](size_t first, size_t last) {
+        acc_t partial;
+
+        for (size_t i = first; i < last; ++i) {
+            partial.push(input[i]);
+        }
+
+        return partial;
+    };
+
+    engine_dispatch_1d_acc<acc_t>(batch_fun, acc_functor, 0, etl::size(input), sum_parallel_threshold);
+
+    return acc;
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
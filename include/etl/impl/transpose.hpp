@@ -14,6 +14,7 @@
 
 //Include the implementations
 #include "etl/impl/std/transpose.hpp"
+#include "etl/impl/vec/transpose.hpp"
 #include "etl/impl/blas/transpose.hpp"
 #include "etl/impl/cublas/transpose.hpp"
 
@@ -43,15 +44,20 @@ constexpr transpose_impl select_default_transpose_impl(bool no_gpu){
         return transpose_impl::CUBLAS;
     }
 
+    // Condition to use VEC
+    constexpr bool vec_possible = vec_enabled && vectorize_impl && is_dma<C> && all_floating<A, C> && all_homogeneous<A, C>;
+
 #ifdef SLOW_MKL
     // STD is always faster than MKL for out-of-place transpose
-    return transpose_impl::STD;
+    return vec_possible ? transpose_impl::VEC : transpose_impl::STD;
 #else
     // Condition to use MKL
     constexpr bool mkl_possible = mkl_enabled && is_dma<C> && is_floating<C>;
 
     if (mkl_possible) {
         return transpose_impl::MKL;
+    } else if (vec_possible) {
+        return transpose_impl::VEC;
     } else {
         return transpose_impl::STD;
     }
@@ -78,8 +84,13 @@ constexpr transpose_impl select_default_in_square_transpose_impl(bool no_gpu){
     // Condition to use MKL
     constexpr bool mkl_possible = mkl_enabled && is_dma<C> && is_floating<C>;
 
+    // Condition to use VEC
+    constexpr bool vec_possible = vec_enabled && vectorize_impl && is_dma<C> && is_floating<C>;
+
     if (mkl_possible) {
         return transpose_impl::MKL;
+    } else if (vec_possible) {
+        return transpose_impl::VEC;
     } else {
         return transpose_impl::STD;
     }
@@ -117,6 +128,15 @@ transpose_impl select_transpose_impl(transpose_impl def) {
 
                 return forced;
 
+            //VEC cannot always be used
+            case transpose_impl::VEC:
+                if (!vec_enabled || !is_dma<C> || !all_floating<A, C> || !all_homogeneous<A, C>) {
+                    std::cerr << "Forced selection to VEC transpose implementation, but not possible for this expression" << std::endl;
+                    return def;
+                }
+
+                return forced;
+
             //In other cases, simply use the forced impl
             default:
                 return forced;
@@ -200,6 +220,8 @@ struct inplace_square_transpose {
             etl::impl::blas::inplace_square_transpose(c);
         } else if /*constexpr_select*/ (impl == transpose_impl::CUBLAS) {
             etl::impl::cublas::inplace_square_transpose(c);
+        } else if /*constexpr_select*/ (impl == transpose_impl::VEC) {
+            etl::impl::vec::inplace_square_transpose(c);
         } else if /*constexpr_select*/ (impl == transpose_impl::STD) {
             etl::impl::standard::inplace_square_transpose(c);
         } else {
@@ -224,6 +246,8 @@ struct inplace_rectangular_transpose {
             etl::impl::blas::inplace_rectangular_transpose(c);
         } else if /*constexpr_select*/ (impl == transpose_impl::CUBLAS) {
             etl::impl::cublas::inplace_rectangular_transpose(c);
+        } else if /*constexpr_select*/ (impl == transpose_impl::VEC) {
+            etl::impl::vec::inplace_rectangular_transpose(c);
         } else if /*constexpr_select*/ (impl == transpose_impl::STD) {
             etl::impl::standard::inplace_rectangular_transpose(c);
         } else {
@@ -278,6 +302,8 @@ struct transpose {
 
             if /*constexpr_select*/ (impl == transpose_impl::MKL) {
                 etl::impl::blas::transpose(aa, c);
+            } else if /*constexpr_select*/ (impl == transpose_impl::VEC) {
+                etl::impl::vec::transpose(aa, c);
             } else if /*constexpr_select*/ (impl == transpose_impl::STD) {
                 etl::impl::standard::transpose(aa, c);
             } else {
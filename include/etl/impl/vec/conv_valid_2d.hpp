@@ -31,48 +31,6 @@ void conv2_valid_flipped(const I& input, const K& kernel, C&& conv, size_t s1, s
 
     const size_t k2 = etl::dim<1>(kernel);
 
-    if (cpp_unlikely(p1 || p2)) {
-        const size_t n1 = etl::dim<0>(input);
-        const size_t n2 = etl::dim<1>(input);
-
-        const size_t o1 = n1 + 2 * p1;
-        const size_t o2 = n2 + 2 * p2;
-
-        if (o1 * o2 * sizeof(T) < max_workspace) {
-            etl::dyn_matrix<T, 2> padded_matrix(o1, o2, T(0));
-
-            detail::pad_2d_input(input, padded_matrix, p1, p2);
-
-            conv2_valid_flipped(padded_matrix, kernel, conv, s1, s2, 0, 0);
-
-            return;
-        }
-    }
-
-    if (cpp_unlikely(s1 > 1 || s2 > 1)) {
-        const size_t n1 = etl::dim<0>(input);
-        const size_t n2 = etl::dim<1>(input);
-
-        const size_t c1 = etl::dim<0>(conv);
-        const size_t c2 = etl::dim<1>(conv);
-
-        const size_t k1 = etl::dim<0>(kernel);
-        const size_t k2 = etl::dim<1>(kernel);
-
-        etl::dyn_matrix<T> tmp_result(n1 - k1 + 1, n2 - k2 + 1);
-
-        conv2_valid_flipped(input, kernel, tmp_result, 1, 1, 0, 0);
-
-        // Strided copy of the large result into the small result
-        for (size_t i = 0; i < c1; ++i) {
-            for (size_t j = 0; j < c2; ++j) {
-                conv(i, j) = tmp_result(i * s1, j * s2);
-            }
-        }
-
-        return;
-    }
-
     if (padding_impl) {
         constexpr size_t AS = std::is_same<T, float>::value ? 8 : 4;
         constexpr size_t SS = AS / 2;
@@ -134,47 +92,6 @@ void conv2_valid(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2
 
     const size_t k2 = etl::dim<1>(kernel);
 
-    if (cpp_unlikely(p1 || p2)) {
-        const size_t n1 = etl::dim<0>(input);
-        const size_t n2 = etl::dim<1>(input);
-
-        const size_t o1 = n1 + 2 * p1;
-        const size_t o2 = n2 + 2 * p2;
-
-        if (o1 * o2 * sizeof(T) < max_workspace) {
-            etl::dyn_matrix<T, 2> padded_matrix(o1, o2, T(0));
-
-            detail::pad_2d_input(input, padded_matrix, p1, p2);
-
-            conv2_valid(padded_matrix, kernel, conv, s1, s2, 0, 0);
-
-            return;
-        }
-    }
-
-    if (cpp_unlikely(s1 > 1 || s2 > 1)) {
-        const size_t n1 = etl::dim<0>(input);
-        const size_t n2 = etl::dim<1>(input);
-
-        const size_t c1 = etl::dim<0>(conv);
-        const size_t c2 = etl::dim<1>(conv);
-
-        const size_t k1 = etl::dim<0>(kernel);
-
-        etl::dyn_matrix<T> tmp_result(n1 - k1 + 1, n2 - k2 + 1);
-
-        conv2_valid(input, kernel, tmp_result, 1, 1, 0, 0);
-
-        // Strided copy of the large result into the small result
-        for (size_t i = 0; i < c1; ++i) {
-            for (size_t j = 0; j < c2; ++j) {
-                conv(i, j) = tmp_result(i * s1, j * s2);
-            }
-        }
-
-        return;
-    }
-
     if (padding_impl) {
         constexpr size_t AS = std::is_same<T, float>::value ? 8 : 4;
         constexpr size_t SS = AS / 2;
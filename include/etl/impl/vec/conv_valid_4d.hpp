@@ -17,8 +17,10 @@ namespace impl {
 namespace vec {
 
 /*!
- * \brief Decide if padding is used for the given kernel dimensions and the
- * input padding.
+ * \brief Decide if padding is used for the given kernel dimensions.
+ *
+ * The input padding does not need a padded copy, it is handled directly
+ * by the micro kernels.
  *
  * \param k1 The first dimension of the kernel.
  * \param k2 The second dimension of the kernel.
@@ -26,14 +28,14 @@ namespace vec {
  * \return true if padding is to be used, false otherwise.
  */
 template<typename T>
-constexpr bool need_padding(size_t k1, size_t k2, size_t p1, size_t p2){
+constexpr bool need_padding(size_t k1, size_t k2){
     constexpr bool single = std::is_same<T, float>::value;
     constexpr size_t AS   = single ? 8 : 4;
     constexpr size_t SS   = AS / 2;
 
     cpp_unused(k1);
 
-    return k2 < SS || k2 % AS > 0 || p1 || p2;
+    return k2 < SS || k2 % AS > 0;
 }
 
 /*!
@@ -88,7 +90,7 @@ void conv4_valid(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t
         kernel.ensure_cpu_up_to_date();
 
         if /*constexpr*/ (padding_impl) {
-            if(need_padding<T>(k1, k2, p1, p2)){
+            if(need_padding<T>(k1, k2)){
                 const size_t pad = select_pad<T>(k1, k2);
 
                 if (cpp_likely(p1 == 0 && p2 == 0)) {
@@ -128,7 +130,7 @@ void conv4_valid(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t
 
                         engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
                     }
-                } else if(pad){
+                } else {
                     auto padded_input  = common::pad_right_multi_double(input, pad, p1, p2);
                     auto padded_kernel = common::pad_right_flip_multi(kernel, pad);
 
@@ -161,42 +163,6 @@ void conv4_valid(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t
                             }
                         };
 
-                        engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
-                    }
-                } else {
-                    cpp_assert(!pad, "Invalid padding configuration");
-
-                    auto padded_input = common::pad_right_multi_double(input, 0, p1, p2);
-
-                    if (detail::prefer_sse<T>(k2)) {
-                        auto fun_nk = [&](const size_t first, const size_t last) {
-                            for (size_t nk = first; nk < last; ++nk) {
-                                const size_t i = nk / K;
-                                const size_t k = nk % K;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(0), kernel(k)(0), conv(i)(k), s1, s2, 0, 0, T(0));
-
-                                for (size_t c = 1; c < C; ++c) {
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
-                        engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
-                    } else {
-                        auto fun_nk = [&](const size_t first, const size_t last) {
-                            for (size_t nk = first; nk < last; ++nk) {
-                                const size_t i = nk / K;
-                                const size_t k = nk % K;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(0), kernel(k)(0), conv(i)(k), s1, s2, 0, 0, T(0));
-
-                                for (size_t c = 1; c < C; ++c) {
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
                         engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
                     }
                 }
@@ -269,7 +235,7 @@ void conv4_valid_flipped(const I& input, const KK& kernel, CC&& conv, size_t s1,
         // padding of the kernel inside the thread for small kernel (3x3, 5x5)
 
         if /*constexpr*/ (padding_impl) {
-            if(need_padding<T>(k1, k2, p1, p2)){
+            if(need_padding<T>(k1, k2)){
                 const size_t pad = select_pad<T>(k1, k2);
 
                 if(cpp_likely(p1 == 0 && p2 == 0)){
@@ -309,7 +275,7 @@ void conv4_valid_flipped(const I& input, const KK& kernel, CC&& conv, size_t s1,
 
                         engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
                     }
-                } else if(pad){
+                } else {
                     auto padded_input  = common::pad_right_multi_double(input, pad, p1, p2);
                     auto padded_kernel = common::pad_right_multi(kernel, pad);
 
@@ -342,42 +308,6 @@ void conv4_valid_flipped(const I& input, const KK& kernel, CC&& conv, size_t s1,
                             }
                         };
 
-                        engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
-                    }
-                } else {
-                    cpp_assert(!pad, "Invalid padding configuration");
-
-                    auto padded_input = common::pad_right_multi_double(input, 0, p1, p2);
-
-                    if (detail::prefer_sse<T>(k2)) {
-                        auto fun_nk = [&](const size_t first, const size_t last) {
-                            for (size_t nk = first; nk < last; ++nk) {
-                                const size_t i = nk / K;
-                                const size_t k = nk % K;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(0), kernel(k)(0), conv(i)(k), s1, s2, 0, 0, T(0));
-
-                                for (size_t c = 1; c < C; ++c) {
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
-                        engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
-                    } else {
-                        auto fun_nk = [&](const size_t first, const size_t last) {
-                            for (size_t nk = first; nk < last; ++nk) {
-                                const size_t i = nk / K;
-                                const size_t k = nk % K;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(0), kernel(k)(0), conv(i)(k), s1, s2, 0, 0, T(0));
-
-                                for (size_t c = 1; c < C; ++c) {
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
                         engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
                     }
                 }
@@ -449,7 +379,7 @@ void conv4_valid_back(const I& input, const KK& kernel, CC&& conv, size_t s1, si
         conv = 0;
 
         if /*constexpr*/ (padding_impl) {
-            if(need_padding<T>(k1, k2, p1, p2)){
+            if(need_padding<T>(k1, k2)){
                 const size_t pad = select_pad<T>(k1, k2);
 
                 if(cpp_likely(p1 == 0 && p2 == 0)){
@@ -489,7 +419,7 @@ void conv4_valid_back(const I& input, const KK& kernel, CC&& conv, size_t s1, si
 
                         engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
                     }
-                } else if(pad){
+                } else {
                     auto padded_input  = common::pad_right_multi_double(input, pad, p1, p2);
                     auto padded_kernel = common::pad_right_flip_multi(kernel, pad);
 
@@ -522,42 +452,6 @@ void conv4_valid_back(const I& input, const KK& kernel, CC&& conv, size_t s1, si
                             }
                         };
 
-                        engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
-                    }
-                } else {
-                    cpp_assert(!pad, "Invalid padding configuration");
-
-                    auto padded_input = common::pad_right_multi_double(input, 0, p1, p2);
-
-                    if (detail::prefer_sse<T>(k2)) {
-                        auto fun_nc = [&](const size_t first, const size_t last) {
-                            for (size_t nk = first; nk < last; ++nk) {
-                                const size_t i = nk / C;
-                                const size_t c = nk % C;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(0), kernel(0)(c), conv(i)(c), s1, s2, 0, 0, T(0));
-
-                                for (size_t k = 1; k < K; ++k) {
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
-                        engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
-                    } else {
-                        auto fun_nc = [&](const size_t first, const size_t last) {
-                            for (size_t nk = first; nk < last; ++nk) {
-                                const size_t i = nk / C;
-                                const size_t c = nk % C;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(0), kernel(0)(c), conv(i)(c), s1, s2, 0, 0, T(0));
-
-                                for (size_t k = 1; k < K; ++k) {
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
                         engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
                     }
                 }
@@ -630,7 +524,7 @@ void conv4_valid_back_flipped(const I& input, const KK& kernel, CC&& conv, size_
         // padding of the kernel inside the thread for small kernel (3x3, 5x5)
 
         if /*constexpr*/ (padding_impl) {
-            if(need_padding<T>(k1, k2, p1, p2)){
+            if(need_padding<T>(k1, k2)){
                 const size_t pad = select_pad<T>(k1, k2);
 
                 if(cpp_likely(p1 == 0 && p2 == 0)){
@@ -670,7 +564,7 @@ void conv4_valid_back_flipped(const I& input, const KK& kernel, CC&& conv, size_
 
                         engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
                     }
-                } else if(pad){
+                } else {
                     auto padded_input  = common::pad_right_multi_double(input, pad, p1, p2);
                     auto padded_kernel = common::pad_right_multi(kernel, pad);
 
@@ -703,42 +597,6 @@ void conv4_valid_back_flipped(const I& input, const KK& kernel, CC&& conv, size_
                             }
                         };
 
-                        engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
-                    }
-                } else {
-                    cpp_assert(!pad, "Invalid padding configuration");
-
-                    auto padded_input = common::pad_right_multi_double(input, 0, p1, p2);
-
-                    if (detail::prefer_sse<T>(k2)) {
-                        auto fun_nc = [&](const size_t first, const size_t last) {
-                            for (size_t nk = first; nk < last; ++nk) {
-                                const size_t i = nk / C;
-                                const size_t c = nk % C;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(0), kernel(0)(c), conv(i)(c), s1, s2, 0, 0, T(0));
-
-                                for (size_t k = 1; k < K; ++k) {
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
-                        engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
-                    } else {
-                        auto fun_nc = [&](const size_t first, const size_t last) {
-                            for (size_t nk = first; nk < last; ++nk) {
-                                const size_t i = nk / C;
-                                const size_t c = nk % C;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(0), kernel(0)(c), conv(i)(c), s1, s2, 0, 0, T(0));
-
-                                for (size_t k = 1; k < K; ++k) {
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
                         engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
                     }
                 }
@@ -809,7 +667,7 @@ void conv4_valid_filter(const I& input, const KK& kernel, CC&& conv, size_t s1,
         kernel.ensure_cpu_up_to_date();
 
         if /*constexpr*/ (padding_impl) {
-            if(need_padding<T>(k1, k2, p1, p2)){
+            if(need_padding<T>(k1, k2)){
                 const size_t pad = select_pad<T>(k1, k2);
 
                 if(cpp_likely(p1 == 0 && p2 == 0)){
@@ -861,7 +719,7 @@ void conv4_valid_filter(const I& input, const KK& kernel, CC&& conv, size_t s1,
 
                         engine_dispatch_1d(fun_kc, 0, K * C, 4UL);
                     }
-                } else if(pad){
+                } else {
                     auto padded_input  = common::pad_right_multi_double(input, pad, p1, p2);
                     auto padded_kernel = common::pad_right_flip_multi(kernel, pad);
 
@@ -906,54 +764,6 @@ void conv4_valid_filter(const I& input, const KK& kernel, CC&& conv, size_t s1,
                             }
                         };
 
-                        engine_dispatch_1d(fun_kc, 0, K * C, 4UL);
-                    }
-                } else {
-                    cpp_assert(!pad, "Invalid padding configuration");
-
-                    auto padded_input = common::pad_right_multi_double(input, 0, p1, p2);
-
-                    if (detail::prefer_sse<T>(k2)) {
-                        auto fun_kc = [&](const size_t first, const size_t last) {
-                            //i = 0
-                            for (size_t kc = first; kc < last; ++kc) {
-                                const size_t k = kc / C;
-                                const size_t c = kc % C;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(0)(c), kernel(0)(k), conv(k)(c), s1, s2, 0, 0, T(0));
-                            }
-
-                            for (size_t i = 1; i < N; ++i) {
-                                for (size_t kc = first; kc < last; ++kc) {
-                                    const size_t k = kc / C;
-                                    const size_t c = kc % C;
-
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
-                        engine_dispatch_1d(fun_kc, 0, K * C, 4UL);
-                    } else {
-                        auto fun_kc = [&](const size_t first, const size_t last) {
-                            //i = 0
-                            for (size_t kc = first; kc < last; ++kc) {
-                                const size_t k = kc / C;
-                                const size_t c = kc % C;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(0)(c), kernel(0)(k), conv(k)(c), s1, s2, 0, 0, T(0));
-                            }
-
-                            for (size_t i = 1; i < N; ++i) {
-                                for (size_t kc = first; kc < last; ++kc) {
-                                    const size_t k = kc / C;
-                                    const size_t c = kc % C;
-
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
                         engine_dispatch_1d(fun_kc, 0, K * C, 4UL);
                     }
                 }
@@ -1037,7 +847,7 @@ void conv4_valid_filter_flipped(const I& input, const KK& kernel, CC&& conv, siz
         kernel.ensure_cpu_up_to_date();
 
         if /*constexpr*/ (padding_impl) {
-            if(need_padding<T>(k1, k2, p1, p2)){
+            if(need_padding<T>(k1, k2)){
                 const size_t pad = select_pad<T>(k1, k2);
 
                 if(cpp_likely(p1 == 0 && p2 == 0)){
@@ -1089,7 +899,7 @@ void conv4_valid_filter_flipped(const I& input, const KK& kernel, CC&& conv, siz
 
                         engine_dispatch_1d(fun_kc, 0, K * C, 4UL);
                     }
-                } else if(pad){
+                } else {
                     auto padded_input  = common::pad_right_multi_double(input, pad, p1, p2);
                     auto padded_kernel = common::pad_right_multi(kernel, pad);
 
@@ -1134,54 +944,6 @@ void conv4_valid_filter_flipped(const I& input, const KK& kernel, CC&& conv, siz
                             }
                         };
 
-                        engine_dispatch_1d(fun_kc, 0, K * C, 4UL);
-                    }
-                } else {
-                    cpp_assert(!pad, "Invalid padding configuration");
-
-                    auto padded_input = common::pad_right_multi_double(input, 0, p1, p2);
-
-                    if (detail::prefer_sse<T>(k2)) {
-                        auto fun_kc = [&](const size_t first, const size_t last) {
-                            //i = 0
-                            for (size_t kc = first; kc < last; ++kc) {
-                                const size_t k = kc / C;
-                                const size_t c = kc % C;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(0)(c), kernel(0)(k), conv(k)(c), s1, s2, 0, 0, T(0));
-                            }
-
-                            for (size_t i = 1; i < N; ++i) {
-                                for (size_t kc = first; kc < last; ++kc) {
-                                    const size_t k = kc / C;
-                                    const size_t c = kc % C;
-
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_sse_vec>(padded_input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
-                        engine_dispatch_1d(fun_kc, 0, K * C, 4UL);
-                    } else {
-                        auto fun_kc = [&](const size_t first, const size_t last) {
-                            //i = 0
-                            for (size_t kc = first; kc < last; ++kc) {
-                                const size_t k = kc / C;
-                                const size_t c = kc % C;
-
-                                detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(0)(c), kernel(0)(k), conv(k)(c), s1, s2, 0, 0, T(0));
-                            }
-
-                            for (size_t i = 1; i < N; ++i) {
-                                for (size_t kc = first; kc < last; ++kc) {
-                                    const size_t k = kc / C;
-                                    const size_t c = kc % C;
-
-                                    detail::conv2_valid_flipped_micro_kernel<detail::safe_avx_vec>(padded_input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, 0, 0, T(1));
-                                }
-                            }
-                        };
-
                         engine_dispatch_1d(fun_kc, 0, K * C, 4UL);
                     }
                 }
@@ -36,6 +36,28 @@ namespace vec {
 
 namespace detail {
 
+/*!
+ * \brief Compute the range of the output positions, along one dimension,
+ * for which the kernel lies entirely inside the (non-padded) input.
+ *
+ * The positions outside of this range are in the border, with the kernel
+ * overlapping the implicit zero padding.
+ *
+ * \param n The dimension of the input
+ * \param m The dimension of the kernel
+ * \param c The dimension of the output
+ * \param s The stride
+ * \param p The padding
+ *
+ * \return The range [first, last) of the inner output positions
+ */
+inline std::pair<size_t, size_t> conv2_valid_inner_range(size_t n, size_t m, size_t c, size_t s, size_t p) {
+    const size_t first = std::min(c, (p + s - 1) / s);
+    const size_t last  = n + p >= m ? std::min(c, (n + p - m) / s + 1) : 0;
+
+    return {first, std::max(first, last)};
+}
+
 /*!
  * \brief Handle a point in the border for computation of valid convolution.
  *
@@ -109,6 +131,14 @@ void conv2_valid_flipped_inner_kernel(const T* in, size_t n1, size_t n2, const T
     const size_t c1 = (n1 - m1 + 2 * p1) / s1 + 1;
     const size_t c2 = (n2 - m2 + 2 * p2) / s2 + 1;
 
+    const auto r1 = conv2_valid_inner_range(n1, m1, c1, s1, p1);
+    const auto r2 = conv2_valid_inner_range(n2, m2, c2, s2, p2);
+
+    const size_t b1 = r1.first;
+    const size_t e1 = r1.second;
+    const size_t b2 = r2.first;
+    const size_t e2 = r2.second;
+
     if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
         if (vec_size == 4 && m1 == 3 && m2 == 4) {
             conv2_valid_flipped_micro_kernel_3x4<V>(in, n1, n2, kkk, out, beta);
@@ -132,10 +162,10 @@ void conv2_valid_flipped_inner_kernel(const T* in, size_t n1, size_t n2, const T
     }
 
     if (beta == T(0)) {
-        for (size_t i = p1; i < c1 - p1; ++i) {
-            size_t j = p2;
+        for (size_t i = b1; i < e1; ++i) {
+            size_t j = b2;
 
-            for (; j + 7 < c2 - p2; j += 8) {
+            for (; j + 7 < e2; j += 8) {
                 auto r1 = vec_type::template zero<T>();
                 auto r2 = vec_type::template zero<T>();
                 auto r3 = vec_type::template zero<T>();
@@ -181,7 +211,7 @@ void conv2_valid_flipped_inner_kernel(const T* in, size_t n1, size_t n2, const T
                 out[i * c2 + j + 7] = vec_type::hadd(r8);
             }
 
-            for (; j + 1 < c2 - p2; j += 2) {
+            for (; j + 1 < e2; j += 2) {
                 auto r1 = vec_type::template zero<T>();
                 auto r2 = vec_type::template zero<T>();
 
@@ -203,7 +233,7 @@ void conv2_valid_flipped_inner_kernel(const T* in, size_t n1, size_t n2, const T
                 out[i * c2 + j + 1] = vec_type::hadd(r2);
             }
 
-            if (j < c2 - p2) {
+            if (j < e2) {
                 auto r1 = vec_type::template zero<T>();
 
                 const size_t i_i = i * s1 - p1;
@@ -220,10 +250,10 @@ void conv2_valid_flipped_inner_kernel(const T* in, size_t n1, size_t n2, const T
             }
         }
     } else {
-        for (size_t i = p1; i < c1 - p1; ++i) {
-            size_t j = p2;
+        for (size_t i = b1; i < e1; ++i) {
+            size_t j = b2;
 
-            for (; j + 7 < c2 - p2; j += 8) {
+            for (; j + 7 < e2; j += 8) {
                 auto r1 = vec_type::template zero<T>();
                 auto r2 = vec_type::template zero<T>();
                 auto r3 = vec_type::template zero<T>();
@@ -269,7 +299,7 @@ void conv2_valid_flipped_inner_kernel(const T* in, size_t n1, size_t n2, const T
                 out[i * c2 + j + 7] = beta * out[i * c2 + j + 7] + vec_type::hadd(r8);
             }
 
-            for (; j + 1 < c2 - p2; j += 2) {
+            for (; j + 1 < e2; j += 2) {
                 auto r1 = vec_type::template zero<T>();
                 auto r2 = vec_type::template zero<T>();
 
@@ -291,7 +321,7 @@ void conv2_valid_flipped_inner_kernel(const T* in, size_t n1, size_t n2, const T
                 out[i * c2 + j + 1] = beta * out[i * c2 + j + 1] + vec_type::hadd(r2);
             }
 
-            if (j < c2 - p2) {
+            if (j < e2) {
                 auto r1 = vec_type::template zero<T>();
 
                 const size_t i_i = i * s1 - p1;
@@ -311,8 +341,8 @@ void conv2_valid_flipped_inner_kernel(const T* in, size_t n1, size_t n2, const T
 
     if (!padding_impl && m2 % vec_size != 0) {
         size_t rem = m2 % vec_size;
-        for (size_t i = p1; i < c1 - p1; ++i) {
-            for (size_t j = p2; j < c2 - p2; ++j) {
+        for (size_t i = b1; i < e1; ++i) {
+            for (size_t j = b2; j < e2; ++j) {
                 T temp = 0.0;
 
                 const size_t i_i = i * s1 - p1;
@@ -320,7 +350,7 @@ void conv2_valid_flipped_inner_kernel(const T* in, size_t n1, size_t n2, const T
 
                 for (size_t k = 0; k < m1; ++k) {
                     for (size_t l = m2 - rem; l < m2; ++l) {
-                        temp += in[i_i + k * n2 + i_j + l] * kkk[k * m2 + l];
+                        temp += in[(i_i + k) * n2 + i_j + l] * kkk[k * m2 + l];
                     }
                 }
 
@@ -374,26 +404,35 @@ void conv2_valid_flipped_micro_kernel(const I& input, const K& kernel, C&& conv,
     conv.invalidate_gpu();
 
     if (cpp_unlikely(p1 || p2)) {
-        for (size_t i = 0; i < p1; ++i) {
+        // Only the outputs overlapping the padding are left to compute
+        const auto r1 = conv2_valid_inner_range(n1, m1, c1, s1, p1);
+        const auto r2 = conv2_valid_inner_range(n2, m2, c2, s2, p2);
+
+        const size_t b1 = r1.first;
+        const size_t e1 = r1.second;
+        const size_t b2 = r2.first;
+        const size_t e2 = r2.second;
+
+        for (size_t i = 0; i < b1; ++i) {
             for (size_t j = 0; j < c2; ++j) {
                 conv2_valid_flipped_border(input, kernel, conv, i, j, s1, s2, p1, p2, beta);
             }
         }
 
-        for (size_t i = c1 - p1; i < c1; ++i) {
+        for (size_t i = e1; i < c1; ++i) {
             for (size_t j = 0; j < c2; ++j) {
                 conv2_valid_flipped_border(input, kernel, conv, i, j, s1, s2, p1, p2, beta);
             }
         }
 
-        for (size_t j = 0; j < p2; ++j) {
-            for (size_t i = p1; i < c1 - p1; ++i) {
+        for (size_t j = 0; j < b2; ++j) {
+            for (size_t i = b1; i < e1; ++i) {
                 conv2_valid_flipped_border(input, kernel, conv, i, j, s1, s2, p1, p2, beta);
             }
         }
 
-        for (size_t j = c2 - p2; j < c2; ++j) {
-            for (size_t i = p1; i < c1 - p1; ++i) {
+        for (size_t j = e2; j < c2; ++j) {
+            for (size_t i = b1; i < e1; ++i) {
                 conv2_valid_flipped_border(input, kernel, conv, i, j, s1, s2, p1, p2, beta);
             }
         }
@@ -0,0 +1,802 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Winograd minimal filtering implementation of the 4D convolutions
+ * with 3x3 kernels.
+ *
+ * The output is computed by tiles of MxM elements from input tiles of
+ * (M+2)x(M+2) elements (Lavin and Gray, "Fast Algorithms for Convolutional
+ * Neural Networks"). The kernels and the input tiles are transformed once
+ * and the reduction over the channels is then done, for each of the (M+2)^2
+ * elements of the transformed tiles, with one matrix multiplication over
+ * a block of tiles of the batch.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the Winograd convolution is possible for the given types
+ * \tparam I The type of the input
+ * \tparam K The type of the kernel
+ * \tparam C The type of the output
+ */
+template <typename I, typename K, typename C>
+constexpr bool winograd_possible = conv2_possible<vector_mode, I, K, C> && is_floating<I>;
+
+namespace winograd {
+
+/*!
+ * \brief Transformation matrices of the F(MxM, 3x3) Winograd algorithm
+ * \tparam M The size of the output tiles
+ */
+template <size_t M>
+struct transform;
+
+/*!
+ * \brief Transformation matrices of the F(2x2, 3x3) Winograd algorithm
+ */
+template <>
+struct transform<2> {
+    static constexpr size_t alpha = 4; ///< The size of the input tiles
+
+    /*!
+     * \brief Apply the input transformation B^T to the alpha elements of d
+     * \param d The input elements, with a stride of ds
+     * \param r The output elements, with a stride of rs
+     */
+    template <typename T>
+    static void input(const T* d, size_t ds, T* r, size_t rs) {
+        r[0 * rs] = d[0 * ds] - d[2 * ds];
+        r[1 * rs] = d[1 * ds] + d[2 * ds];
+        r[2 * rs] = d[2 * ds] - d[1 * ds];
+        r[3 * rs] = d[1 * ds] - d[3 * ds];
+    }
+
+    /*!
+     * \brief Return the element (i, j) of the kernel transformation G
+     */
+    static constexpr double g(size_t i, size_t j) {
+        constexpr double values[4][3] = {
+            {1.0, 0.0, 0.0},
+            {0.5, 0.5, 0.5},
+            {0.5, -0.5, 0.5},
+            {0.0, 0.0, 1.0}};
+
+        return values[i][j];
+    }
+
+    /*!
+     * \brief Apply the output transformation A^T to the alpha elements of m
+     * \param m The input elements, with a stride of ms
+     * \param y The output elements, with a stride of ys
+     */
+    template <typename T>
+    static void output(const T* m, size_t ms, T* y, size_t ys) {
+        y[0 * ys] = m[0 * ms] + m[1 * ms] + m[2 * ms];
+        y[1 * ys] = m[1 * ms] - m[2 * ms] - m[3 * ms];
+    }
+};
+
+/*!
+ * \brief Transformation matrices of the F(4x4, 3x3) Winograd algorithm
+ */
+template <>
+struct transform<4> {
+    static constexpr size_t alpha = 6; ///< The size of the input tiles
+
+    /*!
+     * \brief Apply the input transformation B^T to the alpha elements of d
+     * \param d The input elements, with a stride of ds
+     * \param r The output elements, with a stride of rs
+     */
+    template <typename T>
+    static void input(const T* d, size_t ds, T* r, size_t rs) {
+        const T d0 = d[0 * ds];
+        const T d1 = d[1 * ds];
+        const T d2 = d[2 * ds];
+        const T d3 = d[3 * ds];
+        const T d4 = d[4 * ds];
+        const T d5 = d[5 * ds];
+
+        r[0 * rs] = T(4) * d0 - T(5) * d2 + d4;
+        r[1 * rs] = d3 + d4 - T(4) * (d1 + d2);
+        r[2 * rs] = d4 - d3 + T(4) * (d1 - d2);
+        r[3 * rs] = d4 - d2 + T(2) * (d3 - d1);
+        r[4 * rs] = d4 - d2 + T(2) * (d1 - d3);
+        r[5 * rs] = T(4) * d1 - T(5) * d3 + d5;
+    }
+
+    /*!
+     * \brief Return the element (i, j) of the kernel transformation G
+     */
+    static constexpr double g(size_t i, size_t j) {
+        constexpr double values[6][3] = {
+            {1.0 / 4.0, 0.0, 0.0},
+            {-1.0 / 6.0, -1.0 / 6.0, -1.0 / 6.0},
+            {-1.0 / 6.0, 1.0 / 6.0, -1.0 / 6.0},
+            {1.0 / 24.0, 1.0 / 12.0, 1.0 / 6.0},
+            {1.0 / 24.0, -1.0 / 12.0, 1.0 / 6.0},
+            {0.0, 0.0, 1.0}};
+
+        return values[i][j];
+    }
+
+    /*!
+     * \brief Apply the output transformation A^T to the alpha elements of m
+     * \param m The input elements, with a stride of ms
+     * \param y The output elements, with a stride of ys
+     */
+    template <typename T>
+    static void output(const T* m, size_t ms, T* y, size_t ys) {
+        const T a = m[1 * ms] + m[2 * ms];
+        const T b = m[1 * ms] - m[2 * ms];
+        const T c = m[3 * ms] + m[4 * ms];
+        const T d = m[3 * ms] - m[4 * ms];
+
+        y[0 * ys] = m[0 * ms] + a + c;
+        y[1 * ys] = b + T(2) * d;
+        y[2 * ys] = a + T(4) * c;
+        y[3 * ys] = b + T(8) * d + m[5 * ms];
+    }
+};
+
+/*!
+ * \brief Transform the 3x3 kernels into U = G g G^T.
+ *
+ * The transformed kernels are stored as alpha * alpha matrices of
+ * (co x ci) elements, ready to be multiplied with the transformed input.
+ *
+ * \param kernel The memory of the (K, C, 3, 3) kernels
+ * \param K The first dimension of the kernels
+ * \param C The second dimension of the kernels
+ * \param u The output transformed kernels
+ * \param flip Indicates if the kernels must be flipped
+ * \param back Indicates if the output channels are along the second dimension of the kernels
+ */
+template <size_t M, typename T>
+void transform_kernels(const T* kernel, size_t K, size_t C, T* u, bool flip, bool back) {
+    using tr = transform<M>;
+
+    static constexpr size_t alpha = tr::alpha;
+
+    const size_t Co = back ? C : K;
+    const size_t Ci = back ? K : C;
+
+    for (size_t k = 0; k < K; ++k) {
+        for (size_t c = 0; c < C; ++c) {
+            const T* w = kernel + (k * C + c) * 9;
+
+            T g[3][3];
+
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 3; ++j) {
+                    g[i][j] = flip ? w[(2 - i) * 3 + (2 - j)] : w[i * 3 + j];
+                }
+            }
+
+            // tmp = G g
+
+            T tmp[alpha][3];
+
+            for (size_t i = 0; i < alpha; ++i) {
+                for (size_t j = 0; j < 3; ++j) {
+                    tmp[i][j] = T(tr::g(i, 0)) * g[0][j] + T(tr::g(i, 1)) * g[1][j] + T(tr::g(i, 2)) * g[2][j];
+                }
+            }
+
+            // U = tmp G^T
+
+            const size_t co = back ? c : k;
+            const size_t ci = back ? k : c;
+
+            for (size_t i = 0; i < alpha; ++i) {
+                for (size_t j = 0; j < alpha; ++j) {
+                    const size_t xi = i * alpha + j;
+
+                    u[(xi * Co + co) * Ci + ci] = tmp[i][0] * T(tr::g(j, 0)) + tmp[i][1] * T(tr::g(j, 1)) + tmp[i][2] * T(tr::g(j, 2));
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief The number of tiles that are transformed together
+ */
+constexpr size_t winograd_tile_lanes = 16;
+
+/*!
+ * \brief Compute a valid cross-correlation of the input with the
+ * transformed kernels, with implicit zero padding of the input.
+ *
+ * The tiles of all the images are processed by blocks small enough for
+ * their transformed input and output to remain in cache between the
+ * transformations and the reductions over the channels.
+ *
+ * \param input The memory of the (N, Ci, n1, n2) input
+ * \param u The transformed kernels
+ * \param output The memory of the (N, Co, c1, c2) output
+ */
+template <size_t M, typename T>
+void conv4_kernel(const T* input, const T* u, T* output, size_t N, size_t Ci, size_t Co, size_t n1, size_t n2, size_t c1, size_t c2, size_t p1, size_t p2) {
+    using tr = transform<M>;
+
+    static constexpr size_t alpha  = tr::alpha;
+    static constexpr size_t alpha2 = alpha * alpha;
+    static constexpr size_t L      = winograd_tile_lanes;
+
+    const size_t t1    = (c1 + M - 1) / M;
+    const size_t t2    = (c2 + M - 1) / M;
+    const size_t tiles = t1 * t2;
+    const size_t total = N * tiles;
+
+    // The number of tiles of each block, a multiple of the number of lanes
+
+    const size_t tile_workspace = alpha2 * (Ci + Co) * sizeof(T);
+    const size_t P              = std::max(L, std::min(winograd_max_tile_block, (winograd_block_workspace / tile_workspace) / L * L));
+    const size_t blocks         = (total + P - 1) / P;
+
+    auto block_fun = [&](const size_t first, const size_t last) {
+        auto v = etl::allocate<T>(alpha2 * Ci * P);
+        auto m = etl::allocate<T>(alpha2 * Co * P);
+
+        T d[alpha][alpha][L]   = {};
+        T tmp[alpha][alpha][L] = {};
+
+        size_t n_of[L];
+        size_t y_of[L];
+        size_t x_of[L];
+
+        // Compute the image and the position of the first element of the tiles of a group of lanes
+        auto locate = [&](size_t g, size_t nt) {
+            for (size_t k = 0; k < nt; ++k) {
+                const size_t t = (g + k) % tiles;
+
+                n_of[k] = (g + k) / tiles;
+                y_of[k] = (t / t2) * M;
+                x_of[k] = (t % t2) * M;
+            }
+        };
+
+        for (size_t b = first; b < last; ++b) {
+            const size_t g0 = b * P;
+            const size_t np = std::min(P, total - g0);
+
+            // 1. Transform the input tiles into V = B^T d B
+
+            for (size_t t0 = 0; t0 < np; t0 += L) {
+                const size_t nt = std::min(L, np - t0);
+
+                locate(g0 + t0, nt);
+
+                for (size_t ci = 0; ci < Ci; ++ci) {
+                    // Load the tiles, with the padding being zeros
+
+                    for (size_t k = 0; k < nt; ++k) {
+                        const T* in = input + (n_of[k] * Ci + ci) * n1 * n2;
+
+                        const size_t y = y_of[k];
+                        const size_t x = x_of[k];
+
+                        if (y >= p1 && y + alpha <= n1 + p1 && x >= p2 && x + alpha <= n2 + p2) {
+                            const T* tile = in + (y - p1) * n2 + (x - p2);
+
+                            for (size_t i = 0; i < alpha; ++i) {
+                                for (size_t j = 0; j < alpha; ++j) {
+                                    d[i][j][k] = tile[i * n2 + j];
+                                }
+                            }
+                        } else {
+                            for (size_t i = 0; i < alpha; ++i) {
+                                for (size_t j = 0; j < alpha; ++j) {
+                                    const bool inside = y + i >= p1 && y + i - p1 < n1 && x + j >= p2 && x + j - p2 < n2;
+
+                                    d[i][j][k] = inside ? in[(y + i - p1) * n2 + (x + j - p2)] : T(0);
+                                }
+                            }
+                        }
+                    }
+
+                    for (size_t j = 0; j < alpha; ++j) {
+                        for (size_t k = 0; k < L; ++k) {
+                            tr::input(&d[0][j][k], alpha * L, &tmp[0][j][k], alpha * L);
+                        }
+                    }
+
+                    for (size_t i = 0; i < alpha; ++i) {
+                        for (size_t k = 0; k < L; ++k) {
+                            tr::input(&tmp[i][0][k], L, &d[i][0][k], L);
+                        }
+                    }
+
+                    for (size_t i = 0; i < alpha; ++i) {
+                        for (size_t j = 0; j < alpha; ++j) {
+                            std::copy_n(&d[i][j][0], nt, v.get() + ((i * alpha + j) * Ci + ci) * np + t0);
+                        }
+                    }
+                }
+            }
+
+            // 2. Reduce over the channels, for each element of the tiles
+
+            for (size_t xi = 0; xi < alpha2; ++xi) {
+                gemm_rr_to_r(u + xi * Co * Ci, v.get() + xi * Ci * np, m.get() + xi * Co * np, Co, np, Ci);
+            }
+
+            // 3. Transform back the output tiles with Y = A^T m A
+
+            for (size_t t0 = 0; t0 < np; t0 += L) {
+                const size_t nt = std::min(L, np - t0);
+
+                locate(g0 + t0, nt);
+
+                for (size_t co = 0; co < Co; ++co) {
+                    for (size_t i = 0; i < alpha; ++i) {
+                        for (size_t j = 0; j < alpha; ++j) {
+                            std::copy_n(m.get() + ((i * alpha + j) * Co + co) * np + t0, nt, &d[i][j][0]);
+                        }
+                    }
+
+                    for (size_t j = 0; j < alpha; ++j) {
+                        for (size_t k = 0; k < L; ++k) {
+                            tr::output(&d[0][j][k], alpha * L, &tmp[0][j][k], alpha * L);
+                        }
+                    }
+
+                    for (size_t i = 0; i < M; ++i) {
+                        for (size_t k = 0; k < L; ++k) {
+                            tr::output(&tmp[i][0][k], L, &d[i][0][k], L);
+                        }
+                    }
+
+                    // The last tiles of the images may only be partially inside the output
+
+                    for (size_t k = 0; k < nt; ++k) {
+                        T* out = output + (n_of[k] * Co + co) * c1 * c2;
+
+                        const size_t y = y_of[k];
+                        const size_t x = x_of[k];
+
+                        const size_t h = std::min(M, c1 - y);
+                        const size_t w = std::min(M, c2 - x);
+
+                        for (size_t i = 0; i < h; ++i) {
+                            for (size_t j = 0; j < w; ++j) {
+                                out[(y + i) * c2 + x + j] = d[i][j][k];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(block_fun, 0, blocks, engine_select_parallel(alpha2 * total * (Ci + Co), conv_winograd_parallel_threshold) && blocks > 1);
+}
+
+/*!
+ * \brief Indicates if the large F(4x4, 3x3) tiles are used for an output
+ * of the given dimensions.
+ *
+ * Larger tiles save more multiplications, but are less precise and waste
+ * more computations when they do not fit the output.
+ *
+ * \param c1 The first dimension of the output
+ * \param c2 The second dimension of the output
+ * \return true if the F(4x4, 3x3) tiles are used, false otherwise
+ */
+inline bool large_tiles(size_t c1, size_t c2) {
+    return c1 >= winograd_large_tile_min && c2 >= winograd_large_tile_min;
+}
+
+/*!
+ * \brief Compute a 4D convolution of input and kernel into conv, with
+ * the Winograd algorithm.
+ *
+ * \param input The input, with the input channels in its second dimension
+ * \param kernel The (K, C, 3, 3) kernels
+ * \param conv The output, with the output channels in its second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param flip Indicates if the kernels must be flipped
+ * \param back Indicates if the output channels are along the second dimension of the kernels
+ */
+template <typename I, typename K, typename C>
+void conv4(const I& input, const K& kernel, C&& conv, size_t p1, size_t p2, bool flip, bool back) {
+    using T = value_t<I>;
+
+    const size_t N  = etl::dim<0>(input);
+    const size_t Ci = etl::dim<1>(input);
+    const size_t Co = etl::dim<1>(conv);
+
+    const size_t n1 = etl::dim<2>(input);
+    const size_t n2 = etl::dim<3>(input);
+
+    const size_t c1 = etl::dim<2>(conv);
+    const size_t c2 = etl::dim<3>(conv);
+
+    if (!N || !Ci || !Co) {
+        conv = T(0);
+        return;
+    }
+
+    input.ensure_cpu_up_to_date();
+    kernel.ensure_cpu_up_to_date();
+
+    if (large_tiles(c1, c2)) {
+        auto u = etl::allocate<T>(transform<4>::alpha * transform<4>::alpha * Co * Ci);
+
+        transform_kernels<4>(kernel.memory_start(), etl::dim<0>(kernel), etl::dim<1>(kernel), u.get(), flip, back);
+
+        conv4_kernel<4>(input.memory_start(), u.get(), conv.memory_start(), N, Ci, Co, n1, n2, c1, c2, p1, p2);
+    } else {
+        auto u = etl::allocate<T>(transform<2>::alpha * transform<2>::alpha * Co * Ci);
+
+        transform_kernels<2>(kernel.memory_start(), etl::dim<0>(kernel), etl::dim<1>(kernel), u.get(), flip, back);
+
+        conv4_kernel<2>(input.memory_start(), u.get(), conv.memory_start(), N, Ci, Co, n1, n2, c1, c2, p1, p2);
+    }
+
+    conv.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute a 4D valid convolution of input into conv, with the
+ * Winograd algorithm and kernels that have already been transformed.
+ *
+ * \param input The input, with the input channels in its second dimension
+ * \param u2 The kernels transformed by transform_kernels<2>
+ * \param u4 The kernels transformed by transform_kernels<4>
+ * \param conv The output, with the output channels in its second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I, typename U, typename C>
+void conv4_transformed(const I& input, const U& u2, const U& u4, C&& conv, size_t p1, size_t p2) {
+    using T = value_t<I>;
+
+    const size_t N  = etl::dim<0>(input);
+    const size_t Ci = etl::dim<1>(input);
+    const size_t Co = etl::dim<1>(conv);
+
+    const size_t n1 = etl::dim<2>(input);
+    const size_t n2 = etl::dim<3>(input);
+
+    const size_t c1 = etl::dim<2>(conv);
+    const size_t c2 = etl::dim<3>(conv);
+
+    if (!N || !Ci || !Co) {
+        conv = T(0);
+        return;
+    }
+
+    input.ensure_cpu_up_to_date();
+
+    if (large_tiles(c1, c2)) {
+        conv4_kernel<4>(input.memory_start(), u4.memory_start(), conv.memory_start(), N, Ci, Co, n1, n2, c1, c2, p1, p2);
+    } else {
+        conv4_kernel<2>(input.memory_start(), u2.memory_start(), conv.memory_start(), N, Ci, Co, n1, n2, c1, c2, p1, p2);
+    }
+
+    conv.invalidate_gpu();
+}
+
+/*!
+ * \brief Indicates if the Winograd algorithm can be used for the given
+ * convolution
+ * \param kernel The kernel
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \return true if the Winograd convolution can be used, false otherwise
+ */
+template <typename K>
+bool supported(const K& kernel, size_t s1, size_t s2) {
+    return etl::dim<2>(kernel) == 3 && etl::dim<3>(kernel) == 3 && s1 == 1 && s2 == 1;
+}
+
+} //end of namespace winograd
+
+/*!
+ * \brief Compute a 4D valid convolution with the Winograd algorithm.
+ *
+ * Convolutions that are not 3x3 with unit strides are delegated to the
+ * BLAS implementation when it is enabled or to the vectorized matrix
+ * multiplication implementation otherwise.
+ *
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_enable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    if (winograd::supported(kernel, s1, s2)) {
+        winograd::conv4(input, kernel, conv, p1, p2, true, false);
+    } else if (cblas_enabled) {
+        impl::blas::blas_conv4_valid(input, kernel, conv, s1, s2, p1, p2);
+    } else {
+        blas_conv4_valid(input, kernel, conv, s1, s2, p1, p2);
+    }
+}
+
+/*!
+ * \brief Compute a 4D valid convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix, with flipped kernels
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_enable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    if (winograd::supported(kernel, s1, s2)) {
+        winograd::conv4(input, kernel, conv, p1, p2, false, false);
+    } else if (cblas_enabled) {
+        impl::blas::blas_conv4_valid_flipped(input, kernel, conv, s1, s2, p1, p2);
+    } else {
+        blas_conv4_valid_flipped(input, kernel, conv, s1, s2, p1, p2);
+    }
+}
+
+/*!
+ * \brief Compute a 4D valid backward convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_enable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_valid_back(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    if (winograd::supported(kernel, s1, s2)) {
+        winograd::conv4(input, kernel, conv, p1, p2, true, true);
+    } else if (cblas_enabled) {
+        impl::blas::blas_conv4_valid_back(input, kernel, conv, s1, s2, p1, p2);
+    } else {
+        blas_conv4_valid_back(input, kernel, conv, s1, s2, p1, p2);
+    }
+}
+
+/*!
+ * \brief Compute a 4D valid backward convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix, with flipped kernels
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_enable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_valid_back_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    if (winograd::supported(kernel, s1, s2)) {
+        winograd::conv4(input, kernel, conv, p1, p2, false, true);
+    } else if (cblas_enabled) {
+        impl::blas::blas_conv4_valid_back_flipped(input, kernel, conv, s1, s2, p1, p2);
+    } else {
+        blas_conv4_valid_back_flipped(input, kernel, conv, s1, s2, p1, p2);
+    }
+}
+
+/*!
+ * \brief Compute a 4D valid convolution with the Winograd algorithm and
+ * kernels that have already been transformed.
+ *
+ * The kernels must be 3x3 and the strides must be 1.
+ *
+ * \param input The input matrix
+ * \param u2 The kernels transformed by transform_kernels<2>
+ * \param u4 The kernels transformed by transform_kernels<4>
+ * \param conv The output matrix
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename U_T, typename C_T, cpp_enable_iff(winograd_possible<I_T, U_T, C_T>)>
+void winograd_conv4_valid_transformed(I_T&& input, const U_T& u2, const U_T& u4, C_T&& conv, size_t p1, size_t p2) {
+    winograd::conv4_transformed(input, u2, u4, conv, p1, p2);
+}
+
+/*!
+ * \brief Compute a 4D full convolution with the Winograd algorithm.
+ *
+ * The full convolution is computed as a valid backward convolution of the
+ * input padded by two elements on each side.
+ *
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_enable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_full(I_T&& input, K_T&& kernel, C_T&& conv) {
+    if (winograd::supported(kernel, 1, 1)) {
+        winograd::conv4(input, kernel, conv, 2, 2, true, true);
+    } else {
+        conv4_full(input, kernel, conv);
+    }
+}
+
+/*!
+ * \brief Compute a 4D full convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix, with flipped kernels
+ * \param conv The output matrix
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_enable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_full_flipped(I_T&& input, K_T&& kernel, C_T&& conv) {
+    if (winograd::supported(kernel, 1, 1)) {
+        winograd::conv4(input, kernel, conv, 2, 2, false, true);
+    } else {
+        conv4_full_flipped(input, kernel, conv);
+    }
+}
+
+//COVERAGE_EXCLUDE_BEGIN
+
+/*!
+ * \brief Compute a 4D valid convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_disable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_unused(input);
+    cpp_unused(kernel);
+    cpp_unused(conv);
+    cpp_unused(s1);
+    cpp_unused(s2);
+    cpp_unused(p1);
+    cpp_unused(p2);
+
+    cpp_unreachable("Invalid call to vec::winograd_conv4_valid");
+}
+
+/*!
+ * \brief Compute a 4D valid convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix, with flipped kernels
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_disable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_unused(input);
+    cpp_unused(kernel);
+    cpp_unused(conv);
+    cpp_unused(s1);
+    cpp_unused(s2);
+    cpp_unused(p1);
+    cpp_unused(p2);
+
+    cpp_unreachable("Invalid call to vec::winograd_conv4_valid_flipped");
+}
+
+/*!
+ * \brief Compute a 4D valid backward convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_disable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_valid_back(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_unused(input);
+    cpp_unused(kernel);
+    cpp_unused(conv);
+    cpp_unused(s1);
+    cpp_unused(s2);
+    cpp_unused(p1);
+    cpp_unused(p2);
+
+    cpp_unreachable("Invalid call to vec::winograd_conv4_valid_back");
+}
+
+/*!
+ * \brief Compute a 4D valid backward convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix, with flipped kernels
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_disable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_valid_back_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_unused(input);
+    cpp_unused(kernel);
+    cpp_unused(conv);
+    cpp_unused(s1);
+    cpp_unused(s2);
+    cpp_unused(p1);
+    cpp_unused(p2);
+
+    cpp_unreachable("Invalid call to vec::winograd_conv4_valid_back_flipped");
+}
+
+/*!
+ * \brief Compute a 4D valid convolution with the Winograd algorithm and
+ * kernels that have already been transformed.
+ * \param input The input matrix
+ * \param u2 The kernels transformed by transform_kernels<2>
+ * \param u4 The kernels transformed by transform_kernels<4>
+ * \param conv The output matrix
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename U_T, typename C_T, cpp_disable_iff(winograd_possible<I_T, U_T, C_T>)>
+void winograd_conv4_valid_transformed(I_T&& input, const U_T& u2, const U_T& u4, C_T&& conv, size_t p1, size_t p2) {
+    cpp_unused(input);
+    cpp_unused(u2);
+    cpp_unused(u4);
+    cpp_unused(conv);
+    cpp_unused(p1);
+    cpp_unused(p2);
+
+    cpp_unreachable("Invalid call to vec::winograd_conv4_valid_transformed");
+}
+
+/*!
+ * \brief Compute a 4D full convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_disable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_full(I_T&& input, K_T&& kernel, C_T&& conv) {
+    cpp_unused(input);
+    cpp_unused(kernel);
+    cpp_unused(conv);
+
+    cpp_unreachable("Invalid call to vec::winograd_conv4_full");
+}
+
+/*!
+ * \brief Compute a 4D full convolution with the Winograd algorithm.
+ * \param input The input matrix
+ * \param kernel The kernel matrix, with flipped kernels
+ * \param conv The output matrix
+ */
+template <typename I_T, typename K_T, typename C_T, cpp_disable_iff(winograd_possible<I_T, K_T, C_T>)>
+void winograd_conv4_full_flipped(I_T&& input, K_T&& kernel, C_T&& conv) {
+    cpp_unused(input);
+    cpp_unused(kernel);
+    cpp_unused(conv);
+
+    cpp_unreachable("Invalid call to vec::winograd_conv4_full_flipped");
+}
+
+//COVERAGE_EXCLUDE_END
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -132,19 +132,69 @@ value_t<L> dot_impl(const L& lhs, const R& rhs) {
     return p1 + p2;
 }
 
+/*!
+ * \brief Compute the dot product of a and b on a single thread
+ * \param lhs The lhs expression
+ * \param rhs The rhs expression
+ * \return the dot product
+ */
+template <typename L, typename R, cpp_disable_iff(runtime_dispatch && all_dma<L, R> && all_floating<L, R> && std::is_same<value_t<L>, value_t<R>>::value)>
+value_t<L> dot_kernel(const L& lhs, const R& rhs) {
+    // The default vectorization scheme should be sufficient
+    return dot_impl<default_vec>(lhs, rhs);
+}
+
+/*!
+ * \brief Compute the dot product of a and b on a single thread, using the
+ * runtime dispatched kernel if the CPU supports wider vectors than the
+ * compiled ones.
+ * \param lhs The lhs expression
+ * \param rhs The rhs expression
+ * \return the dot product
+ */
+template <typename L, typename R, cpp_enable_iff(runtime_dispatch && all_dma<L, R> && all_floating<L, R> && std::is_same<value_t<L>, value_t<R>>::value)>
+value_t<L> dot_kernel(const L& lhs, const R& rhs) {
+    if (runtime_vector_wider()) {
+        return etl::detail::dispatch_dot(lhs.memory_start(), rhs.memory_start(), etl::size(lhs));
+    }
+
+    return dot_impl<default_vec>(lhs, rhs);
+}
+
 /*!
  * \brief Compute the dot product of a and b
+ *
+ * Large products are split in blocks computed in parallel, the partial
+ * products being summed at the end.
+ *
  * \param lhs The lhs expression
  * \param rhs The rhs expression
  * \return the dot product
  */
 template <typename L, typename R>
 value_t<L> dot(const L& lhs, const R& rhs) {
+    using T = value_t<L>;
+
     lhs.ensure_cpu_up_to_date();
     rhs.ensure_cpu_up_to_date();
 
-    // The default vectorization scheme should be sufficient
-    return dot_impl<default_vec>(lhs, rhs);
+    if (etl::size(lhs) < vec_sum_parallel_threshold) {
+        return dot_kernel(lhs, rhs);
+    }
+
+    T acc(0);
+
+    auto acc_functor = [&acc](T value) {
+        acc += value;
+    };
+
+    auto batch_fun = [&lhs, &rhs](size_t first, size_t last) {
+        return dot_kernel(memory_slice<unaligned>(lhs, first, last), memory_slice<unaligned>(rhs, first, last));
+    };
+
+    engine_dispatch_1d_acc<T>(batch_fun, acc_functor, 0, etl::size(lhs), vec_sum_parallel_threshold);
+
+    return acc;
 }
 
 } //end of namespace vec
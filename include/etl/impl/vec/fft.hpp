@@ -0,0 +1,1027 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the FFT for power of two sizes
+ *
+ * The transforms are computed with the Stockham auto-sort algorithm,
+ * with radix-8, radix-4 and radix-2 stages. Each stage reads and writes
+ * contiguous blocks of complex numbers, which are processed one vector
+ * of complex numbers at once. The other sizes are computed with the
+ * standard implementation.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+namespace detail {
+
+/*!
+ * \brief Scalar operations on complex numbers, with the same interface
+ * as the vectorization types. Used for the stages whose blocks are
+ * smaller than a vector.
+ */
+struct fft_scalar_ops {
+    /*!
+     * \brief The traits of the type
+     */
+    template <typename T>
+    struct traits {
+        static constexpr size_t size = 1; ///< Numbers of elements done at once
+    };
+
+    /*!
+     * \brief Load a value from memory
+     * \param memory The memory to load from
+     * \return the loaded value
+     */
+    template <typename T>
+    static etl::complex<T> loadu(const etl::complex<T>* memory) {
+        return *memory;
+    }
+
+    /*!
+     * \brief Store a value to memory
+     * \param memory The memory to store to
+     * \param value The value to store
+     */
+    template <typename T>
+    static void storeu(etl::complex<T>* memory, etl::complex<T> value) {
+        *memory = value;
+    }
+
+    /*!
+     * \brief Returns the given value
+     * \param value The value
+     * \return value
+     */
+    template <typename T>
+    static etl::complex<T> set(etl::complex<T> value) {
+        return value;
+    }
+
+    /*!
+     * \brief Returns lhs + rhs
+     */
+    template <typename T>
+    static etl::complex<T> add(etl::complex<T> lhs, etl::complex<T> rhs) {
+        return lhs + rhs;
+    }
+
+    /*!
+     * \brief Returns lhs - rhs
+     */
+    template <typename T>
+    static etl::complex<T> sub(etl::complex<T> lhs, etl::complex<T> rhs) {
+        return lhs - rhs;
+    }
+
+    /*!
+     * \brief Returns lhs * rhs
+     */
+    template <typename T>
+    static etl::complex<T> mul(etl::complex<T> lhs, etl::complex<T> rhs) {
+        return lhs * rhs;
+    }
+};
+
+/*!
+ * \brief Precomputed data for the vectorized FFT of a power of two size.
+ *
+ * The stage s of radix R and input block size Ns needs the twiddle
+ * factors exp(-2 i pi r k / (R Ns)) for 1 <= r < R and k < Ns. They
+ * are stored contiguously in k, one block of Ns factors for each r.
+ */
+template <typename T>
+struct fft_vec_plan {
+    size_t n;                                                        ///< The size of the transform
+    size_t radix[etl::impl::standard::detail::MAX_FACTORS];          ///< The radix of each stage
+    size_t twiddle_offset[etl::impl::standard::detail::MAX_FACTORS]; ///< The offset of the twiddle factors of each stage
+    size_t n_stages = 0;                                             ///< The number of stages
+
+    std::unique_ptr<etl::complex<T>[]> twiddle; ///< The twiddle factors of all the stages
+
+    /*!
+     * \brief Compute the plan of the FFT of size n
+     * \param size The size of the transform, must be a power of two
+     */
+    explicit fft_vec_plan(size_t size) : n(size) {
+        size_t log = 0;
+        while ((size_t(1) << log) < n) {
+            ++log;
+        }
+
+        // Use as many radix-8 stages as possible, a radix-2 stage is only
+        // used for the size 2, otherwise two radix-4 stages are used
+
+        size_t r8 = log / 3;
+
+        if (log % 3 == 1 && r8 > 0) {
+            --r8;
+        }
+
+        for (size_t i = 0; i < r8; ++i) {
+            radix[n_stages++] = 8;
+        }
+
+        size_t rest = log - 3 * r8;
+
+        for (; rest >= 2; rest -= 2) {
+            radix[n_stages++] = 4;
+        }
+
+        if (rest == 1) {
+            radix[n_stages++] = 2;
+        }
+
+        twiddle = etl::allocate<etl::complex<T>>(std::max(n, size_t(1)));
+
+        size_t t  = 0;
+        size_t ns = 1;
+
+        for (size_t s = 0; s < n_stages; ++s) {
+            const size_t R = radix[s];
+
+            twiddle_offset[s] = t;
+
+            for (size_t r = 1; r < R; ++r) {
+                for (size_t k = 0; k < ns; ++k) {
+                    const double theta = -2.0 * M_PI * double(r * k) / double(R * ns);
+
+                    twiddle[t++] = etl::complex<T>{T(std::cos(theta)), T(std::sin(theta))};
+                }
+            }
+
+            ns *= R;
+        }
+    }
+};
+
+/*!
+ * \brief Returns the plan of the vectorized FFT of size n.
+ * \param n The size of the transform
+ * \return the plan of the vectorized FFT of size n
+ */
+template <typename T>
+std::shared_ptr<const fft_vec_plan<T>> get_fft_vec_plan(size_t n) {
+    return etl::impl::standard::detail::get_cached_plan<fft_vec_plan<T>>(n);
+}
+
+/*!
+ * \brief Radix-4 butterfly, computes the 4-point DFT of t0, t1, t2, t3 in place
+ * \param neg_i The vector of -i
+ * \tparam O The operations (vectorization type)
+ */
+template <typename O, typename VT>
+ETL_STRONG_INLINE(void) fft_butterfly4(VT& t0, VT& t1, VT& t2, VT& t3, VT neg_i) {
+    auto a0 = O::add(t0, t2);
+    auto a1 = O::sub(t0, t2);
+    auto a2 = O::add(t1, t3);
+    auto a3 = O::mul(O::sub(t1, t3), neg_i);
+
+    t0 = O::add(a0, a2);
+    t1 = O::add(a1, a3);
+    t2 = O::sub(a0, a2);
+    t3 = O::sub(a1, a3);
+}
+
+/*!
+ * \brief Radix-8 butterfly, computes the 8-point DFT of t0 ... t7 in place
+ * \param neg_i The vector of -i
+ * \param w1 The vector of exp(-i pi / 4)
+ * \param w3 The vector of exp(-3 i pi / 4)
+ * \tparam O The operations (vectorization type)
+ */
+template <typename O, typename VT>
+ETL_STRONG_INLINE(void) fft_butterfly8(VT& t0, VT& t1, VT& t2, VT& t3, VT& t4, VT& t5, VT& t6, VT& t7, VT neg_i, VT w1, VT w3) {
+    // 4-point transforms of the even and of the odd inputs
+
+    fft_butterfly4<O>(t0, t2, t4, t6, neg_i);
+    fft_butterfly4<O>(t1, t3, t5, t7, neg_i);
+
+    auto o0 = t1;
+    auto o1 = O::mul(t3, w1);
+    auto o2 = O::mul(t5, neg_i);
+    auto o3 = O::mul(t7, w3);
+
+    auto e0 = t0;
+    auto e1 = t2;
+    auto e2 = t4;
+    auto e3 = t6;
+
+    t0 = O::add(e0, o0);
+    t1 = O::add(e1, o1);
+    t2 = O::add(e2, o2);
+    t3 = O::add(e3, o3);
+    t4 = O::sub(e0, o0);
+    t5 = O::sub(e1, o1);
+    t6 = O::sub(e2, o2);
+    t7 = O::sub(e3, o3);
+}
+
+/*!
+ * \brief Radix-2 stage of the Stockham FFT
+ * \param x The input of the stage
+ * \param y The output of the stage
+ * \param n The size of the transform
+ * \param ns The size of the blocks already transformed
+ * \param tw The twiddle factors of the stage
+ * \tparam O The operations (vectorization type)
+ */
+template <typename O, typename T>
+void fft_radix2_stage(const etl::complex<T>* x, etl::complex<T>* y, size_t n, size_t ns, const etl::complex<T>* tw) {
+    static constexpr size_t vec_size = O::template traits<etl::complex<T>>::size;
+
+    const size_t m = n / 2;
+
+    for (size_t b = 0; b < m; b += ns) {
+        auto* yy = y + 2 * b;
+
+        for (size_t k = 0; k < ns; k += vec_size) {
+            auto t0 = O::loadu(x + b + k);
+            auto t1 = O::mul(O::loadu(x + b + k + m), O::loadu(tw + k));
+
+            O::storeu(yy + k, O::add(t0, t1));
+            O::storeu(yy + k + ns, O::sub(t0, t1));
+        }
+    }
+}
+
+/*!
+ * \brief Radix-4 stage of the Stockham FFT
+ * \param x The input of the stage
+ * \param y The output of the stage
+ * \param n The size of the transform
+ * \param ns The size of the blocks already transformed
+ * \param tw The twiddle factors of the stage
+ * \tparam O The operations (vectorization type)
+ */
+template <typename O, typename T>
+void fft_radix4_stage(const etl::complex<T>* x, etl::complex<T>* y, size_t n, size_t ns, const etl::complex<T>* tw) {
+    static constexpr size_t vec_size = O::template traits<etl::complex<T>>::size;
+
+    const size_t m = n / 4;
+
+    const auto neg_i = O::set(etl::complex<T>(T(0), T(-1)));
+
+    for (size_t b = 0; b < m; b += ns) {
+        auto* yy = y + 4 * b;
+
+        for (size_t k = 0; k < ns; k += vec_size) {
+            auto t0 = O::loadu(x + b + k);
+            auto t1 = O::mul(O::loadu(x + b + k + 1 * m), O::loadu(tw + 0 * ns + k));
+            auto t2 = O::mul(O::loadu(x + b + k + 2 * m), O::loadu(tw + 1 * ns + k));
+            auto t3 = O::mul(O::loadu(x + b + k + 3 * m), O::loadu(tw + 2 * ns + k));
+
+            fft_butterfly4<O>(t0, t1, t2, t3, neg_i);
+
+            O::storeu(yy + k + 0 * ns, t0);
+            O::storeu(yy + k + 1 * ns, t1);
+            O::storeu(yy + k + 2 * ns, t2);
+            O::storeu(yy + k + 3 * ns, t3);
+        }
+    }
+}
+
+/*!
+ * \brief Radix-8 stage of the Stockham FFT
+ * \param x The input of the stage
+ * \param y The output of the stage
+ * \param n The size of the transform
+ * \param ns The size of the blocks already transformed
+ * \param tw The twiddle factors of the stage
+ * \tparam O The operations (vectorization type)
+ */
+template <typename O, typename T>
+void fft_radix8_stage(const etl::complex<T>* x, etl::complex<T>* y, size_t n, size_t ns, const etl::complex<T>* tw) {
+    static constexpr size_t vec_size = O::template traits<etl::complex<T>>::size;
+
+    const size_t m = n / 8;
+
+    const T h = T(0.70710678118654752440);
+
+    const auto neg_i = O::set(etl::complex<T>(T(0), T(-1)));
+    const auto w1    = O::set(etl::complex<T>(h, -h));
+    const auto w3    = O::set(etl::complex<T>(-h, -h));
+
+    for (size_t b = 0; b < m; b += ns) {
+        auto* yy = y + 8 * b;
+
+        for (size_t k = 0; k < ns; k += vec_size) {
+            auto t0 = O::loadu(x + b + k);
+            auto t1 = O::mul(O::loadu(x + b + k + 1 * m), O::loadu(tw + 0 * ns + k));
+            auto t2 = O::mul(O::loadu(x + b + k + 2 * m), O::loadu(tw + 1 * ns + k));
+            auto t3 = O::mul(O::loadu(x + b + k + 3 * m), O::loadu(tw + 2 * ns + k));
+            auto t4 = O::mul(O::loadu(x + b + k + 4 * m), O::loadu(tw + 3 * ns + k));
+            auto t5 = O::mul(O::loadu(x + b + k + 5 * m), O::loadu(tw + 4 * ns + k));
+            auto t6 = O::mul(O::loadu(x + b + k + 6 * m), O::loadu(tw + 5 * ns + k));
+            auto t7 = O::mul(O::loadu(x + b + k + 7 * m), O::loadu(tw + 6 * ns + k));
+
+            fft_butterfly8<O>(t0, t1, t2, t3, t4, t5, t6, t7, neg_i, w1, w3);
+
+            O::storeu(yy + k + 0 * ns, t0);
+            O::storeu(yy + k + 1 * ns, t1);
+            O::storeu(yy + k + 2 * ns, t2);
+            O::storeu(yy + k + 3 * ns, t3);
+            O::storeu(yy + k + 4 * ns, t4);
+            O::storeu(yy + k + 5 * ns, t5);
+            O::storeu(yy + k + 6 * ns, t6);
+            O::storeu(yy + k + 7 * ns, t7);
+        }
+    }
+}
+
+/*!
+ * \brief Perform one stage of the Stockham FFT, vectorized when the
+ * blocks are at least as large as a vector
+ * \param x The input of the stage
+ * \param y The output of the stage
+ * \param n The size of the transform
+ * \param ns The size of the blocks already transformed
+ * \param radix The radix of the stage
+ * \param tw The twiddle factors of the stage
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void fft_stage(const etl::complex<T>* x, etl::complex<T>* y, size_t n, size_t ns, size_t radix, const etl::complex<T>* tw) {
+    using intrinsic_traits = typename V::template traits<etl::complex<T>>;
+
+    if (intrinsic_traits::vectorizable && ns % intrinsic_traits::size == 0) {
+        if (radix == 8) {
+            fft_radix8_stage<V>(x, y, n, ns, tw);
+        } else if (radix == 4) {
+            fft_radix4_stage<V>(x, y, n, ns, tw);
+        } else {
+            fft_radix2_stage<V>(x, y, n, ns, tw);
+        }
+    } else {
+        if (radix == 8) {
+            fft_radix8_stage<fft_scalar_ops>(x, y, n, ns, tw);
+        } else if (radix == 4) {
+            fft_radix4_stage<fft_scalar_ops>(x, y, n, ns, tw);
+        } else {
+            fft_radix2_stage<fft_scalar_ops>(x, y, n, ns, tw);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the FFT of a power of two size with the Stockham
+ * algorithm.
+ *
+ * The input and the output can be the same memory.
+ *
+ * \param in The input signal
+ * \param out The output signal
+ * \param work A temporary buffer of the size of the transform
+ * \param plan The plan of the transform
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void fft_stockham(const etl::complex<T>* in, etl::complex<T>* out, etl::complex<T>* work, const fft_vec_plan<T>& plan) {
+    const size_t n = plan.n;
+    const size_t S = plan.n_stages;
+
+    const etl::complex<T>* x = in;
+
+    // The stages alternate between out and work and must end in out
+    if (in == out && S % 2 == 1) {
+        std::copy_n(in, n, work);
+        x = work;
+    } else if (S == 0 && in != out) {
+        std::copy_n(in, n, out);
+    }
+
+    size_t ns = 1;
+
+    for (size_t s = 0; s < S; ++s) {
+        auto* y = (S - 1 - s) % 2 == 0 ? out : work;
+
+        fft_stage<V>(x, y, n, ns, plan.radix[s], plan.twiddle.get() + plan.twiddle_offset[s]);
+
+        x = y;
+        ns *= plan.radix[s];
+    }
+}
+
+/*!
+ * \brief Radix-2 stage of the Stockham FFT of the columns of a strip.
+ *
+ * Each element of the transform is a row of w columns of the strip,
+ * the butterflies are vectorized over the columns.
+ *
+ * \param x The input of the stage
+ * \param ldx The distance between two rows of x
+ * \param y The output of the stage
+ * \param ldy The distance between two rows of y
+ * \param n The size of the transform (number of rows)
+ * \param ns The size of the blocks already transformed
+ * \param tw The twiddle factors of the stage
+ * \param w The number of columns of the strip
+ * \tparam O The operations (vectorization type)
+ */
+template <typename O, typename T>
+void fft_radix2_stage_columns(const etl::complex<T>* x, size_t ldx, etl::complex<T>* y, size_t ldy, size_t n, size_t ns, const etl::complex<T>* tw, size_t w) {
+    static constexpr size_t vec_size = O::template traits<etl::complex<T>>::size;
+
+    const size_t m = n / 2;
+
+    for (size_t b = 0; b < m; b += ns) {
+        for (size_t k = 0; k < ns; ++k) {
+            const auto w1 = O::set(tw[k]);
+
+            const auto* xx = x + (b + k) * ldx;
+            auto* yy       = y + (2 * b + k) * ldy;
+
+            for (size_t c = 0; c < w; c += vec_size) {
+                auto t0 = O::loadu(xx + c);
+                auto t1 = O::mul(O::loadu(xx + m * ldx + c), w1);
+
+                O::storeu(yy + c, O::add(t0, t1));
+                O::storeu(yy + ns * ldy + c, O::sub(t0, t1));
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Radix-4 stage of the Stockham FFT of the columns of a strip.
+ * \copydetails fft_radix2_stage_columns
+ */
+template <typename O, typename T>
+void fft_radix4_stage_columns(const etl::complex<T>* x, size_t ldx, etl::complex<T>* y, size_t ldy, size_t n, size_t ns, const etl::complex<T>* tw, size_t w) {
+    static constexpr size_t vec_size = O::template traits<etl::complex<T>>::size;
+
+    const size_t m = n / 4;
+
+    const auto neg_i = O::set(etl::complex<T>(T(0), T(-1)));
+
+    for (size_t b = 0; b < m; b += ns) {
+        for (size_t k = 0; k < ns; ++k) {
+            const auto w1 = O::set(tw[0 * ns + k]);
+            const auto w2 = O::set(tw[1 * ns + k]);
+            const auto w3 = O::set(tw[2 * ns + k]);
+
+            const auto* xx = x + (b + k) * ldx;
+            auto* yy       = y + (4 * b + k) * ldy;
+
+            for (size_t c = 0; c < w; c += vec_size) {
+                auto t0 = O::loadu(xx + c);
+                auto t1 = O::mul(O::loadu(xx + 1 * m * ldx + c), w1);
+                auto t2 = O::mul(O::loadu(xx + 2 * m * ldx + c), w2);
+                auto t3 = O::mul(O::loadu(xx + 3 * m * ldx + c), w3);
+
+                fft_butterfly4<O>(t0, t1, t2, t3, neg_i);
+
+                O::storeu(yy + 0 * ns * ldy + c, t0);
+                O::storeu(yy + 1 * ns * ldy + c, t1);
+                O::storeu(yy + 2 * ns * ldy + c, t2);
+                O::storeu(yy + 3 * ns * ldy + c, t3);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Radix-8 stage of the Stockham FFT of the columns of a strip.
+ * \copydetails fft_radix2_stage_columns
+ */
+template <typename O, typename T>
+void fft_radix8_stage_columns(const etl::complex<T>* x, size_t ldx, etl::complex<T>* y, size_t ldy, size_t n, size_t ns, const etl::complex<T>* tw, size_t w) {
+    static constexpr size_t vec_size = O::template traits<etl::complex<T>>::size;
+
+    const size_t m = n / 8;
+
+    const T h = T(0.70710678118654752440);
+
+    const auto neg_i = O::set(etl::complex<T>(T(0), T(-1)));
+    const auto c1    = O::set(etl::complex<T>(h, -h));
+    const auto c3    = O::set(etl::complex<T>(-h, -h));
+
+    for (size_t b = 0; b < m; b += ns) {
+        for (size_t k = 0; k < ns; ++k) {
+            const auto w1 = O::set(tw[0 * ns + k]);
+            const auto w2 = O::set(tw[1 * ns + k]);
+            const auto w3 = O::set(tw[2 * ns + k]);
+            const auto w4 = O::set(tw[3 * ns + k]);
+            const auto w5 = O::set(tw[4 * ns + k]);
+            const auto w6 = O::set(tw[5 * ns + k]);
+            const auto w7 = O::set(tw[6 * ns + k]);
+
+            const auto* xx = x + (b + k) * ldx;
+            auto* yy       = y + (8 * b + k) * ldy;
+
+            for (size_t c = 0; c < w; c += vec_size) {
+                auto t0 = O::loadu(xx + c);
+                auto t1 = O::mul(O::loadu(xx + 1 * m * ldx + c), w1);
+                auto t2 = O::mul(O::loadu(xx + 2 * m * ldx + c), w2);
+                auto t3 = O::mul(O::loadu(xx + 3 * m * ldx + c), w3);
+                auto t4 = O::mul(O::loadu(xx + 4 * m * ldx + c), w4);
+                auto t5 = O::mul(O::loadu(xx + 5 * m * ldx + c), w5);
+                auto t6 = O::mul(O::loadu(xx + 6 * m * ldx + c), w6);
+                auto t7 = O::mul(O::loadu(xx + 7 * m * ldx + c), w7);
+
+                fft_butterfly8<O>(t0, t1, t2, t3, t4, t5, t6, t7, neg_i, c1, c3);
+
+                O::storeu(yy + 0 * ns * ldy + c, t0);
+                O::storeu(yy + 1 * ns * ldy + c, t1);
+                O::storeu(yy + 2 * ns * ldy + c, t2);
+                O::storeu(yy + 3 * ns * ldy + c, t3);
+                O::storeu(yy + 4 * ns * ldy + c, t4);
+                O::storeu(yy + 5 * ns * ldy + c, t5);
+                O::storeu(yy + 6 * ns * ldy + c, t6);
+                O::storeu(yy + 7 * ns * ldy + c, t7);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Perform one stage of the Stockham FFT of the columns of a
+ * strip, vectorized over the columns when the strip is a multiple of the
+ * vector size
+ * \param x The input of the stage
+ * \param ldx The distance between two rows of x
+ * \param y The output of the stage
+ * \param ldy The distance between two rows of y
+ * \param n The size of the transform (number of rows)
+ * \param ns The size of the blocks already transformed
+ * \param radix The radix of the stage
+ * \param tw The twiddle factors of the stage
+ * \param w The number of columns of the strip
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void fft_stage_columns(const etl::complex<T>* x, size_t ldx, etl::complex<T>* y, size_t ldy, size_t n, size_t ns, size_t radix, const etl::complex<T>* tw, size_t w) {
+    using intrinsic_traits = typename V::template traits<etl::complex<T>>;
+
+    if (intrinsic_traits::vectorizable && w % intrinsic_traits::size == 0) {
+        if (radix == 8) {
+            fft_radix8_stage_columns<V>(x, ldx, y, ldy, n, ns, tw, w);
+        } else if (radix == 4) {
+            fft_radix4_stage_columns<V>(x, ldx, y, ldy, n, ns, tw, w);
+        } else {
+            fft_radix2_stage_columns<V>(x, ldx, y, ldy, n, ns, tw, w);
+        }
+    } else {
+        if (radix == 8) {
+            fft_radix8_stage_columns<fft_scalar_ops>(x, ldx, y, ldy, n, ns, tw, w);
+        } else if (radix == 4) {
+            fft_radix4_stage_columns<fft_scalar_ops>(x, ldx, y, ldy, n, ns, tw, w);
+        } else {
+            fft_radix2_stage_columns<fft_scalar_ops>(x, ldx, y, ldy, n, ns, tw, w);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the FFT of the w columns of a strip of a row-major
+ * matrix, in place, with the Stockham algorithm.
+ *
+ * The stages alternate between the strip and a work buffer of n x w
+ * elements.
+ *
+ * \param x The first element of the strip
+ * \param ld The distance between two rows of the matrix
+ * \param w The number of columns of the strip
+ * \param work A temporary buffer of n x w elements
+ * \param plan The plan of the transform (of the size of the columns)
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void fft_stockham_columns(etl::complex<T>* x, size_t ld, size_t w, etl::complex<T>* work, const fft_vec_plan<T>& plan) {
+    const size_t n = plan.n;
+    const size_t S = plan.n_stages;
+
+    const etl::complex<T>* in = x;
+    size_t ld_in              = ld;
+
+    // The stages must end in the strip
+    if (S % 2 == 1) {
+        for (size_t i = 0; i < n; ++i) {
+            std::copy_n(x + i * ld, w, work + i * w);
+        }
+
+        in    = work;
+        ld_in = w;
+    }
+
+    size_t ns = 1;
+
+    for (size_t s = 0; s < S; ++s) {
+        const bool to_strip = (S - 1 - s) % 2 == 0;
+
+        auto* out           = to_strip ? x : work;
+        const size_t ld_out = to_strip ? ld : w;
+
+        fft_stage_columns<V>(in, ld_in, out, ld_out, n, ns, plan.radix[s], plan.twiddle.get() + plan.twiddle_offset[s], w);
+
+        in    = out;
+        ld_in = ld_out;
+        ns *= plan.radix[s];
+    }
+}
+
+/*!
+ * \brief Compute the FFT of each column of batch row-major n1 x n2
+ * matrices, in place.
+ *
+ * The columns are processed in strips of fft2_strip_width columns, the
+ * butterflies being vectorized over the columns of the strip, so that
+ * the full matrices never need to be transposed.
+ *
+ * \param x The matrices
+ * \param batch The number of matrices
+ * \param n1 The number of rows of each matrix
+ * \param n2 The number of columns of each matrix
+ */
+template <typename T>
+void fft_columns_inplace(etl::complex<T>* x, size_t batch, size_t n1, size_t n2) {
+    if (!math::is_power_of_two(n1)) {
+        etl::impl::standard::detail::fft_columns_inplace(x, batch, n1, n2);
+        return;
+    }
+
+    auto plan = get_fft_vec_plan<T>(n1);
+
+    const size_t strips = (n2 + fft2_strip_width - 1) / fft2_strip_width;
+
+    auto strip_fun = [&](const size_t first, const size_t last) {
+        auto work = etl::allocate<etl::complex<T>>(n1 * fft2_strip_width);
+
+        for (size_t t = first; t < last; ++t) {
+            auto* xx = x + (t / strips) * n1 * n2;
+
+            const size_t c0 = (t % strips) * fft2_strip_width;
+            const size_t w  = std::min(fft2_strip_width, n2 - c0);
+
+            fft_stockham_columns<default_vec>(xx + c0, n2, w, work.get(), *plan);
+        }
+    };
+
+    engine_dispatch_1d(strip_fun, 0, batch * strips, engine_select_parallel(batch * n1 * n2, fft2_many_threshold_n) && batch * strips > 1);
+}
+
+/*!
+ * \brief Compute the 2D FFT of batch row-major n1 x n2 matrices, in place
+ * \param x The matrices
+ * \param batch The number of matrices
+ * \param n1 The number of rows of each matrix
+ * \param n2 The number of columns of each matrix
+ */
+template <typename T>
+void fft2_inplace(etl::complex<T>* x, size_t batch, size_t n1, size_t n2) {
+    const size_t rows = batch * n1;
+
+    if (math::is_power_of_two(n2)) {
+        auto plan = get_fft_vec_plan<T>(n2);
+
+        auto batch_fun_b = [&](const size_t first, const size_t last) {
+            auto work = etl::allocate<etl::complex<T>>(n2);
+
+            for (size_t i = first; i < last; ++i) {
+                fft_stockham<default_vec>(x + i * n2, x + i * n2, work.get(), *plan);
+            }
+        };
+
+        engine_dispatch_1d(batch_fun_b, 0, rows, 8UL);
+    } else {
+        etl::impl::standard::detail::fft_n_many(x, x, rows, n2);
+    }
+
+    fft_columns_inplace(x, batch, n1, n2);
+}
+
+/*!
+ * \brief Kernel for 1D FFT.
+ * \param a The input signal
+ * \param n The size of the tranform
+ * \param c The output signal
+ */
+template <typename T1, typename T>
+void fft1_kernel(const T1* a, size_t n, std::complex<T>* c) {
+    if (math::is_power_of_two(n)) {
+        auto plan = get_fft_vec_plan<T>(n);
+        auto work = etl::allocate<etl::complex<T>>(n);
+
+        auto* cc = reinterpret_cast<etl::complex<T>*>(c);
+
+        if /*constexpr*/ (is_complex_t<T1>) {
+            fft_stockham<default_vec>(reinterpret_cast<const etl::complex<T>*>(a), cc, work.get(), *plan);
+        } else {
+            std::copy_n(a, n, c);
+            fft_stockham<default_vec>(cc, cc, work.get(), *plan);
+        }
+    } else {
+        etl::impl::standard::detail::fft1_kernel(a, n, c);
+    }
+}
+
+/*!
+ * \brief Kernel for Inverse 1D FFT.
+ * \param a The input signal
+ * \param n The size of the tranform
+ * \param c The output signal
+ */
+template <typename T>
+void ifft1_kernel(const std::complex<T>* a, size_t n, std::complex<T>* c) {
+    if (math::is_power_of_two(n)) {
+        auto plan = get_fft_vec_plan<T>(n);
+        auto work = etl::allocate<etl::complex<T>>(n);
+
+        //Conjugate the complex numbers
+        for (size_t i = 0; i < n; ++i) {
+            c[i] = std::conj(a[i]);
+        }
+
+        auto* cc = reinterpret_cast<etl::complex<T>*>(c);
+        fft_stockham<default_vec>(cc, cc, work.get(), *plan);
+
+        //Conjugate the complex numbers again and scale them
+        for (size_t i = 0; i < n; ++i) {
+            c[i] = std::conj(c[i]) / T(n);
+        }
+    } else {
+        etl::impl::standard::detail::ifft1_kernel(a, n, c);
+    }
+}
+
+/*!
+ * \brief Perform many 1D FFT on a and store the result in c
+ * \param a The input signals
+ * \param c The output signals
+ * \param batch The number of transforms
+ * \param n The size of the transform
+ */
+template <typename A, typename C>
+void fft1_many_kernel(const A* a, C* c, size_t batch, size_t n) {
+    using T = typename C::value_type;
+
+    if (math::is_power_of_two(n)) {
+        auto plan = get_fft_vec_plan<T>(n);
+
+        auto batch_fun_b = [&](const size_t first, const size_t last) {
+            auto work = etl::allocate<etl::complex<T>>(n);
+
+            for (size_t i = first; i < last; ++i) {
+                auto* cc = reinterpret_cast<etl::complex<T>*>(c + i * n);
+
+                if /*constexpr*/ (is_complex_t<A>) {
+                    fft_stockham<default_vec>(reinterpret_cast<const etl::complex<T>*>(a + i * n), cc, work.get(), *plan);
+                } else {
+                    std::copy_n(a + i * n, n, c + i * n);
+                    fft_stockham<default_vec>(cc, cc, work.get(), *plan);
+                }
+            }
+        };
+
+        engine_dispatch_1d(batch_fun_b, 0, batch, 8UL);
+    } else {
+        etl::impl::standard::fft1_many_kernel(a, c, batch, n);
+    }
+}
+
+/*!
+ * \brief Perform many 1D Inverse FFT on a and store the result in c
+ * \param a The input signals
+ * \param c The output signals
+ * \param batch The number of transforms
+ * \param n The size of the transform
+ */
+template <typename T>
+void ifft1_many_kernel(const std::complex<T>* a, std::complex<T>* c, size_t batch, size_t n) {
+    auto batch_fun_b = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            ifft1_kernel(a + i * n, n, c + i * n);
+        }
+    };
+
+    engine_dispatch_1d(batch_fun_b, 0, batch, 8UL);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Perform the 1D FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void fft1(A&& a, C&& c) {
+    a.ensure_cpu_up_to_date();
+
+    detail::fft1_kernel(a.memory_start(), etl::size(a), c.memory_start());
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform the 1D Inverse FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void ifft1(A&& a, C&& c) {
+    a.ensure_cpu_up_to_date();
+
+    detail::ifft1_kernel(a.memory_start(), etl::size(a), c.memory_start());
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform many 1D Inverse FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression
+ *
+ * The first dimension of a and c are considered batch dimensions
+ */
+template <typename A, typename C>
+void ifft1_many(A&& a, C&& c) {
+    static constexpr size_t N = etl::dimensions<A>();
+
+    a.ensure_cpu_up_to_date();
+
+    auto n     = etl::dim<N - 1>(a); //Size of the transform
+    auto batch = etl::size(a) / n;   //Number of batch
+
+    detail::ifft1_many_kernel(a.memory_start(), c.memory_start(), batch, n);
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform the 1D Inverse FFT on a and store the real part of the result in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void ifft1_real(A&& a, C&& c) {
+    using complex_t = value_t<A>;
+
+    a.ensure_cpu_up_to_date();
+
+    size_t n = etl::size(a);
+
+    auto c_complex = allocate<complex_t>(n);
+    auto cc        = c_complex.get();
+
+    detail::ifft1_kernel(a.memory_start(), n, cc);
+
+    for (size_t i = 0; i < n; ++i) {
+        c[i] = real(cc[i]);
+    }
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform many 1D FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression
+ *
+ * The first dimension of a and c are considered batch dimensions
+ */
+template <typename A, typename C>
+void fft1_many(A&& a, C&& c) {
+    static constexpr size_t N = etl::dimensions<A>();
+
+    a.ensure_cpu_up_to_date();
+
+    auto n     = etl::dim<N - 1>(a); //Size of the transform
+    auto batch = etl::size(a) / n;   //Number of batch
+
+    detail::fft1_many_kernel(a.memory_start(), c.memory_start(), batch, n);
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform the 2D FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void fft2(A&& a, C&& c) {
+    using T = typename value_t<C>::value_type;
+
+    a.ensure_cpu_up_to_date();
+
+    if (reinterpret_cast<const void*>(a.memory_start()) != reinterpret_cast<const void*>(c.memory_start())) {
+        std::copy(a.memory_start(), a.memory_end(), c.memory_start());
+    }
+
+    detail::fft2_inplace(reinterpret_cast<etl::complex<T>*>(c.memory_start()), 1, etl::dim<0>(a), etl::dim<1>(a));
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform the 2D Inverse FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void ifft2(A&& a, C&& c) {
+    using T = typename value_t<C>::value_type;
+
+    size_t n = etl::size(a);
+
+    //Conjugate the complex numbers
+    c = conj(a);
+
+    fft2(c, c);
+
+    //Conjugate the complex numbers again
+    // and scale the numbers
+    c = conj(c) / T(n);
+}
+
+/*!
+ * \brief Perform the 2D Inverse FFT on a and store the real part of the result in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void ifft2_real(A&& a, C&& c) {
+    auto w = etl::force_temporary(a);
+
+    ifft2(a, w);
+
+    c = real(w);
+}
+
+/*!
+ * \brief Perform many 2D FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression
+ *
+ * The first dimension of a and c are considered batch dimensions
+ */
+template <typename A, typename C>
+void fft2_many(A&& a, C&& c) {
+    using T = typename value_t<C>::value_type;
+
+    static constexpr size_t D = etl::dimensions<A>();
+
+    const size_t n1 = etl::dim<D - 2>(a);
+    const size_t n2 = etl::dim<D - 1>(a);
+
+    a.ensure_cpu_up_to_date();
+
+    if (reinterpret_cast<const void*>(a.memory_start()) != reinterpret_cast<const void*>(c.memory_start())) {
+        std::copy(a.memory_start(), a.memory_end(), c.memory_start());
+    }
+
+    detail::fft2_inplace(reinterpret_cast<etl::complex<T>*>(c.memory_start()), etl::size(a) / (n1 * n2), n1, n2);
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform many 2D Inverse FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression
+ *
+ * The first dimension of a and c are considered batch dimensions
+ */
+template <typename A, typename C>
+void ifft2_many(A&& a, C&& c) {
+    using T = typename value_t<C>::value_type;
+
+    static constexpr size_t D = etl::dimensions<A>();
+
+    auto n = etl::dim<D - 2>(a) * etl::dim<D - 1>(a);
+
+    //Conjugate the complex numbers
+    c = conj(a);
+
+    fft2_many(c, c);
+
+    //Conjugate the complex numbers again
+    // and scale the numbers
+    c = conj(c) / T(n);
+}
+
+} //end of namespace vec
+
+} //end of namespace impl
+
+} //end of namespace etl
@@ -7,7 +7,9 @@
 
 #pragma once
 
-#include "etl/impl/vec/gemm_blis.hpp" // BLIS-Like optimized kernel
+#include "etl/impl/vec/gemm_workspace.hpp" // Packing workspaces for BLIS-Like kernel
+#include "etl/impl/vec/gemm_blis.hpp"      // BLIS-Like optimized kernel
+#include "etl/impl/vec/gemm_parallel.hpp"  // Parallel dispatching of the kernels
 
 // Allocations to row major
 #include "etl/impl/vec/gemm_rr_to_r.hpp"
@@ -276,7 +276,13 @@ void gemm_micro_kernel(size_t kc, T alpha, const T* A, const T* B, T beta, T* C,
                     C[i * incRowC + j * incColC] = AB[i + j * MR];
                 }
             }
-        } else if (beta != T(1.0)) {
+        } else if (beta == T(1.0)) {
+            for (size_t j = 0; j < NR; ++j) {
+                for (size_t i = 0; i < MR; ++i) {
+                    C[i * incRowC + j * incColC] += AB[i + j * MR];
+                }
+            }
+        } else {
             for (size_t j = 0; j < NR; ++j) {
                 for (size_t i = 0; i < MR; ++i) {
                     C[i * incRowC + j * incColC] = beta * C[i * incRowC + j * incColC] + AB[i + j * MR];
@@ -290,10 +296,10 @@ void gemm_micro_kernel(size_t kc, T alpha, const T* A, const T* B, T beta, T* C,
                     C[i * incRowC + j * incColC] = alpha * AB[i + j * MR];
                 }
             }
-        } else if (beta != T(1.0)) {
+        } else {
             for (size_t j = 0; j < NR; ++j) {
                 for (size_t i = 0; i < MR; ++i) {
-                    C[i * incRowC + j * incColC] = beta * C[i * incRowC + j * incColC]+ alpha * AB[i + j * MR];
+                    C[i * incRowC + j * incColC] = beta * C[i * incRowC + j * incColC] + alpha * AB[i + j * MR];
                 }
             }
         }
@@ -305,7 +311,7 @@ void gemm_micro_kernel(size_t kc, T alpha, const T* A, const T* B, T beta, T* C,
  * are already packed in _A and _B
  */
 template <typename V, typename T>
-void gemm_macro_kernel(size_t mc, size_t nc, size_t kc, T alpha, T beta, T* C, size_t incRowC, size_t incColC, etl::dyn_matrix<T, 2>& _A, etl::dyn_matrix<T, 2>& _B, etl::dyn_matrix<T, 2>& _C) {
+void gemm_macro_kernel(size_t mc, size_t nc, size_t kc, T alpha, T beta, T* C, size_t incRowC, size_t incColC, const T* _A, const T* _B, T* _C) {
     static constexpr const size_t MR = gemm_config<T>::MR;
     static constexpr const size_t NR = gemm_config<T>::NR;
 
@@ -324,9 +330,9 @@ void gemm_macro_kernel(size_t mc, size_t nc, size_t kc, T alpha, T beta, T* C, s
             if (mr == MR && nr == NR) {
                 gemm_micro_kernel<V>(kc, alpha, &_A[i * kc * MR], &_B[j * kc * NR], beta, &C[i * MR * incRowC + j * NR * incColC], incRowC, incColC);
             } else {
-                gemm_micro_kernel<V>(kc, alpha, &_A[i * kc * MR], &_B[j * kc * NR], T(0.0), _C.memory_start(), 1, MR);
+                gemm_micro_kernel<V>(kc, alpha, &_A[i * kc * MR], &_B[j * kc * NR], T(0.0), _C, 1, MR);
                 dgescal(mr, nr, beta, &C[i * MR * incRowC + j * NR * incColC], incRowC, incColC);
-                dgeaxpy(mr, nr, T(1.0), _C.memory_start(), 1, MR, &C[i * MR * incRowC + j * NR * incColC], incRowC, incColC);
+                dgeaxpy(mr, nr, T(1.0), _C, 1, MR, &C[i * MR * incRowC + j * NR * incColC], incRowC, incColC);
             }
         }
     }
@@ -339,6 +345,13 @@ void gemm_macro_kernel(size_t mc, size_t nc, size_t kc, T alpha, T beta, T* C, s
  * On very large matrices, this is somewhat faster but seems to depend on the
  * processor. This will need more work and complete kernels.
  *
+ * When the parallel mode is selected, the blocks of A are distributed between
+ * the threads of the thread engine. Each thread packs its own panels of A
+ * while the packed panel of B is shared between all the threads.
+ *
+ * The packing buffers are taken from the persistent workspaces of the
+ * threads, so that no allocation is done in steady state.
+ *
  * From: http://apfel.mathematik.uni-ulm.de/~lehn/sghpc/gemm/
  *
  * \param A The lhs matrix
@@ -355,15 +368,24 @@ void gemm_large_kernel_workspace_rr(const T* A, const T* B, T* C, size_t m, size
     static constexpr const size_t MR = gemm_config<T>::MR;
     static constexpr const size_t NR = gemm_config<T>::NR;
 
-    etl::dyn_matrix<T, 2> _A(MC, KC);
-    etl::dyn_matrix<T, 2> _B(KC, NC);
-    etl::dyn_matrix<T, 2> _C(MR, NR);
+    const bool parallel = engine_select_parallel(m * n, gemm_blis_parallel_threshold);
+
+    // In parallel, the blocks of A are made smaller so that each thread has
+    // at least one block to compute
+
+    const size_t workers = parallel ? std::min(etl::threads, (m + MR - 1) / MR) : 1;
+    const size_t MCB     = std::min(MC, (((m + workers - 1) / workers + MR - 1) / MR) * MR);
+
+    // The shared panel of B is taken from the workspace of the calling
+    // thread while each worker uses its own workspace for A and C
+
+    T* _B = local_gemm_workspace<T>().b();
 
-    const size_t mb = (m + MC - 1) / MC;
+    const size_t mb = (m + MCB - 1) / MCB;
     const size_t nb = (n + NC - 1) / NC;
     const size_t kb = (k + KC - 1) / KC;
 
-    const size_t _mc = m % MC;
+    const size_t _mc = m % MCB;
     const size_t _nc = n % NC;
     const size_t _kc = k % KC;
 
@@ -380,22 +402,44 @@ void gemm_large_kernel_workspace_rr(const T* A, const T* B, T* C, size_t m, size
 
     for (size_t j = 0; j < nb; ++j) {
         const size_t nc = (j != nb - 1 || _nc == 0) ? NC : _nc;
+        const size_t np = (nc + NR - 1) / NR;
 
         for (size_t l = 0; l < kb; ++l) {
             const size_t kc = (l != kb - 1 || _kc == 0) ? KC : _kc;
             T _beta         = (l == 0) ? beta : 1.0;
 
-            pack_b(kc, nc, &B[l * KC * incRowB + j * NC * incColB], incRowB, incColB, _B.memory_start());
+            // Pack the shared panel of B, by groups of NR columns
 
-            for (size_t i = 0; i < mb; ++i) {
-                const size_t mc = (i != mb - 1 || _mc == 0) ? MC : _mc;
+            auto pack_b_fun = [&](const size_t first, const size_t last) {
+                const size_t ncs = std::min(last * NR, nc) - first * NR;
 
-                pack_a(mc, kc, &A[i * MC * incRowA + l * KC * incColA], incRowA, incColA, _A.memory_start());
+                pack_b(kc, ncs, &B[l * KC * incRowB + (j * NC + first * NR) * incColB], incRowB, incColB, _B + first * kc * NR);
+            };
 
-                gemm_macro_kernel<V>(mc, nc, kc, alpha, _beta,
-                                   &C[i * MC * incRowC + j * NC * incColC],
-                                   incRowC, incColC, _A, _B, _C);
-            }
+            engine_dispatch_1d(pack_b_fun, 0, np, parallel);
+
+            // Each worker packs its own blocks of A and computes them
+
+            auto macro_fun = [&](const size_t first, const size_t last) {
+                auto& workspace = local_gemm_workspace<T>();
+
+                T* _A = workspace.a();
+                T* _C = workspace.c();
+
+                for (size_t w = first; w < last; ++w) {
+                    for (size_t i = w; i < mb; i += workers) {
+                        const size_t mc = (i != mb - 1 || _mc == 0) ? MCB : _mc;
+
+                        pack_a(mc, kc, &A[i * MCB * incRowA + l * KC * incColA], incRowA, incColA, _A);
+
+                        gemm_macro_kernel<V>(mc, nc, kc, alpha, _beta,
+                                           &C[i * MCB * incRowC + j * NC * incColC],
+                                           incRowC, incColC, _A, _B, _C);
+                    }
+                }
+            };
+
+            engine_dispatch_1d(macro_fun, 0, workers, parallel);
         }
     }
 }
@@ -483,10 +483,20 @@ void gemm_cc_to_c(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
 
     // Dispatch to the best kernel
 
+    // Each thread computes a block of columns of C
+
     if(M * N <= gemm_cc_small_threshold){
-        gemm_small_kernel_cc_to_c<default_vec>(a, b, c, M, N, K);
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            gemm_small_kernel_cc_to_c<default_vec>(a, b + first * K, c + first * M, M, last - first, K);
+        };
+
+        gemm_dispatch_1d(batch_fun, N, M * N * K, gemm_cc_parallel_threshold);
     } else {
-        gemm_large_kernel_cc_to_c<default_vec>(a, b, c, M, N, K);
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            gemm_large_kernel_cc_to_c<default_vec>(a, b + first * K, c + first * M, M, last - first, K);
+        };
+
+        gemm_dispatch_1d(batch_fun, N, M * N * K, gemm_cc_parallel_threshold);
     }
 }
 
@@ -33,16 +33,10 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
     using T = value_t<I>;
 
     const size_t K  = etl::dim<0>(kernels);
-    const size_t i1 = etl::dim<0>(input);
-    const size_t i2 = etl::dim<1>(input);
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<1>(conv);
     const size_t f2 = etl::dim<2>(conv);
 
@@ -54,39 +48,13 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
     // Flip the kernels
     prepared_k.deep_fflip_inplace();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
-
-    if(p1 || p2){
-        etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-        input_padded = T(0);
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
-        impl::common::pad_2d_input(input, input_padded, p1, p2);
-
-        im2col_direct_tr(input_col, input_padded, k1, k2);
-    } else {
-        im2col_direct_tr(input_col, input, k1, k2);
-    }
+    im2col_direct_tr(input_col, input, k1, k2, s1, s2, p1, p2);
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-        gemm_large_kernel_rr_to_r<default_vec>(
-            prepared_k.memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-            K, c1 * c2, k1 * k2, T(0));
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < f1; ++i) {
-                for (size_t j = 0; j < f2; ++j) {
-                    conv(k, i, j) = tmp_result(k, i * s1, j * s2);
-                }
-            }
-        }
-    } else {
-        gemm_large_kernel_rr_to_r<default_vec>(
-            prepared_k.memory_start(), input_col.memory_start(), conv.memory_start(),
-            K, f1 * f2, k1 * k2, T(0));
-    }
+    gemm_large_kernel_rr_to_r<default_vec>(
+        prepared_k.memory_start(), input_col.memory_start(), conv.memory_start(),
+        K, f1 * f2, k1 * k2, T(0));
 
     conv.invalidate_gpu();
 }
@@ -105,55 +73,23 @@ void blas_conv2_valid_multi_flipped(I&& input, K_T&& kernels, C&& conv, size_t s
     using T = value_t<I>;
 
     const size_t K  = etl::dim<0>(kernels);
-    const size_t i1 = etl::dim<0>(input);
-    const size_t i2 = etl::dim<1>(input);
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<1>(conv);
     const size_t f2 = etl::dim<2>(conv);
 
     input.ensure_cpu_up_to_date();
     kernels.ensure_cpu_up_to_date();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
-    if(p1 || p2){
-        etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-        input_padded = T(0);
-
-        impl::common::pad_2d_input(input, input_padded, p1, p2);
-
-        im2col_direct_tr(input_col, input_padded, k1, k2);
-    } else {
-        im2col_direct_tr(input_col, input, k1, k2);
-    }
+    im2col_direct_tr(input_col, input, k1, k2, s1, s2, p1, p2);
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-        gemm_large_kernel_rr_to_r<default_vec>(
-            kernels.memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-            K, c1 * c2, k1 * k2, T(0));
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < f1; ++i) {
-                for (size_t j = 0; j < f2; ++j) {
-                    conv(k, i, j) = tmp_result(k, i * s1, j * s2);
-                }
-            }
-        }
-    } else {
-        gemm_large_kernel_rr_to_r<default_vec>(
-            kernels.memory_start(), input_col.memory_start(), conv.memory_start(),
-            K, f1 * f2, k1 * k2, T(0));
-    }
+    gemm_large_kernel_rr_to_r<default_vec>(
+        kernels.memory_start(), input_col.memory_start(), conv.memory_start(),
+        K, f1 * f2, k1 * k2, T(0));
 
     conv.invalidate_gpu();
 }
@@ -198,18 +134,12 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
     using T = value_t<I>;
 
     const size_t N  = etl::dim<0>(input);
-    const size_t i1 = etl::dim<1>(input);
-    const size_t i2 = etl::dim<2>(input);
 
     const size_t K  = etl::dim<0>(kernels);
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
 
@@ -221,43 +151,13 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
     // Flip the kernels
     prepared_k.deep_fflip_inplace();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * c1 * c2);
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * f1 * f2);
 
-    if(p1 || p2){
-        etl::dyn_matrix<T, 3> input_padded(N, i1 + 2 * p1, i2 + 2 * p2);
-        input_padded = T(0);
+    im2col_direct_tr_multi(input_col, input, k1, k2, s1, s2, p1, p2);
 
-        for(size_t i = 0; i < N; ++i){
-            impl::common::pad_2d_input(input(i), input_padded(i), p1, p2);
-        }
-
-        im2col_direct_tr_multi(input_col, input_padded, k1, k2);
-    } else {
-        im2col_direct_tr_multi(input_col, input, k1, k2);
-    }
-
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 4> tmp_result(K, N, c1, c2);
-
-        gemm_large_kernel_rr_to_r<default_vec>(
-            prepared_k.memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-            K, N * c1 * c2, k1 * k2, T(0));
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < N; ++i) {
-                for (size_t ii = 0; ii < f1; ++ii) {
-                    for (size_t j = 0; j < f2; ++j) {
-                        conv(k, i, ii, j) = tmp_result(k, i, ii * s1, j * s2);
-                    }
-                }
-            }
-        }
-    } else {
-        gemm_large_kernel_rr_to_r<default_vec>(
-            prepared_k.memory_start(), input_col.memory_start(), conv.memory_start(),
-            K, N * c1 * c2, k1 * k2, T(0));
-    }
+    gemm_large_kernel_rr_to_r<default_vec>(
+        prepared_k.memory_start(), input_col.memory_start(), conv.memory_start(),
+        K, N * f1 * f2, k1 * k2, T(0));
 
     conv.invalidate_gpu();
 }
@@ -276,61 +176,25 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
     using T = value_t<I>;
 
     const size_t N  = etl::dim<0>(input);
-    const size_t i1 = etl::dim<1>(input);
-    const size_t i2 = etl::dim<2>(input);
 
     const size_t K  = etl::dim<0>(kernels);
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
 
     input.ensure_cpu_up_to_date();
     kernels.ensure_cpu_up_to_date();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * c1 * c2);
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * f1 * f2);
 
-    if(p1 || p2){
-        etl::dyn_matrix<T, 3> input_padded(N, i1 + 2 * p1, i2 + 2 * p2);
-        input_padded = T(0);
+    im2col_direct_tr_multi(input_col, input, k1, k2, s1, s2, p1, p2);
 
-        for(size_t i = 0; i < N; ++i){
-            impl::common::pad_2d_input(input(i), input_padded(i), p1, p2);
-        }
-
-        im2col_direct_tr_multi(input_col, input_padded, k1, k2);
-    } else {
-        im2col_direct_tr_multi(input_col, input, k1, k2);
-    }
-
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 4> tmp_result(K, N, c1, c2);
-
-        gemm_large_kernel_rr_to_r<default_vec>(
-            kernels.memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-            K, N * c1 * c2, k1 * k2, T(0));
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < N; ++i) {
-                for (size_t ii = 0; ii < f1; ++ii) {
-                    for (size_t j = 0; j < f2; ++j) {
-                        conv(k, i, ii, j) = tmp_result(k, i, ii * s1, j * s2);
-                    }
-                }
-            }
-        }
-    } else {
-        gemm_large_kernel_rr_to_r<default_vec>(
-            kernels.memory_start(), input_col.memory_start(), conv.memory_start(),
-            K, N * c1 * c2, k1 * k2, T(0));
-    }
+    gemm_large_kernel_rr_to_r<default_vec>(
+        kernels.memory_start(), input_col.memory_start(), conv.memory_start(),
+        K, N * f1 * f2, k1 * k2, T(0));
 
     conv.invalidate_gpu();
 }
@@ -373,8 +237,46 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
     cpp_unreachable("Invalid call to vec::blas_conv2_valid_multi_multi_flipped");
 }
 
+/*!
+ * \brief Compute the number of images of a 4D valid convolution that are
+ * lowered together by im2col and computed with a single GEMM.
+ *
+ * Small images give GEMMs with too few columns to be efficient. Several
+ * images are therefore lowered together, as long as the columns and the
+ * results of the images of all the threads fit in max_workspace.
+ *
+ * \param N The number of images
+ * \param rows The number of rows of the lowered images (C * m1 * m2)
+ * \param K The number of kernels
+ * \param columns The number of output positions of an image (c1 * c2)
+ * \param parallel Indicates if the images are split between threads
+ * \return The number of images to lower together
+ */
+template <typename T>
+size_t conv4_valid_gemm_batch(size_t N, size_t rows, size_t K, size_t columns, bool parallel) {
+    // Larger images already give efficient GEMMs
+    if (columns >= conv4_gemm_batch_columns) {
+        return 1;
+    }
+
+    const size_t workers = parallel ? std::min(N, etl::threads) : 1;
+
+    // Enough images for a GEMM with conv4_gemm_batch_columns columns
+    const size_t target = (conv4_gemm_batch_columns + columns - 1) / columns;
+
+    // Workspace of an image, its columns and its results
+    const size_t image_workspace = (rows + K) * columns * sizeof(T);
+
+    return std::max(size_t(1), std::min(target, max_workspace / (workers * image_workspace)));
+}
+
 /*!
  * \brief Compute a 4D valid convolution using a vectorized matrix multiplication kernel
+ *
+ * The flipped kernels are used directly in their [K, C, m1, m2] storage,
+ * as a K x (C * m1 * m2) matrix, against the columns of all the channels
+ * of each image.
+ *
  * \param input The input matrix
  * \param kernel The kernel matrix (already flipped)
  * \param conv The output matrix
@@ -383,8 +285,8 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
  * \param p1 The padding of the first dimension
  * \param p2 The padding of the second dimension
  */
-template <typename I_T, typename K_T, typename KS_T, typename C_T>
-void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
     cpp_assert(vec_enabled, "Cannot use vectorized mode");
     cpp_assert(vectorize_impl, "Cannot use vectorized implementation");
 
@@ -394,9 +296,6 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
     const auto K = etl::dim<0>(kernel); // The number of kernels
     const auto C = etl::dim<1>(input);  // The number of channels
 
-    const auto n1 = etl::dim<2>(input);
-    const auto n2 = etl::dim<3>(input);
-
     const auto m1 = etl::dim<2>(kernel);
     const auto m2 = etl::dim<3>(kernel);
 
@@ -404,62 +303,43 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
     const auto c2 = etl::dim<3>(conv);
 
     input.ensure_cpu_up_to_date();
-    kernels.ensure_cpu_up_to_date();
+    kernel.ensure_cpu_up_to_date();
 
-    conv = T(0.0);
+    const bool parallel = engine_select_parallel(N, 2);
+
+    const size_t batch = conv4_valid_gemm_batch<T>(N, C * m1 * m2, K, c1 * c2, parallel);
 
     auto batch_fun_n = [&](const size_t first, const size_t last) {
         if (last - first) {
-            // unit-strided result dimensions
-            const size_t sc1 = (n1 - m1 + 2 * p1) + 1;
-            const size_t sc2 = (n2 - m2 + 2 * p2) + 1;
+            const size_t B = std::min(batch, last - first);
 
-            etl::dyn_matrix<T, 2> input_col(m1 * m2, sc1 * sc2);
+            // Only the strided output positions are generated by im2col
+            etl::dyn_matrix<T, 2> input_col(C * m1 * m2, B * c1 * c2);
 
-            // Optimize for the most common case
-            if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
+            if (B == 1) {
                 for (size_t i = first; i < last; ++i) {
-                    for (size_t c = 0; c < C; ++c) {
-                        im2col_direct_tr(input_col, input(i)(c), m1, m2);
+                    im2col_direct_tr(input_col, input(i), m1, m2, s1, s2, p1, p2);
 
-                        gemm_large_kernel_rr_to_r<default_vec>(
-                            kernels(c).memory_start(), input_col.memory_start(), conv(i).memory_start(),
-                            K, c1 * c2, m1 * m2, T(1.0));
-                    }
+                    gemm_large_kernel_rr_to_r<default_vec>(
+                        kernel.memory_start(), input_col.memory_start(), conv(i).memory_start(),
+                        K, c1 * c2, C * m1 * m2, T(0));
                 }
             } else {
-                etl::dyn_matrix<T, 2> input_padded(n1 + 2 * p1, n2 + 2 * p2);
-                etl::dyn_matrix<T, 3> tmp_result(K, sc1, sc2);
+                // The results of the images are side by side in each row
+                etl::dyn_matrix<T, 2> conv_col(K, B * c1 * c2);
 
-                for (size_t i = first; i < last; ++i) {
-                    for (size_t c = 0; c < C; ++c) {
-                        if (p1 || p2) {
-                            input_padded = T(0.0);
+                for (size_t i = first; i < last; i += B) {
+                    const size_t b = std::min(B, last - i);
 
-                            impl::common::pad_2d_input(input(i)(c), input_padded, p1, p2);
+                    im2col_direct_tr_multi(input_col, slice(input, i, i + b), m1, m2, s1, s2, p1, p2);
 
-                            im2col_direct_tr(input_col, input_padded, m1, m2);
-                        } else {
-                            im2col_direct_tr(input_col, input(i)(c), m1, m2);
-                        }
+                    gemm_large_kernel_rr_to_r<default_vec>(
+                        kernel.memory_start(), input_col.memory_start(), conv_col.memory_start(),
+                        K, b * c1 * c2, C * m1 * m2, T(0));
 
-                        if (s1 > 1 || s2 > 1) {
-                            gemm_large_kernel_rr_to_r<default_vec>(
-                                kernels(c).memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-                                K, sc1 * sc2, m1 * m2, T(0.0));
-
-                            // Strided copy of the large result into the small result
-                            for (size_t k = 0; k < K; ++k) {
-                                for (size_t ii = 0; ii < c1; ++ii) {
-                                    for (size_t j = 0; j < c2; ++j) {
-                                        conv(i, k, ii, j) += tmp_result(k, ii * s1, j * s2);
-                                    }
-                                }
-                            }
-                        } else {
-                            gemm_large_kernel_rr_to_r<default_vec>(
-                                kernels(c).memory_start(), input_col.memory_start(), conv(i).memory_start(),
-                                K, c1 * c2, m1 * m2, T(1.0));
+                    for (size_t j = 0; j < b; ++j) {
+                        for (size_t k = 0; k < K; ++k) {
+                            direct_copy_n(conv_col.memory_start() + (k * b + j) * c1 * c2, conv(i + j)(k).memory_start(), c1 * c2);
                         }
                     }
                 }
@@ -467,7 +347,7 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
         }
     };
 
-    engine_dispatch_1d_serial(batch_fun_n, 0, N, 2UL);
+    engine_dispatch_1d_serial(batch_fun_n, 0, N, parallel);
 
     conv.invalidate_gpu();
 }
@@ -484,25 +364,21 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
  */
 template <typename I_T, typename K_T, typename C_T, cpp_enable_iff(conv2_possible<vector_mode, I_T, K_T, C_T>)>
 void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-    const auto K = etl::dim<0>(kernel); // The number of kernels
-    const auto C = etl::dim<1>(input);  // The number of channels
-
-    const auto m1 = etl::dim<2>(kernel);
-    const auto m2 = etl::dim<3>(kernel);
-
-    etl::dyn_matrix<value_t<I_T>, 4> kernels(C, K, m1, m2);
+    auto prepared_k = force_temporary(kernel);
 
-    for(size_t c = 0; c < C; ++c){
-        for(size_t k = 0; k < K; ++k){
-            kernels(c)(k) = fflip(kernel(k)(c));
-        }
-    }
+    // Flip the kernels
+    prepared_k.deep_fflip_inplace();
 
-    blas_conv4_valid_prepared(input, kernel, kernels, conv, s1, s2, p1, p2);
+    blas_conv4_valid_prepared(input, prepared_k, conv, s1, s2, p1, p2);
 }
 
 /*!
  * \brief Compute a 4D valid convolution using a vectorized matrix multiplication kernel
+ *
+ * The kernels are used as they are, without any copy. Flipping the
+ * kernels once and reusing them across calls avoids any preparation of
+ * the kernels.
+ *
  * \param input The input matrix
  * \param kernel The kernel matrix, with flipped kernels
  * \param conv The output matrix
@@ -513,21 +389,7 @@ void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s
  */
 template <typename I_T, typename K_T, typename C_T, cpp_enable_iff(conv2_possible<vector_mode, I_T, K_T, C_T>)>
 void blas_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-    const auto K = etl::dim<0>(kernel); // The number of kernels
-    const auto C = etl::dim<1>(input);  // The number of channels
-
-    const auto m1 = etl::dim<2>(kernel);
-    const auto m2 = etl::dim<3>(kernel);
-
-    etl::dyn_matrix<value_t<I_T>, 4> kernels(C, K, m1, m2);
-
-    for(size_t c = 0; c < C; ++c){
-        for(size_t k = 0; k < K; ++k){
-            kernels(c)(k) = kernel(k)(c);
-        }
-    }
-
-    blas_conv4_valid_prepared(input, kernel, kernels, conv, s1, s2, p1, p2);
+    blas_conv4_valid_prepared(input, kernel, conv, s1, s2, p1, p2);
 }
 
 /*!
@@ -600,16 +462,9 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
     const auto f1 = etl::dim<2>(conv);
     const auto f2 = etl::dim<3>(conv);
 
-    const auto i1 = etl::dim<2>(input);
-    const auto i2 = etl::dim<3>(input);
-
     const auto k1 = etl::dim<2>(kernel);
     const auto k2 = etl::dim<3>(kernel);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     input.ensure_cpu_up_to_date();
     kernel.ensure_cpu_up_to_date();
 
@@ -618,48 +473,15 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
 
     auto batch_fun_c = [&](const size_t first, const size_t last) {
         for (size_t c = first; c < last; ++c) {
-            etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+            // Only the strided output positions are generated by im2col
+            etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
             for (size_t i = 0; i < I; ++i) {
-                // Optimize for the most common case
-                if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
-                    im2col_direct_tr(input_col, input(i)(c), k1, k2);
-                    gemm_large_kernel_rr_to_r<default_vec>(
-                        kernel(i).memory_start(), input_col.memory_start(), conv_temp(c).memory_start(),
-                        K, f1 * f2, k1 * k2, T(1.0));
-                } else {
-                    if (p1 || p2) {
-                        etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-                        input_padded = T(0);
-
-                        impl::common::pad_2d_input(input(i)(c), input_padded, p1, p2);
-
-                        im2col_direct_tr(input_col, input_padded, k1, k2);
-                    } else {
-                        im2col_direct_tr(input_col, input(i)(c), k1, k2);
-                    }
-
-                    if (s1 > 1 || s2 > 1) {
-                        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
+                im2col_direct_tr(input_col, input(i)(c), k1, k2, s1, s2, p1, p2);
 
-                        gemm_large_kernel_rr_to_r<default_vec>(
-                            kernel(i).memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-                            K, c1 * c2, k1 * k2, T(0.0));
-
-                        // Strided copy of the large result into the small result
-                        for (size_t k = 0; k < K; ++k) {
-                            for (size_t ii = 0; ii < f1; ++ii) {
-                                for (size_t j = 0; j < f2; ++j) {
-                                    conv_temp(c, k, ii, j) += tmp_result(k, ii * s1, j * s2);
-                                }
-                            }
-                        }
-                    } else {
-                        gemm_large_kernel_rr_to_r<default_vec>(
-                            kernel(i).memory_start(), input_col.memory_start(), conv_temp(c).memory_start(),
-                            K, f1 * f2, k1 * k2, T(1.0));
-                    }
-                }
+                gemm_large_kernel_rr_to_r<default_vec>(
+                    kernel(i).memory_start(), input_col.memory_start(), conv_temp(c).memory_start(),
+                    K, f1 * f2, k1 * k2, T(1.0));
             }
         }
 
@@ -774,16 +596,10 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
     const auto C = etl::dim<1>(kernel);
     const auto K = etl::dim<1>(input);
 
-    const size_t i1 = etl::dim<2>(input);
-    const size_t i2 = etl::dim<3>(input);
     const size_t k1 = etl::dim<2>(kernel);
     const size_t k2 = etl::dim<3>(kernel);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
+    // The strided output dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
 
@@ -792,58 +608,18 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
 
     auto batch_fun_n = [&](const size_t first, const size_t last) {
         if (last - first) {
-            etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+            // Only the strided output positions are generated by im2col
+            etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
-            // Optimize for the most common case
-            if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
-                for (size_t i = first; i < last; ++i) {
-                    for (size_t k = 0; k < K; ++k) {
-                        // use im2col on input(i)(k)
-                        im2col_direct_tr(input_col, input(i)(k), k1, k2);
-
-                        // conv(i) = kernel(k) * input_col
-                        gemm_large_kernel_rr_to_r<default_vec>(
-                            kernel(k).memory_start(), input_col.memory_start(), conv(i).memory_start(),
-                            C, c1 * c2, k1 * k2, T(1.0));
-                    }
-                }
-            } else {
-                etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-                etl::dyn_matrix<T, 3> tmp_result(C, c1, c2);
+            for (size_t i = first; i < last; ++i) {
+                for (size_t k = 0; k < K; ++k) {
+                    // use im2col on input(i)(k)
+                    im2col_direct_tr(input_col, input(i)(k), k1, k2, s1, s2, p1, p2);
 
-                for (size_t i = first; i < last; ++i) {
-                    for (size_t k = 0; k < K; ++k) {
-                        // use im2col on input(i)(k)
-
-                        if (p1 || p2) {
-                            input_padded = T(0);
-                            impl::common::pad_2d_input(input(i)(k), input_padded, p1, p2);
-                            im2col_direct_tr(input_col, input_padded, k1, k2);
-                        } else {
-                            im2col_direct_tr(input_col, input(i)(k), k1, k2);
-                        }
-
-                        if (s1 > 1 || s2 > 1) {
-                            // tmp_result = kernel(k) * input_col
-                            gemm_large_kernel_rr_to_r<default_vec>(
-                                kernel(k).memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-                                C, c1 * c2, k1 * k2, T(0.0));
-
-                            // Strided copy of the large result into the small result
-                            for (size_t c = 0; c < C; ++c) {
-                                for (size_t m = 0; m < f1; ++m) {
-                                    for (size_t n = 0; n < f2; ++n) {
-                                        conv(i, c, m, n) += tmp_result(c, m * s1, n * s2);
-                                    }
-                                }
-                            }
-                        } else {
-                            // conv(i) = kernel(k) * input_col
-                            gemm_large_kernel_rr_to_r<default_vec>(
-                                kernel(k).memory_start(), input_col.memory_start(), conv(i).memory_start(),
-                                C, c1 * c2, k1 * k2, T(1.0));
-                        }
-                    }
+                    // conv(i) = kernel(k) * input_col
+                    gemm_large_kernel_rr_to_r<default_vec>(
+                        kernel(k).memory_start(), input_col.memory_start(), conv(i).memory_start(),
+                        C, f1 * f2, k1 * k2, T(1.0));
                 }
             }
         }
@@ -26,16 +26,18 @@ namespace vec {
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
+ * \param first The first row of C to compute
+ * \param last The row of C after the last one to compute
  */
 template <typename V, typename T>
-void gemm_small_kernel_cr_to_c(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
+void gemm_small_kernel_cr_to_c(const T* a, const T* b, T* c, size_t M, size_t N, size_t K, size_t first, size_t last) {
     using vec_type = V;
 
     static constexpr size_t vec_size = vec_type::template traits<T>::size;
 
-    const auto i_end = M & (size_t(-vec_size));
+    const auto i_end = last & (size_t(-vec_size));
 
-    size_t i = 0;
+    size_t i = first;
 
     for( ; i + 3 * vec_size < i_end; i += 4 * vec_size){
         size_t j = 0;
@@ -195,7 +197,7 @@ void gemm_small_kernel_cr_to_c(const T* a, const T* b, T* c, size_t M, size_t N,
         }
     }
 
-    for( ; i < M; ++i){
+    for( ; i < last; ++i){
         size_t j = 0;
 
         for (; j + 1 < N; j += 2) {
@@ -230,9 +232,11 @@ void gemm_small_kernel_cr_to_c(const T* a, const T* b, T* c, size_t M, size_t N,
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
+ * \param first The first row of C to compute
+ * \param last The row of C after the last one to compute
  */
 template <typename V, typename T>
-void gemm_large_kernel_cr_to_c(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
+void gemm_large_kernel_cr_to_c(const T* a, const T* b, T* c, size_t M, size_t N, size_t K, size_t first, size_t last) {
     using vec_type = V;
 
     static constexpr size_t vec_size = vec_type::template traits<T>::size;
@@ -241,8 +245,8 @@ void gemm_large_kernel_cr_to_c(const T* a, const T* b, T* c, size_t M, size_t N,
     constexpr size_t m_block_size = 64UL;
     constexpr size_t k_block_size = 128UL;
 
-    for (size_t ii = 0; ii < M; ii += m_block_size) {
-        const size_t i_end = std::min(ii + m_block_size, M);
+    for (size_t ii = first; ii < last; ii += m_block_size) {
+        const size_t i_end = std::min(ii + m_block_size, last);
         const size_t i_pos = i_end & size_t(-vec_size);
 
         for (size_t jj = 0; jj < N; jj += n_block_size) {
@@ -473,11 +477,22 @@ template <typename T>
 void gemm_cr_to_c(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
+    // Each thread computes a block of rows of C
+
     if (M * N <= gemm_rr_small_threshold) {
-        gemm_small_kernel_cr_to_c<default_vec>(a, b, c, M, N, K);
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            gemm_small_kernel_cr_to_c<default_vec>(a, b, c, M, N, K, first, last);
+        };
+
+        gemm_dispatch_1d(batch_fun, M, M * N * K, gemm_cr_parallel_threshold);
     } else {
         direct_fill_n(c, M * N, T(0));
-        gemm_large_kernel_cr_to_c<default_vec>(a, b, c, M, N, K);
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            gemm_large_kernel_cr_to_c<default_vec>(a, b, c, M, N, K, first, last);
+        };
+
+        gemm_dispatch_1d(batch_fun, M, M * N * K, gemm_cr_parallel_threshold);
     }
 }
 
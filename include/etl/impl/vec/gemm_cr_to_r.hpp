@@ -26,9 +26,11 @@ namespace vec {
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
+ * \param first The first row of C to compute
+ * \param last The row of C after the last one to compute
  */
 template <typename V, typename T>
-void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
+void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K, size_t first, size_t last) {
     using vec_type = V;
 
     static constexpr size_t vec_size = vec_type::template traits<T>::size;
@@ -38,9 +40,9 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
     size_t j = 0;
 
     for (; j + 7 * vec_size < j_end; j += 8 * vec_size) {
-        size_t i = 0;
+        size_t i = first;
 
-        for (; i < M; i++) {
+        for (; i < last; i++) {
             auto r11 = vec_type::template zero<T>();
             auto r12 = vec_type::template zero<T>();
             auto r13 = vec_type::template zero<T>();
@@ -84,9 +86,9 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
     }
 
     for (; j + 3 * vec_size < j_end; j += 4 * vec_size) {
-        size_t i = 0;
+        size_t i = first;
 
-        for (; i + 1 < M; i += 2) {
+        for (; i + 1 < last; i += 2) {
             auto r11 = vec_type::template zero<T>();
             auto r21 = vec_type::template zero<T>();
 
@@ -134,7 +136,7 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
             vec_type::storeu(c + (i + 1) * N + j + 3 * vec_size, r24);
         }
 
-        for (; i < M; i++) {
+        for (; i < last; i++) {
             auto r11 = vec_type::template zero<T>();
             auto r12 = vec_type::template zero<T>();
             auto r13 = vec_type::template zero<T>();
@@ -162,9 +164,9 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
     }
 
     for (; j + 1 * vec_size < j_end; j += 2 * vec_size) {
-        size_t i = 0;
+        size_t i = first;
 
-        for (; i + 1 < M; i += 2) {
+        for (; i + 1 < last; i += 2) {
             auto r11 = vec_type::template zero<T>();
             auto r21 = vec_type::template zero<T>();
 
@@ -192,7 +194,7 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
             vec_type::storeu(c + (i + 1) * N + j + 1 * vec_size, r22);
         }
 
-        for (; i < M; i++) {
+        for (; i < last; i++) {
             auto r11 = vec_type::template zero<T>();
             auto r12 = vec_type::template zero<T>();
 
@@ -212,9 +214,9 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
     }
 
     for (; j < j_end; j += vec_size) {
-        size_t i = 0;
+        size_t i = first;
 
-        for (; i + 1 < M; i += 2) {
+        for (; i + 1 < last; i += 2) {
             auto r11 = vec_type::template zero<T>();
             auto r21 = vec_type::template zero<T>();
 
@@ -232,7 +234,7 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
             vec_type::storeu(c + (i + 1) * N + j + 0 * vec_size, r21);
         }
 
-        if (i < M) {
+        if (i < last) {
             auto r11 = vec_type::template zero<T>();
 
             for (size_t k = 0; k < K; ++k) {
@@ -248,9 +250,9 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
     }
 
     for (; j < N; ++j) {
-        size_t i = 0;
+        size_t i = first;
 
-        for (; i + 1 < M; i += 2) {
+        for (; i + 1 < last; i += 2) {
             auto r1 = T();
             auto r2 = T();
 
@@ -263,7 +265,7 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
             c[(i + 1) * N + j] = r2;
         }
 
-        if (i < M) {
+        if (i < last) {
             auto r1 = T();
 
             for (size_t k = 0; k < K; ++k) {
@@ -282,9 +284,11 @@ void gemm_small_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
+ * \param first The first row of C to compute
+ * \param last The row of C after the last one to compute
  */
 template <typename V, typename T>
-void gemm_large_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
+void gemm_large_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K, size_t first, size_t last) {
     using vec_type = V;
 
     static constexpr size_t vec_size = vec_type::template traits<T>::size;
@@ -297,8 +301,8 @@ void gemm_large_kernel_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N,
         const size_t j_end_a = std::min(jj + n_block_size, N);
         const size_t j_end   = j_end_a & size_t(-vec_size);
 
-        for (size_t ii = 0; ii < M; ii += m_block_size) {
-            const size_t i_end = std::min(ii + m_block_size, M);
+        for (size_t ii = first; ii < last; ii += m_block_size) {
+            const size_t i_end = std::min(ii + m_block_size, last);
 
             for (size_t kk = 0; kk < K; kk += k_block_size) {
                 const size_t k_end = std::min(kk + k_block_size, K);
@@ -525,11 +529,21 @@ template <typename T>
 void gemm_cr_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
+    // Each thread computes a block of rows of C
+
     if (M * N <= gemm_rr_small_threshold) {
-        gemm_small_kernel_cr_to_r<default_vec>(a, b, c, M, N, K);
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            gemm_small_kernel_cr_to_r<default_vec>(a, b, c, M, N, K, first, last);
+        };
+
+        gemm_dispatch_1d(batch_fun, M, M * N * K, gemm_cr_parallel_threshold);
     } else {
-        direct_fill_n(c, M * N, T(0));
-        gemm_large_kernel_cr_to_r<default_vec>(a, b, c, M, N, K);
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            direct_fill_n(c + first * N, (last - first) * N, T(0));
+            gemm_large_kernel_cr_to_r<default_vec>(a, b, c, M, N, K, first, last);
+        };
+
+        gemm_dispatch_1d(batch_fun, M, M * N * K, gemm_cr_parallel_threshold);
     }
 }
 
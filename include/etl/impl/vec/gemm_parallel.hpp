@@ -0,0 +1,53 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Parallel dispatching of the vectorized GEMM kernels
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief The granularity, in rows or columns of C, of the split of the GEMM
+ * kernels between threads.
+ *
+ * This is a multiple of the number of elements of every vector type, so
+ * that the boundaries of the blocks are aligned like the beginning of the
+ * matrix for the kernels vectorized along the split dimension.
+ */
+constexpr size_t gemm_parallel_block = 16;
+
+/*!
+ * \brief Dispatch the n rows (or columns) of the result of a GEMM to the
+ * given functor, in parallel if the GEMM is large enough.
+ *
+ * \param functor The functor to call with each range [first, last)
+ * \param n The number of rows (or columns) of C
+ * \param ops The number of multiply-add operations of the GEMM
+ * \param threshold The number of operations after which the GEMM is parallelized
+ */
+template <typename Functor>
+void gemm_dispatch_1d(Functor&& functor, size_t n, size_t ops, size_t threshold) {
+    const size_t blocks = (n + gemm_parallel_block - 1) / gemm_parallel_block;
+
+    auto block_fun = [&functor, n](const size_t first, const size_t last) {
+        functor(first * gemm_parallel_block, std::min(last * gemm_parallel_block, n));
+    };
+
+    engine_dispatch_1d(block_fun, 0, blocks, engine_select_parallel(ops, threshold) && blocks > 1);
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
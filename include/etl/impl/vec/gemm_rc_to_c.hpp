@@ -568,12 +568,14 @@ template <typename T>
 void gemm_rc_to_c(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
-    if (M * N <= 10) {
-        gemm_small_kernel_rc_to_c<default_vec>(a, b, c, M, N, K);
-    } else {
-        // TODO Use the large kernel once it's been made faster
-        gemm_small_kernel_rc_to_c<default_vec>(a, b, c, M, N, K);
-    }
+    // Each thread computes a block of columns of C
+    // TODO Use the large kernel once it's been made faster
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        gemm_small_kernel_rc_to_c<default_vec>(a, b + first * K, c + first * M, M, last - first, K);
+    };
+
+    gemm_dispatch_1d(batch_fun, N, M * N * K, gemm_rc_parallel_threshold);
 }
 
 } //end of namespace vec
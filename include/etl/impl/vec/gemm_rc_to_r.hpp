@@ -542,11 +542,21 @@ template <typename T>
 void gemm_rc_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
+    // Each thread computes a block of rows of C
+
     if (M * N <= gemm_nt_rr_small_threshold) {
-        gemm_small_kernel_rc_to_r<default_vec>(a, b, c, M, N, K);
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            gemm_small_kernel_rc_to_r<default_vec>(a + first * K, b, c + first * N, last - first, N, K);
+        };
+
+        gemm_dispatch_1d(batch_fun, M, M * N * K, gemm_rc_parallel_threshold);
     } else {
-        direct_fill_n(c, M * N, T(0));
-        gemm_large_kernel_rc_to_r<default_vec>(a, b, c, M, N, K);
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            direct_fill_n(c + first * N, (last - first) * N, T(0));
+            gemm_large_kernel_rc_to_r<default_vec>(a + first * K, b, c + first * N, last - first, N, K);
+        };
+
+        gemm_dispatch_1d(batch_fun, M, M * N * K, gemm_rc_parallel_threshold);
     }
 }
 
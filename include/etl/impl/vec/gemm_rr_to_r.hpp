@@ -627,9 +627,21 @@ void gemm_rr_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
     // Dispatch to the best kernel
 
     if(K * N  <= gemm_rr_small_threshold){
-        gemm_small_kernel_rr_to_r<default_vec>(a, b, c, M, N, K);
+        // Each thread computes a block of rows of C
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            gemm_small_kernel_rr_to_r<default_vec>(a + first * K, b, c + first * N, last - first, N, K);
+        };
+
+        gemm_dispatch_1d(batch_fun, M, M * N * K, gemm_rr_parallel_threshold);
+    } else if (is_floating_t<T> && engine_select_parallel(M * N, gemm_blis_parallel_threshold)) {
+        // The BLIS-like kernel can split its blocks between threads
+        gemm_large_kernel_workspace_rr<default_vec>(a, b, c, M, N, K, T(0));
     } else {
-        gemm_large_kernel_rr_to_r<default_vec>(a, b, c, M, N, K, T(0));
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            gemm_large_kernel_rr_to_r<default_vec>(a + first * K, b, c + first * N, last - first, N, K, T(0));
+        };
+
+        gemm_dispatch_1d(batch_fun, M, M * N * K, gemm_rr_parallel_threshold);
     }
 }
 
@@ -0,0 +1,105 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Persistent packing workspaces for the BLIS-like GEMM kernels
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief BLIS-like GEMM config
+ */
+template<typename T>
+struct gemm_config;
+
+/*!
+ * \brief Packing workspace of the BLIS-like GEMM kernels.
+ *
+ * The buffers are sized from gemm_config<T> and allocated
+ * (aligned and not initialized) the first time they are used. They
+ * are then reused by all the following GEMM of the same thread and
+ * released when the thread exits.
+ *
+ * \tparam T The value type
+ */
+template <typename T>
+struct gemm_workspace {
+    static constexpr size_t a_size = gemm_config<T>::MC * gemm_config<T>::KC; ///< The size of the packed panel of A
+    static constexpr size_t b_size = gemm_config<T>::KC * gemm_config<T>::NC; ///< The size of the packed panel of B
+    static constexpr size_t c_size = gemm_config<T>::MR * gemm_config<T>::NR; ///< The size of the micro-tile of C
+
+    gemm_workspace() = default;
+
+    gemm_workspace(const gemm_workspace& rhs) = delete;
+    gemm_workspace& operator=(const gemm_workspace& rhs) = delete;
+
+    /*!
+     * \brief Returns the buffer for the packed panel of A
+     */
+    T* a() {
+        return get(_a, a_size);
+    }
+
+    /*!
+     * \brief Returns the buffer for the packed panel of B
+     */
+    T* b() {
+        return get(_b, b_size);
+    }
+
+    /*!
+     * \brief Returns the buffer for the micro-tile of C
+     */
+    T* c() {
+        return get(_c, c_size);
+    }
+
+private:
+    /*!
+     * \brief Returns the given buffer, allocating it if necessary
+     * \param buffer The buffer to get
+     * \param size The number of elements of the buffer
+     */
+    static T* get(aligned_ptr<T>& buffer, size_t size) {
+        if (cpp_unlikely(!buffer.get())) {
+            buffer = aligned_allocate_auto<T>(size);
+
+            inc_counter("cpu:gemm:workspace:allocate");
+        } else {
+            inc_counter("cpu:gemm:workspace:reuse");
+        }
+
+        return buffer.get();
+    }
+
+    aligned_ptr<T> _a{nullptr}; ///< The packed panel of A
+    aligned_ptr<T> _b{nullptr}; ///< The packed panel of B
+    aligned_ptr<T> _c{nullptr}; ///< The micro-tile of C
+};
+
+/*!
+ * \brief Returns the GEMM packing workspace of the current thread
+ * \tparam T The value type
+ * \return a reference to the workspace of the current thread
+ */
+template <typename T>
+gemm_workspace<T>& local_gemm_workspace() {
+    static thread_local gemm_workspace<T> workspace;
+    return workspace;
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -353,8 +353,8 @@ void gemv_large_kernel_rr(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
 
         // Remainder inner loop
         for (; remainder && k < n; ++k) {
-            cc[i + 0] += aa[i + 0 * n + k] * bb[k];
-            cc[i + 1] += aa[i + 1 * n + k] * bb[k];
+            cc[i + 0] += aa[(i + 0) * n + k] * bb[k];
+            cc[i + 1] += aa[(i + 1) * n + k] * bb[k];
         }
     }
 
@@ -584,6 +584,91 @@ void gemv_large_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
     }
 }
 
+/*!
+ * \brief Compute the GEMV of a row major matrix, in parallel by blocks of rows
+ * \param aa The lhs matrix
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param bb The rhs vector
+ * \param cc The result vector
+ * \param small Indicates if the small kernel must be used
+ */
+template <bool Padded, typename T>
+void gemv_rr(const T* aa, size_t m, size_t n, const T* bb, T* cc, bool small) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        if (small) {
+            gemv_small_kernel_rr<default_vec, Padded>(aa + first * n, last - first, n, bb, cc + first);
+        } else {
+            gemv_large_kernel_rr<default_vec, Padded>(aa + first * n, last - first, n, bb, cc + first);
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, m, engine_select_parallel(m * n, gemv_parallel_threshold) && m > 1);
+}
+
+/*!
+ * \brief Compute the GEMV of a column major matrix, in parallel by blocks of
+ * columns.
+ *
+ * Each block of columns computes its contribution into its own partial
+ * result and the partial results are summed at the end.
+ *
+ * \param aa The lhs matrix
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param bb The rhs vector
+ * \param cc The result vector
+ * \param small Indicates if the small kernel must be used
+ */
+template <bool Padded, typename T>
+void gemv_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc, bool small) {
+    static constexpr size_t vec_size = default_vec::template traits<T>::size;
+
+    auto kernel = [small](const T* aa, size_t m, size_t n, const T* bb, T* cc) {
+        if (small) {
+            gemv_small_kernel_cc<default_vec, Padded>(aa, m, n, bb, cc);
+        } else {
+            gemv_large_kernel_cc<default_vec, Padded>(aa, m, n, bb, cc);
+        }
+    };
+
+    const size_t blocks = engine_select_parallel(m * n, gemv_parallel_threshold) ? std::min(etl::threads, n) : 1;
+
+    if (blocks == 1) {
+        if (!small) {
+            std::fill_n(cc, m, T(0));
+        }
+
+        kernel(aa, m, n, bb, cc);
+
+        return;
+    }
+
+    // The partial results are padded for the vectorized stores of the kernels
+    const size_t m_pad = (m + vec_size - 1) & size_t(-vec_size);
+
+    auto partials = etl::allocate<T>(blocks * m_pad);
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            const size_t j0 = b * n / blocks;
+            const size_t j1 = (b + 1) * n / blocks;
+
+            kernel(aa + j0 * m, m, j1 - j0, bb + j0, partials.get() + b * m_pad);
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, blocks, true);
+
+    std::copy_n(partials.get(), m, cc);
+
+    for (size_t b = 1; b < blocks; ++b) {
+        for (size_t i = 0; i < m; ++i) {
+            cc[i] += partials[b * m_pad + i];
+        }
+    }
+}
+
 /*!
  * \brief Optimized version of GEMV for row major version
  * \param a The lhs matrix
@@ -600,11 +685,7 @@ void gemv(A&& a, B&& b, C&& c) {
     const auto m = rows(a);
     const auto n = columns(a);
 
-    if (etl::size(a) < gemv_rm_small_threshold) {
-        gemv_small_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    } else {
-        gemv_large_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    }
+    gemv_rr<all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start(), etl::size(a) < gemv_rm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -625,12 +706,7 @@ void gemv(A&& a, B&& b, C&& c) {
     const auto m = rows(a);
     const auto n = columns(a);
 
-    if (etl::size(a) < gemv_cm_small_threshold) {
-        gemv_small_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    } else {
-        c = 0;
-        gemv_large_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    }
+    gemv_cc<all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start(), etl::size(a) < gemv_cm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -653,11 +729,7 @@ void gemv_t(A&& a, B&& b, C&& c) {
     const auto m = rows(a);
     const auto n = columns(a);
 
-    if (etl::size(a) < gemv_rm_small_threshold) {
-        gemv_small_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    } else {
-        gemv_large_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    }
+    gemv_cc<all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start(), etl::size(a) < gemv_rm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -678,12 +750,7 @@ void gemv_t(A&& a, B&& b, C&& c) {
     const auto m = rows(a);
     const auto n = columns(a);
 
-    if (etl::size(a) < gemv_cm_small_threshold) {
-        gemv_small_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    } else {
-        c = 0;
-        gemv_large_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    }
+    gemv_rr<all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start(), etl::size(a) < gemv_cm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -174,7 +174,8 @@ void gevm_large_kernel_rr(const T* aa, size_t m, size_t n, const T* bb, C&& cc)
     cc = 0;
 
     for (size_t block_j = 0; block_j < n; block_j += n_block) {
-        const size_t n_end = std::min(block_j + n_block, n) & size_t(-vec_size);
+        const size_t n_last = std::min(block_j + n_block, n);
+        const size_t n_end  = n_last & size_t(-vec_size);
 
         for (size_t block_k = 0; block_k < m; block_k += m_block) {
             const size_t m_end = std::min(block_k + m_block, m);
@@ -284,7 +285,7 @@ void gevm_large_kernel_rr(const T* aa, size_t m, size_t n, const T* bb, C&& cc)
             }
 
             // Remainder non-vectorized loop
-            for (; j < n_end; ++j) {
+            for (; j < n_last; ++j) {
                 auto r1 = T();
 
                 for (size_t k = block_k; k < m_end; ++k) {
@@ -648,6 +649,86 @@ void gevm_large_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
     }
 }
 
+/*!
+ * \brief Compute the GEVM of a row major matrix, in parallel by blocks of
+ * rows.
+ *
+ * Each block of rows computes its contribution into its own partial result
+ * and the partial results are summed at the end.
+ *
+ * \param aa The lhs vector
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param bb The rhs matrix
+ * \param c The result vector
+ * \param small Indicates if the small kernel must be used
+ */
+template <typename T, typename C>
+void gevm_rr(const T* aa, size_t m, size_t n, const T* bb, C&& c, bool small) {
+    auto kernel = [small](const T* aa, size_t m, size_t n, const T* bb, auto&& c) {
+        if (small) {
+            gevm_small_kernel_rr<default_vec>(aa, m, n, bb, c);
+        } else {
+            gevm_large_kernel_rr<default_vec>(aa, m, n, bb, c);
+        }
+    };
+
+    const size_t blocks = engine_select_parallel(m * n, gevm_parallel_threshold) ? std::min(etl::threads, m) : 1;
+
+    if (blocks == 1) {
+        kernel(aa, m, n, bb, c);
+        return;
+    }
+
+    // The first block directly computes into c
+    std::vector<etl::dyn_vector<T>> partials(blocks - 1, etl::dyn_vector<T>(n));
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            const size_t k0 = b * m / blocks;
+            const size_t k1 = (b + 1) * m / blocks;
+
+            if (b == 0) {
+                kernel(aa, k1, n, bb, c);
+            } else {
+                kernel(aa + k0, k1 - k0, n, bb + k0 * n, partials[b - 1]);
+            }
+        }
+    };
+
+    // The kernels are evaluating ETL expressions, they must not open new threads
+    engine_dispatch_1d_serial(batch_fun, 0, blocks, true);
+
+    for (auto& partial : partials) {
+        c += partial;
+    }
+}
+
+/*!
+ * \brief Compute the GEVM of a column major matrix, in parallel by blocks of
+ * columns
+ * \param aa The lhs vector
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param bb The rhs matrix
+ * \param cc The result vector
+ * \param small Indicates if the small kernel must be used
+ */
+template <typename T>
+void gevm_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc, bool small) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        if (small) {
+            gevm_small_kernel_cc<default_vec>(aa, m, last - first, bb + first * m, cc + first);
+        } else {
+            std::fill(cc + first, cc + last, T(0));
+
+            gevm_large_kernel_cc<default_vec>(aa, m, last - first, bb + first * m, cc + first);
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, n, engine_select_parallel(m * n, gevm_parallel_threshold) && n > 1);
+}
+
 /*!
  * \brief Optimized version of GEVM for row major version
  * \param a The lhs vector
@@ -664,11 +745,7 @@ void gevm(A&& a, B&& b, C&& c) {
     const auto m = rows(b);
     const auto n = columns(b);
 
-    if(etl::size(b) < gevm_rm_small_threshold){
-        gevm_small_kernel_rr<default_vec>(a.memory_start(), m, n, b.memory_start(), c);
-    } else {
-        gevm_large_kernel_rr<default_vec>(a.memory_start(), m, n, b.memory_start(), c);
-    }
+    gevm_rr(a.memory_start(), m, n, b.memory_start(), c, etl::size(b) < gevm_rm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -689,13 +766,7 @@ void gevm(A&& a, B&& b, C&& c) {
     const auto m = rows(b);
     const auto n = columns(b);
 
-    if(etl::size(b) < gevm_cm_small_threshold){
-        gevm_small_kernel_cc<default_vec>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    } else {
-        c = 0;
-
-        gevm_large_kernel_cc<default_vec>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    }
+    gevm_cc(a.memory_start(), m, n, b.memory_start(), c.memory_start(), etl::size(b) < gevm_cm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -718,13 +789,7 @@ void gevm_t(A&& a, B&& b, C&& c) {
     const auto m = rows(b);
     const auto n = columns(b);
 
-    if(etl::size(b) < gevm_rm_small_threshold){
-        gevm_small_kernel_cc<default_vec>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    } else {
-        c = 0;
-
-        gevm_large_kernel_cc<default_vec>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    }
+    gevm_cc(a.memory_start(), n, m, b.memory_start(), c.memory_start(), etl::size(b) < gevm_rm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -745,13 +810,7 @@ void gevm_t(A&& a, B&& b, C&& c) {
     const auto m = rows(b);
     const auto n = columns(b);
 
-    if(etl::size(b) < gevm_cm_small_threshold){
-        gevm_small_kernel_rr<default_vec>(a.memory_start(), n, m, b.memory_start(), c);
-    } else {
-        c = 0;
-
-        gevm_large_kernel_rr<default_vec>(a.memory_start(), n, m, b.memory_start(), c);
-    }
+    gevm_rr(a.memory_start(), n, m, b.memory_start(), c, etl::size(b) < gevm_cm_small_threshold);
 
     c.invalidate_gpu();
 }
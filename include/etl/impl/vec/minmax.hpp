@@ -0,0 +1,174 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Unified vectorized implementation of the "max_index" and
+ * "min_index" reductions
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Vectorized computation of the maximum (or minimum) value and
+ * of the index of its first occurrence.
+ *
+ * The vectorization backends do not provide comparisons, therefore
+ * the extreme value is first computed with vector min/max and its index
+ * is then found with a scan of the range.
+ *
+ * \param lhs The expression to compute the extreme from
+ * \tparam V The vectorization type
+ * \tparam Max true to search the maximum, false to search the minimum
+ * \return The pair (value, index) of the extreme element of the range
+ */
+template <typename V, bool Max, typename L>
+std::pair<value_t<L>, size_t> extremum_impl(const L& lhs) {
+    using vec_type = V;
+    using T        = value_t<L>;
+
+    const size_t n = etl::size(lhs);
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto select = [](auto a, auto b) {
+        return Max ? vec_type::max(a, b) : vec_type::min(a, b);
+    };
+
+    T m = lhs[0];
+
+    size_t i = 0;
+
+    if (n >= 4 * vec_size) {
+        auto r1 = lhs.template load<vec_type>(0 * vec_size);
+        auto r2 = lhs.template load<vec_type>(1 * vec_size);
+        auto r3 = lhs.template load<vec_type>(2 * vec_size);
+        auto r4 = lhs.template load<vec_type>(3 * vec_size);
+
+        for (i = 4 * vec_size; i + (vec_size * 4) - 1 < n; i += 4 * vec_size) {
+            r1 = select(lhs.template load<vec_type>(i + 0 * vec_size), r1);
+            r2 = select(lhs.template load<vec_type>(i + 1 * vec_size), r2);
+            r3 = select(lhs.template load<vec_type>(i + 2 * vec_size), r3);
+            r4 = select(lhs.template load<vec_type>(i + 3 * vec_size), r4);
+        }
+
+        for (; i + vec_size - 1 < n; i += vec_size) {
+            r1 = select(lhs.template load<vec_type>(i), r1);
+        }
+
+        alignas(64) T lanes[vec_size];
+
+        vec_type::store(lanes, select(select(r1, r2), select(r3, r4)));
+
+        for (size_t j = 0; j < vec_size; ++j) {
+            m = Max ? std::max(m, lanes[j]) : std::min(m, lanes[j]);
+        }
+    }
+
+    for (; i < n; ++i) {
+        m = Max ? std::max(m, lhs[i]) : std::min(m, lhs[i]);
+    }
+
+    size_t index = 0;
+
+    while (index < n - 1 && lhs[index] != m) {
+        ++index;
+    }
+
+    return {m, index};
+}
+
+/*!
+ * \brief Compute the index of the first extreme element of lhs
+ * \param lhs The lhs expression
+ * \tparam Max true to search the maximum, false to search the minimum
+ * \return the index of the first extreme element
+ */
+template <bool Max, typename L>
+size_t extremum_index(const L& lhs) {
+    using T     = value_t<L>;
+    using acc_t = std::pair<T, size_t>;
+
+    safe_ensure_cpu_up_to_date(lhs);
+
+    acc_t acc;
+    bool init = false;
+
+    auto acc_functor = [&](const acc_t& partial) {
+        if (!init || (Max ? partial.first > acc.first : partial.first < acc.first)) {
+            acc  = partial;
+            init = true;
+        }
+    };
+
+    auto batch_fun = [&lhs](size_t first, size_t last) {
+        // The default vectorization scheme should be sufficient
+        auto partial = extremum_impl<default_vec, Max>(memory_slice<unaligned>(lhs, first, last));
+        partial.second += first;
+        return partial;
+    };
+
+    engine_dispatch_1d_acc<acc_t>(batch_fun, acc_functor, 0, etl::size(lhs), vec_sum_parallel_threshold);
+
+    return init ? acc.second : 0;
+}
+
+/*!
+ * \brief Compute the index of the first maximum element of lhs
+ * \param lhs The lhs expression
+ * \return the index of the first maximum element
+ */
+template <typename L, cpp_enable_iff(vec_enabled && all_vectorizable<vector_mode, L> && is_floating<L>)>
+size_t max_index(const L& lhs) {
+    cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
+
+    return extremum_index<true>(lhs);
+}
+
+/*!
+ * \brief Compute the index of the first minimum element of lhs
+ * \param lhs The lhs expression
+ * \return the index of the first minimum element
+ */
+template <typename L, cpp_enable_iff(vec_enabled && all_vectorizable<vector_mode, L> && is_floating<L>)>
+size_t min_index(const L& lhs) {
+    cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
+
+    return extremum_index<false>(lhs);
+}
+
+/*!
+ * \brief Compute the index of the first maximum element of lhs
+ * \param lhs The lhs expression
+ * \return the index of the first maximum element
+ */
+template <typename L, cpp_disable_iff(vec_enabled && all_vectorizable<vector_mode, L> && is_floating<L>)>
+size_t max_index(const L& lhs) {
+    cpp_unused(lhs);
+    cpp_unreachable("vec::max_index called with invalid parameters");
+}
+
+/*!
+ * \brief Compute the index of the first minimum element of lhs
+ * \param lhs The lhs expression
+ * \return the index of the first minimum element
+ */
+template <typename L, cpp_disable_iff(vec_enabled && all_vectorizable<vector_mode, L> && is_floating<L>)>
+size_t min_index(const L& lhs) {
+    cpp_unused(lhs);
+    cpp_unreachable("vec::min_index called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
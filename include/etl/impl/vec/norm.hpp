@@ -0,0 +1,154 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the "norm" reduction
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Compute the largest absolute value of lhs using vectorized code
+ * \param lhs The expression
+ * \return the largest absolute value of lhs
+ */
+template <typename V, typename L>
+value_t<L> amax_impl(const L& lhs) {
+    using vec_type = V;
+    using T        = value_t<L>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t n = etl::size(lhs);
+
+    T hi(0);
+    T lo(0);
+
+    size_t i = 0;
+
+    if (n >= 2 * vec_size) {
+        auto r1 = vec_type::template zero<T>();
+        auto r2 = vec_type::template zero<T>();
+        auto r3 = vec_type::template zero<T>();
+        auto r4 = vec_type::template zero<T>();
+
+        for (; i + (vec_size * 2) - 1 < n; i += 2 * vec_size) {
+            auto a1 = lhs.template load<vec_type>(i + 0 * vec_size);
+            auto a2 = lhs.template load<vec_type>(i + 1 * vec_size);
+
+            r1 = vec_type::max(a1, r1);
+            r2 = vec_type::max(a2, r2);
+            r3 = vec_type::min(a1, r3);
+            r4 = vec_type::min(a2, r4);
+        }
+
+        alignas(64) T his[vec_size];
+        alignas(64) T los[vec_size];
+
+        vec_type::store(his, vec_type::max(r1, r2));
+        vec_type::store(los, vec_type::min(r3, r4));
+
+        for (size_t j = 0; j < vec_size; ++j) {
+            hi = std::max(hi, his[j]);
+            lo = std::min(lo, los[j]);
+        }
+    }
+
+    for (; i < n; ++i) {
+        hi = std::max(hi, lhs[i]);
+        lo = std::min(lo, lhs[i]);
+    }
+
+    return std::max(hi, -lo);
+}
+
+/*!
+ * \brief Compute the largest absolute value of lhs
+ * \param lhs The expression
+ * \return the largest absolute value of lhs
+ */
+template <typename L>
+value_t<L> amax(const L& lhs) {
+    using T = value_t<L>;
+
+    T acc(0);
+
+    auto acc_functor = [&acc](T value) {
+        acc = std::max(acc, value);
+    };
+
+    auto batch_fun = [&lhs](size_t first, size_t last) {
+        // The default vectorization scheme should be sufficient
+        return amax_impl<default_vec>(memory_slice<unaligned>(lhs, first, last));
+    };
+
+    engine_dispatch_1d_acc<T>(batch_fun, acc_functor, 0, etl::size(lhs), vec_sum_parallel_threshold);
+
+    return acc;
+}
+
+/*!
+ * \brief Compute the euclidean norm of lhs
+ *
+ * The sum of squares is first computed directly, with the parallel
+ * vectorized dot product. Only when it overflows or loses precision to
+ * underflow, the elements are scaled by their largest absolute value
+ * before being squared.
+ *
+ * \param lhs The expression
+ * \return the euclidean norm of lhs
+ */
+template <typename L, cpp_enable_iff(vec_enabled && all_vectorizable<vector_mode, L> && is_floating<L>)>
+value_t<L> norm(const L& lhs) {
+    using T = value_t<L>;
+
+    const T ssq = etl::impl::vec::dot(lhs, lhs);
+
+    // Below this, the sum of squares may have lost precision to denormals
+    const T tiny = std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+
+    if (ssq >= tiny && ssq <= std::numeric_limits<T>::max()) {
+        return std::sqrt(ssq);
+    }
+
+    if (std::isnan(ssq)) {
+        return ssq;
+    }
+
+    const T scale = amax(lhs);
+
+    if (scale == T(0) || std::isinf(scale)) {
+        return scale;
+    }
+
+    // Dividing rather than multiplying by the inverse, which can overflow
+    auto scaled = lhs / scale;
+
+    return scale * std::sqrt(etl::impl::vec::dot(scaled, scaled));
+}
+
+/*!
+ * \brief Compute the euclidean norm of lhs
+ * \param lhs The expression
+ * \return the euclidean norm of lhs
+ */
+template <typename L, cpp_disable_iff(vec_enabled && all_vectorizable<vector_mode, L> && is_floating<L>)>
+value_t<L> norm(const L& lhs) {
+    cpp_unused(lhs);
+    cpp_unreachable("vec::norm called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,151 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the batch softmax
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Compute the softmax of each row of a and store the result in c
+ *
+ * Each row is processed while in cache: its maximum is computed (only
+ * for the stable version), then the exponentials are computed once,
+ * stored and summed, and finally the row is normalized.
+ *
+ * \param a The input matrix
+ * \param c The output matrix
+ * \tparam V The vectorization type
+ * \tparam Stable Indicates if the maximum of the row must be subtracted
+ */
+template <typename V, bool Stable, typename A, typename C>
+void batch_softmax_impl(const A& a, C&& c) {
+    using vec_type = V;
+    using T        = value_t<A>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t B = etl::dim<0>(a);
+    const size_t K = etl::dim<1>(a);
+
+    a.ensure_cpu_up_to_date();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            const T* a_s = a.memory_start() + i * K;
+            T* c_s       = c.memory_start() + i * K;
+
+            T m(0);
+
+            if /*constexpr*/ (Stable) {
+                m = a_s[0];
+
+                size_t k = 0;
+
+                if (K >= vec_size) {
+                    auto m1 = vec_type::loadu(a_s);
+
+                    for (k = vec_size; k + vec_size - 1 < K; k += vec_size) {
+                        m1 = vec_type::max(m1, vec_type::loadu(a_s + k));
+                    }
+
+                    alignas(64) T lanes[vec_size];
+
+                    vec_type::store(lanes, m1);
+
+                    for (size_t j = 0; j < vec_size; ++j) {
+                        m = std::max(m, lanes[j]);
+                    }
+                }
+
+                for (; k < K; ++k) {
+                    m = std::max(m, a_s[k]);
+                }
+            }
+
+            auto mv = vec_type::set(m);
+            auto s1 = vec_type::template zero<T>();
+            auto s2 = vec_type::template zero<T>();
+
+            size_t k = 0;
+
+            for (; k + 2 * vec_size - 1 < K; k += 2 * vec_size) {
+                auto e1 = vec_type::exp(vec_type::sub(vec_type::loadu(a_s + k + 0 * vec_size), mv));
+                auto e2 = vec_type::exp(vec_type::sub(vec_type::loadu(a_s + k + 1 * vec_size), mv));
+
+                vec_type::storeu(c_s + k + 0 * vec_size, e1);
+                vec_type::storeu(c_s + k + 1 * vec_size, e2);
+
+                s1 = vec_type::add(s1, e1);
+                s2 = vec_type::add(s2, e2);
+            }
+
+            for (; k + vec_size - 1 < K; k += vec_size) {
+                auto e1 = vec_type::exp(vec_type::sub(vec_type::loadu(a_s + k), mv));
+
+                vec_type::storeu(c_s + k, e1);
+
+                s1 = vec_type::add(s1, e1);
+            }
+
+            T s = vec_type::hadd(s1) + vec_type::hadd(s2);
+
+            for (; k < K; ++k) {
+                c_s[k] = std::exp(a_s[k] - m);
+                s += c_s[k];
+            }
+
+            auto inv = vec_type::set(T(1) / s);
+
+            k = 0;
+
+            for (; k + vec_size - 1 < K; k += vec_size) {
+                vec_type::storeu(c_s + k, vec_type::mul(vec_type::loadu(c_s + k), inv));
+            }
+
+            for (; k < K; ++k) {
+                c_s[k] *= T(1) / s;
+            }
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, B, engine_select_parallel(B * K, parallel_threshold) && B > 1);
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the softmax of each row of a and store the result in c
+ * \param a The input matrix
+ * \param c The output matrix
+ */
+template <typename A, typename C>
+void softmax(const A& a, C&& c) {
+    batch_softmax_impl<default_vec, false>(a, c);
+}
+
+/*!
+ * \brief Compute the stable softmax of each row of a and store the result in c
+ * \param a The input matrix
+ * \param c The output matrix
+ */
+template <typename A, typename C>
+void stable_softmax(const A& a, C&& c) {
+    batch_softmax_impl<default_vec, true>(a, c);
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -151,6 +151,34 @@ value_t<L> asum_impl(const L& lhs) {
     return p1 + p2;
 }
 
+/*!
+ * \brief Compute the sum of lhs, using the runtime dispatched kernel
+ * if the CPU supports wider vectors than the compiled ones.
+ * \param lhs The lhs expression
+ * \return the sum of the elements of lhs
+ */
+template <typename L, cpp_enable_iff(runtime_dispatch && is_dma<L> && is_floating<L>)>
+value_t<L> sum_kernel(const L& lhs) {
+    if (runtime_vector_wider()) {
+        safe_ensure_cpu_up_to_date(lhs);
+
+        return etl::detail::dispatch_sum(lhs.memory_start(), etl::size(lhs));
+    }
+
+    return sum_impl<default_vec>(lhs);
+}
+
+/*!
+ * \brief Compute the sum of lhs
+ * \param lhs The lhs expression
+ * \return the sum of the elements of lhs
+ */
+template <typename L, cpp_disable_iff(runtime_dispatch && is_dma<L> && is_floating<L>)>
+value_t<L> sum_kernel(const L& lhs) {
+    // The default vectorization scheme should be sufficient
+    return sum_impl<default_vec>(lhs);
+}
+
 /*!
  * \brief Compute the sum of lhs
  * \param lhs The lhs expression
@@ -169,12 +197,11 @@ value_t<L> sum(const L& lhs) {
     };
 
     auto batch_fun = [](auto& sub){
-        // The default vectorization scheme should be sufficient
-        return sum_impl<default_vec>(sub);
+        return sum_kernel(sub);
     };
 
     if(etl::size(lhs) < sum_parallel_threshold){
-        return sum_impl<default_vec>(lhs);
+        return sum_kernel(lhs);
     } else {
         engine_dispatch_1d_acc_slice(lhs, batch_fun, acc_functor, vec_sum_parallel_threshold);
     }
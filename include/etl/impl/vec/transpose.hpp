@@ -0,0 +1,450 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the "transpose" algorithm
+ *
+ * The matrix is transposed by cache blocks, each block being transposed by
+ * square tiles held in vector registers.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+namespace detail {
+
+/*!
+ * \brief Register-tiled transposition kernel.
+ *
+ * The generic version has no vectorized kernel, the tiles are made of a
+ * single element.
+ *
+ * \tparam T The type of the elements
+ */
+template <typename T>
+struct transpose_tile {
+    static constexpr size_t size = 1; ///< The number of rows and columns of the tile
+
+    /*!
+     * \brief Transpose a tile of a into c
+     * \param a The source tile
+     * \param lda The distance between two rows of a
+     * \param c The target tile
+     * \param ldc The distance between two rows of c
+     */
+    static void apply(const T* a, size_t lda, T* c, size_t ldc) {
+        cpp_unused(lda);
+        cpp_unused(ldc);
+
+        *c = *a;
+    }
+};
+
+#ifdef __AVX__
+
+/*!
+ * \brief Register-tiled transposition kernel, 8x8 single-precision
+ * tiles with AVX.
+ */
+template <>
+struct transpose_tile<float> {
+    static constexpr size_t size = 8; ///< The number of rows and columns of the tile
+
+    /*!
+     * \copydoc transpose_tile::apply
+     */
+    static void apply(const float* a, size_t lda, float* c, size_t ldc) {
+        __m256 r0 = _mm256_loadu_ps(a + 0 * lda);
+        __m256 r1 = _mm256_loadu_ps(a + 1 * lda);
+        __m256 r2 = _mm256_loadu_ps(a + 2 * lda);
+        __m256 r3 = _mm256_loadu_ps(a + 3 * lda);
+        __m256 r4 = _mm256_loadu_ps(a + 4 * lda);
+        __m256 r5 = _mm256_loadu_ps(a + 5 * lda);
+        __m256 r6 = _mm256_loadu_ps(a + 6 * lda);
+        __m256 r7 = _mm256_loadu_ps(a + 7 * lda);
+
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+        __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+        _mm256_storeu_ps(c + 0 * ldc, _mm256_permute2f128_ps(s0, s4, 0x20));
+        _mm256_storeu_ps(c + 1 * ldc, _mm256_permute2f128_ps(s1, s5, 0x20));
+        _mm256_storeu_ps(c + 2 * ldc, _mm256_permute2f128_ps(s2, s6, 0x20));
+        _mm256_storeu_ps(c + 3 * ldc, _mm256_permute2f128_ps(s3, s7, 0x20));
+        _mm256_storeu_ps(c + 4 * ldc, _mm256_permute2f128_ps(s0, s4, 0x31));
+        _mm256_storeu_ps(c + 5 * ldc, _mm256_permute2f128_ps(s1, s5, 0x31));
+        _mm256_storeu_ps(c + 6 * ldc, _mm256_permute2f128_ps(s2, s6, 0x31));
+        _mm256_storeu_ps(c + 7 * ldc, _mm256_permute2f128_ps(s3, s7, 0x31));
+    }
+};
+
+/*!
+ * \brief Register-tiled transposition kernel, 4x4 double-precision
+ * tiles with AVX.
+ */
+template <>
+struct transpose_tile<double> {
+    static constexpr size_t size = 4; ///< The number of rows and columns of the tile
+
+    /*!
+     * \copydoc transpose_tile::apply
+     */
+    static void apply(const double* a, size_t lda, double* c, size_t ldc) {
+        __m256d r0 = _mm256_loadu_pd(a + 0 * lda);
+        __m256d r1 = _mm256_loadu_pd(a + 1 * lda);
+        __m256d r2 = _mm256_loadu_pd(a + 2 * lda);
+        __m256d r3 = _mm256_loadu_pd(a + 3 * lda);
+
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+        _mm256_storeu_pd(c + 0 * ldc, _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(c + 1 * ldc, _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(c + 2 * ldc, _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(c + 3 * ldc, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+};
+
+#elif defined(__SSE3__)
+
+/*!
+ * \brief Register-tiled transposition kernel, 4x4 single-precision
+ * tiles with SSE.
+ */
+template <>
+struct transpose_tile<float> {
+    static constexpr size_t size = 4; ///< The number of rows and columns of the tile
+
+    /*!
+     * \copydoc transpose_tile::apply
+     */
+    static void apply(const float* a, size_t lda, float* c, size_t ldc) {
+        __m128 r0 = _mm_loadu_ps(a + 0 * lda);
+        __m128 r1 = _mm_loadu_ps(a + 1 * lda);
+        __m128 r2 = _mm_loadu_ps(a + 2 * lda);
+        __m128 r3 = _mm_loadu_ps(a + 3 * lda);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        _mm_storeu_ps(c + 0 * ldc, r0);
+        _mm_storeu_ps(c + 1 * ldc, r1);
+        _mm_storeu_ps(c + 2 * ldc, r2);
+        _mm_storeu_ps(c + 3 * ldc, r3);
+    }
+};
+
+/*!
+ * \brief Register-tiled transposition kernel, 2x2 double-precision
+ * tiles with SSE.
+ */
+template <>
+struct transpose_tile<double> {
+    static constexpr size_t size = 2; ///< The number of rows and columns of the tile
+
+    /*!
+     * \copydoc transpose_tile::apply
+     */
+    static void apply(const double* a, size_t lda, double* c, size_t ldc) {
+        __m128d r0 = _mm_loadu_pd(a + 0 * lda);
+        __m128d r1 = _mm_loadu_pd(a + 1 * lda);
+
+        _mm_storeu_pd(c + 0 * ldc, _mm_unpacklo_pd(r0, r1));
+        _mm_storeu_pd(c + 1 * ldc, _mm_unpackhi_pd(r0, r1));
+    }
+};
+
+#endif
+
+/*!
+ * \brief Transpose the row-major rows x cols block a into the row-major
+ * cols x rows block c.
+ *
+ * The block is transposed with register tiles, the borders that do not
+ * fill a complete tile are transposed element by element. The tiles are
+ * visited along the rows of c so that each row of c is written
+ * contiguously.
+ *
+ * \param a The source block
+ * \param lda The distance between two rows of a
+ * \param c The target block
+ * \param ldc The distance between two rows of c
+ * \param rows The number of rows of a
+ * \param cols The number of columns of a
+ */
+template <typename T>
+void transpose_block(const T* a, size_t lda, T* c, size_t ldc, size_t rows, size_t cols) {
+    using tile = transpose_tile<T>;
+
+    static constexpr size_t R = tile::size;
+
+    const size_t ie = (rows / R) * R;
+    const size_t je = (cols / R) * R;
+
+    for (size_t j = 0; j < je; j += R) {
+        for (size_t i = 0; i < ie; i += R) {
+            tile::apply(a + i * lda + j, lda, c + j * ldc + i, ldc);
+        }
+
+        for (size_t jj = j; jj < j + R; ++jj) {
+            for (size_t i = ie; i < rows; ++i) {
+                c[jj * ldc + i] = a[i * lda + jj];
+            }
+        }
+    }
+
+    for (size_t j = je; j < cols; ++j) {
+        for (size_t i = 0; i < rows; ++i) {
+            c[j * ldc + i] = a[i * lda + j];
+        }
+    }
+}
+
+/*!
+ * \brief Transpose the row-major m x n matrix a into the row-major n x m
+ * matrix c.
+ *
+ * The rows of c are partitioned in blocks of transpose_block_size rows
+ * which are dispatched over the thread engine, each thread writing a
+ * contiguous part of c.
+ *
+ * Large outputs are written with non-temporal stores: each block is
+ * first transposed in a small buffer which is then streamed to c, so
+ * that complete cache lines are streamed.
+ *
+ * \param a The source matrix
+ * \param m The number of rows of a
+ * \param n The number of columns of a
+ * \param c The target matrix
+ */
+template <typename T>
+void transpose_kernel(const T* a, size_t m, size_t n, T* c) {
+    using vec_type = default_vec;
+    using intrinsic_traits = typename vec_type::template traits<T>;
+
+    static constexpr size_t vec_size = intrinsic_traits::size;
+    static constexpr size_t B        = transpose_block_size;
+
+    const bool stream = intrinsic_traits::vectorizable && m % vec_size == 0 && B % vec_size == 0
+                        && reinterpret_cast<uintptr_t>(c) % intrinsic_traits::alignment == 0
+                        && m * n > stream_threshold / (sizeof(T) * 2);
+
+    const size_t blocks = (n + B - 1) / B;
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        auto buffer = etl::allocate<T>(stream ? B * B : 0);
+
+        for (size_t b = first; b < last; ++b) {
+            const size_t j0   = b * B;
+            const size_t cols = std::min(B, n - j0);
+
+            for (size_t i0 = 0; i0 < m; i0 += B) {
+                const size_t rows = std::min(B, m - i0);
+
+                if (stream) {
+                    transpose_block(a + i0 * n + j0, n, buffer.get(), B, rows, cols);
+
+                    for (size_t j = 0; j < cols; ++j) {
+                        for (size_t i = 0; i < rows; i += vec_size) {
+                            vec_type::stream(c + (j0 + j) * m + i0 + i, vec_type::loadu(buffer.get() + j * B + i));
+                        }
+                    }
+                } else {
+                    transpose_block(a + i0 * n + j0, n, c + j0 * m + i0, m, rows, cols);
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, blocks, engine_select_parallel(m * n, transpose_parallel_threshold) && blocks > 1);
+}
+
+/*!
+ * \brief Transpose the square row-major n x n matrix c inplace.
+ *
+ * The tiles on each side of the diagonal are loaded, transposed in
+ * registers and stored at the place of each other.
+ *
+ * \param c The matrix
+ * \param n The number of rows and columns of c
+ */
+template <typename T>
+void inplace_square_transpose_kernel(T* c, size_t n) {
+    using tile = transpose_tile<T>;
+
+    static constexpr size_t R = tile::size;
+
+    T tmp[R * R];
+
+    size_t i = 0;
+
+    for (; i + R <= n; i += R) {
+        // The tile on the diagonal is entirely loaded before being stored
+
+        tile::apply(c + i * n + i, n, c + i * n + i, n);
+
+        // The pairs of tiles on both sides of the diagonal
+
+        size_t j = i + R;
+
+        for (; j + R <= n; j += R) {
+            tile::apply(c + i * n + j, n, tmp, R);
+            tile::apply(c + j * n + i, n, c + i * n + j, n);
+
+            for (size_t k = 0; k < R; ++k) {
+                std::copy_n(tmp + k * R, R, c + (j + k) * n + i);
+            }
+        }
+
+        // The remaining columns
+
+        for (; j < n; ++j) {
+            for (size_t ii = i; ii < i + R; ++ii) {
+                std::swap(c[ii * n + j], c[j * n + ii]);
+            }
+        }
+    }
+
+    // The remaining bottom-right corner
+
+    for (; i < n; ++i) {
+        for (size_t j = i + 1; j < n; ++j) {
+            std::swap(c[i * n + j], c[j * n + i]);
+        }
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Inplace transposition of the square matrix c
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_enable_iff(is_dma<C>&& is_floating<C>)>
+void inplace_square_transpose(C&& c) {
+    c.ensure_cpu_up_to_date();
+
+    detail::inplace_square_transpose_kernel(c.memory_start(), etl::dim<0>(c));
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Inplace transposition of the rectangular matrix c
+ *
+ * Large matrices are transposed without a copy by the standard
+ * decomposition, smaller matrices are transposed from a temporary copy.
+ *
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_enable_iff(is_dma<C>&& is_floating<C>)>
+void inplace_rectangular_transpose(C&& c) {
+    static constexpr bool row_major = decay_traits<C>::storage_order == order::RowMajor;
+
+    c.ensure_cpu_up_to_date();
+
+    // The memory of a column-major matrix is the one of its row-major transpose
+    const size_t m = row_major ? etl::dim<0>(c) : etl::dim<1>(c);
+    const size_t n = row_major ? etl::dim<1>(c) : etl::dim<0>(c);
+
+    if (m * n >= inplace_transpose_threshold) {
+        etl::impl::standard::detail::inplace_rectangular_transpose_kernel(c.memory_start(), m, n);
+    } else {
+        auto copy = force_temporary(c);
+
+        detail::transpose_kernel(copy.memory_start(), m, n, c.memory_start());
+    }
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Transpose the matrix a and the store the result in c
+ * \param a The matrix to transpose
+ * \param c The target matrix
+ */
+template <typename A, typename C, cpp_enable_iff(all_dma<A, C>&& all_floating<A, C>&& all_homogeneous<A, C>)>
+void transpose(A&& a, C&& c) {
+    static constexpr bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+
+    // Delegate aliasing transpose to inplace algorithm
+    if (a.alias(c)) {
+        if (etl::dim<0>(a) == etl::dim<1>(a)) {
+            inplace_square_transpose(c);
+        } else {
+            inplace_rectangular_transpose(c);
+        }
+    } else {
+        a.ensure_cpu_up_to_date();
+
+        // The memory of a column-major matrix is the one of its row-major transpose
+        const size_t m = row_major ? etl::dim<0>(a) : etl::dim<1>(a);
+        const size_t n = row_major ? etl::dim<1>(a) : etl::dim<0>(a);
+
+        detail::transpose_kernel(a.memory_start(), m, n, c.memory_start());
+
+        c.validate_cpu();
+        c.invalidate_gpu();
+    }
+}
+
+/*!
+ * \brief Inplace transposition of the square matrix c
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_disable_iff(is_dma<C>&& is_floating<C>)>
+void inplace_square_transpose(C&& c) {
+    cpp_unused(c);
+    cpp_unreachable("Invalid call to vec::inplace_square_transpose");
+}
+
+/*!
+ * \brief Inplace transposition of the rectangular matrix c
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_disable_iff(is_dma<C>&& is_floating<C>)>
+void inplace_rectangular_transpose(C&& c) {
+    cpp_unused(c);
+    cpp_unreachable("Invalid call to vec::inplace_rectangular_transpose");
+}
+
+/*!
+ * \brief Transpose the matrix a and the store the result in c
+ * \param a The matrix to transpose
+ * \param c The target matrix
+ */
+template <typename A, typename C, cpp_disable_iff(all_dma<A, C>&& all_floating<A, C>&& all_homogeneous<A, C>)>
+void transpose(A&& a, C&& c) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unreachable("Invalid call to vec::transpose");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
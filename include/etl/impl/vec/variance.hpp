@@ -0,0 +1,125 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Unified vectorized implementation of the "variance" reduction
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Vectorized single-pass computation of the mean and the variance.
+ *
+ * Each lane of the vectors holds its own Welford state, the lanes are
+ * merged at the end.
+ *
+ * \param lhs The expression to compute the variance from
+ * \tparam V The vectorization type
+ * \return The state of the computation
+ */
+template <typename V, typename L>
+etl::detail::welford_acc<value_t<L>> variance_impl(const L& lhs) {
+    using vec_type = V;
+    using T        = value_t<L>;
+
+    const size_t n = etl::size(lhs);
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t i = 0;
+    size_t k = 0;
+
+    auto mean = vec_type::template zero<T>();
+    auto m2   = vec_type::template zero<T>();
+
+    for (; i + vec_size - 1 < n; i += vec_size) {
+        ++k;
+
+        auto x     = lhs.template load<vec_type>(i);
+        auto delta = vec_type::sub(x, mean);
+
+        mean = vec_type::add(mean, vec_type::mul(delta, vec_type::set(T(1) / T(k))));
+        m2   = vec_type::fmadd(delta, vec_type::sub(x, mean), m2);
+    }
+
+    etl::detail::welford_acc<T> acc;
+
+    if (k) {
+        alignas(64) T means[vec_size];
+        alignas(64) T m2s[vec_size];
+
+        vec_type::store(means, mean);
+        vec_type::store(m2s, m2);
+
+        for (size_t j = 0; j < vec_size; ++j) {
+            etl::detail::welford_acc<T> lane;
+
+            lane.n    = k;
+            lane.mean = means[j];
+            lane.m2   = m2s[j];
+
+            acc.merge(lane);
+        }
+    }
+
+    for (; i < n; ++i) {
+        acc.push(lhs[i]);
+    }
+
+    return acc;
+}
+
+/*!
+ * \brief Compute the mean and the variance of lhs in a single pass
+ * \param lhs The lhs expression
+ * \return the state of the computation
+ */
+template <typename L, cpp_enable_iff(vec_enabled && all_vectorizable<vector_mode, L> && is_floating<L>)>
+etl::detail::welford_t<L> variance(const L& lhs) {
+    cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
+
+    using acc_t = etl::detail::welford_t<L>;
+
+    safe_ensure_cpu_up_to_date(lhs);
+
+    acc_t acc;
+
+    auto acc_functor = [&acc](const acc_t& partial) {
+        acc.merge(partial);
+    };
+
+    auto batch_fun = [&lhs](size_t first, size_t last) {
+        // The default vectorization scheme should be sufficient
+        return variance_impl<default_vec>(memory_slice<unaligned>(lhs, first, last));
+    };
+
+    engine_dispatch_1d_acc<acc_t>(batch_fun, acc_functor, 0, etl::size(lhs), vec_sum_parallel_threshold);
+
+    return acc;
+}
+
+/*!
+ * \brief Compute the mean and the variance of lhs in a single pass
+ * \param lhs The lhs expression
+ * \return the state of the computation
+ */
+template <typename L, cpp_disable_iff(vec_enabled && all_vectorizable<vector_mode, L> && is_floating<L>)>
+etl::detail::welford_t<L> variance(const L& lhs) {
+    cpp_unused(lhs);
+    cpp_unreachable("vec::variance called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
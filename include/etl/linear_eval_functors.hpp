@@ -33,6 +33,11 @@ struct Assign {
 
         auto* lhs_mem = lhs.memory_start();
 
+        if /*constexpr*/ (runtime_dispatch) {
+            dispatch_assign(lhs_mem, rhs, N);
+            return;
+        }
+
         size_t i = 0;
 
         if /*constexpr*/ (unroll_normal_loops) {
@@ -61,6 +61,17 @@ struct no_vec {
         cpp_unused(value);
     }
 
+    /*!
+     * \brief Non-temporal, aligned, store value to memory
+     * \param memory The target memory
+     * \param value The value to store
+     */
+    template <typename F, typename M>
+    static inline void stream(F* memory, M value) {
+        cpp_unused(memory);
+        cpp_unused(value);
+    }
+
     /*!
      * \brief Aligned load a vector from memory
      * \param memory The target memory
@@ -209,6 +220,17 @@ struct no_vec {
         return M();
     }
 
+    /*!
+     * \brief Vector exponential
+     * \param value The input values
+     * \return The exponential of the input values
+     */
+    template <typename M>
+    static M exp(M value) {
+        cpp_unused(value);
+        return M();
+    }
+
     /*!
      * \brief Compute the negative value of the input
      * \param value The input values
@@ -25,7 +25,7 @@ struct div_binary_op {
      * Note: Integer division is not yet supported
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = is_floating_t<T> || (is_complex_t<T> && V != vector_mode_t::AVX512);
+    static constexpr bool vectorizable = is_floating_t<T> || is_complex_t<T>;
 
     /*!
      * \brief Indicates if the operator can be computd on GPU
@@ -24,7 +24,7 @@ struct mul_binary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = V == vector_mode_t::AVX512 ? !is_complex_t<T> : true;
+    static constexpr bool vectorizable = true;
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -48,5 +48,6 @@
 #include "etl/op/binary/one_if.hpp"
 #include "etl/op/binary/ranged_noise.hpp"
 #include "etl/op/binary/sigmoid_derivative.hpp"
+#include "etl/op/binary/tanh_derivative.hpp"
 #include "etl/op/binary/relu_derivative.hpp"
 #include "etl/op/binary/pow.hpp"
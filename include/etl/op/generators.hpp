@@ -18,13 +18,19 @@ namespace etl {
 
 /*!
  * \brief Generator from a normal distribution
+ *
+ * The values are drawn from a counter-based generator, the value of
+ * each element only depends on the key and on its index.
  */
 template <typename T = double>
 struct normal_generator_op {
     using value_type = T; ///< The value type
 
-    random_engine rand_engine;                         ///< The random engine
-    std::normal_distribution<value_type> distribution; ///< The used distribution
+    static constexpr bool indexed = true; ///< Indicates if the generator needs the index of the element
+
+    const uint64_t key;      ///< The key of the counter-based generator
+    const value_type mean;   ///< The mean of the distribution
+    const value_type stddev; ///< The standard deviation of the distribution
 
     /*!
      * \brief Construct a new generator with the given mean and standard deviation
@@ -32,14 +38,15 @@ struct normal_generator_op {
      * \param stddev The standard deviation
      */
     normal_generator_op(T mean, T stddev)
-            : rand_engine(std::time(nullptr)), distribution(mean, stddev) {}
+            : key(random_key()), mean(mean), stddev(stddev) {}
 
     /*!
-     * \brief Generate a new value
-     * \return the newly generated value
+     * \brief Generate the value of the element i
+     * \param i The index of the element
+     * \return the generated value
      */
-    value_type operator()() {
-        return distribution(rand_engine);
+    value_type operator()(size_t i) const {
+        return mean + stddev * counter_normal<random_real_t<T>>(key, i);
     }
 
     /*!
@@ -93,14 +100,20 @@ struct normal_generator_g_op {
 };
 
 /*!
- * \brief Generator from a normal distribution
+ * \brief Generator from a truncated normal distribution
+ *
+ * The values are drawn from a counter-based generator, the value of
+ * each element only depends on the key and on its index.
  */
 template <typename T = double>
 struct truncated_normal_generator_op {
     using value_type = T; ///< The value type
 
-    random_engine rand_engine;                         ///< The random engine
-    std::normal_distribution<value_type> distribution; ///< The used distribution
+    static constexpr bool indexed = true; ///< Indicates if the generator needs the index of the element
+
+    const uint64_t key;      ///< The key of the counter-based generator
+    const value_type mean;   ///< The mean of the distribution
+    const value_type stddev; ///< The standard deviation of the distribution
 
     /*!
      * \brief Construct a new generator with the given mean and standard deviation
@@ -108,20 +121,24 @@ struct truncated_normal_generator_op {
      * \param stddev The standard deviation
      */
     truncated_normal_generator_op(T mean, T stddev)
-            : rand_engine(std::time(nullptr)), distribution(mean, stddev) {}
+            : key(random_key()), mean(mean), stddev(stddev) {}
 
     /*!
-     * \brief Generate a new value
-     * \return the newly generated value
+     * \brief Generate the value of the element i
+     * \param i The index of the element
+     * \return the generated value
      */
-    value_type operator()() {
-        auto x = distribution(rand_engine);
+    value_type operator()(size_t i) const {
+        // Each rejected value is replaced by one from the next stream
+        uint64_t stream = 0;
 
-        while (std::abs(x - distribution.mean()) > 2.0 * distribution.stddev()) {
-            x = distribution(rand_engine);
+        auto x = counter_normal<random_real_t<T>>(key, i, stream);
+
+        while (std::abs(x) > 2.0) {
+            x = counter_normal<random_real_t<T>>(key, i, ++stream);
         }
 
-        return x;
+        return mean + stddev * x;
     }
 
     /*!
@@ -192,13 +209,19 @@ using uniform_distribution = std::conditional_t<
 
 /*!
  * \brief Generator from an uniform distribution
+ *
+ * The values are drawn from a counter-based generator, the value of
+ * each element only depends on the key and on its index.
  */
 template <typename T = double>
 struct uniform_generator_op {
     using value_type = T; ///< The value type
 
-    random_engine rand_engine;                     ///< The random engine
-    uniform_distribution<value_type> distribution; ///< The used distribution
+    static constexpr bool indexed = true; ///< Indicates if the generator needs the index of the element
+
+    const uint64_t key;     ///< The key of the counter-based generator
+    const value_type start; ///< The beginning of the range
+    const value_type end;   ///< The end of the range
 
     /*!
      * \brief Construct a new generator with the given start and end of the range
@@ -206,14 +229,22 @@ struct uniform_generator_op {
      * \param end The end of the range
      */
     uniform_generator_op(T start, T end)
-            : rand_engine(std::time(nullptr)), distribution(start, end) {}
+            : key(random_key()), start(start), end(end) {}
 
     /*!
-     * \brief Generate a new value
-     * \return the newly generated value
+     * \brief Generate the value of the element i
+     * \param i The index of the element
+     * \return the generated value
      */
-    value_type operator()() {
-        return distribution(rand_engine);
+    value_type operator()(size_t i) const {
+        auto u = counter_uniform<random_real_t<T>>(key, i);
+
+        if (std::is_floating_point<T>::value) {
+            return start + (end - start) * u;
+        } else {
+            // The range of an integer distribution is inclusive
+            return std::min(end, value_type(start + std::floor(u * (double(end) - double(start) + 1.0))));
+        }
     }
 
     /*!
@@ -480,39 +480,119 @@ void im2col_direct(M& m, A&& sub, size_t k1, size_t k2) {
 
 //im2col version without any need for transpose
 
+/*!
+ * \brief Copy n elements of a row of an image, taking every s-th element
+ * \param source The first element of the row
+ * \param target The output
+ * \param n The number of elements to copy
+ * \param s The stride between the elements of the row
+ */
+template <typename T>
+void strided_copy_n(const T* source, T* target, size_t n, size_t s) {
+    if (s == 1) {
+        direct_copy_n(source, target, n);
+    } else {
+        for (size_t j = 0; j < n; ++j) {
+            target[j] = source[j * s];
+        }
+    }
+}
+
+/*!
+ * \brief Compute the range of the columns of a row of an im2col matrix
+ * that fall inside the image, the other ones being in the padding.
+ *
+ * \param i2 The number of columns of the image
+ * \param width The number of columns of the row of the im2col matrix
+ * \param w_source The column of the kernel
+ * \param s2 The stride in the second dimension
+ * \param p2 The padding in the second dimension
+ *
+ * \return The range [first, last) of the columns inside the image
+ */
+inline std::pair<size_t, size_t> im2col_direct_tr_range(size_t i2, size_t width, size_t w_source, size_t s2, size_t p2) {
+    const size_t first = w_source >= p2 ? 0 : std::min(width, (p2 - w_source + s2 - 1) / s2);
+    const size_t last  = i2 + p2 > w_source ? std::min(width, (i2 + p2 - w_source - 1) / s2 + 1) : 0;
+
+    return {first, std::max(first, last)};
+}
+
+/*!
+ * \brief Fill one row of an im2col matrix from one row of an image, the
+ * columns falling in the padding being set to zero.
+ *
+ * \param source The first element of the row of the image used by the first column of the range
+ * \param target The row of the im2col matrix
+ * \param width The number of columns of the row of the im2col matrix
+ * \param range The range of the columns inside the image
+ * \param s2 The stride in the second dimension
+ */
+template <typename T>
+void im2col_direct_tr_row(const T* source, T* target, size_t width, std::pair<size_t, size_t> range, size_t s2) {
+    std::fill_n(target, range.first, T(0));
+
+    strided_copy_n(source, target + range.first, range.second - range.first, s2);
+
+    std::fill(target + range.second, target + width, T(0));
+}
+
 /*!
  * \brief Convert an image to a sequence of image columns to be multiplied by kernels of size (k1,k2).
  *
  * This special version does not require any transposition when used.
  *
+ * When strides are given, only the columns of the strided output
+ * positions are generated. The padding is implicit, the image is never
+ * copied into a padded image.
+ *
+ * When sub is a 3D [C, H, W] image, the columns of all the channels are
+ * stacked, channel after channel, in a single (C * k1 * k2) rows matrix.
+ *
  * \param m The output matrix
  * \param sub The input image
  * \param k1 The first dimension of ther kernel
  * \param k2 The second dimension of ther kernel
+ * \param s1 The stride in the first dimension
+ * \param s2 The stride in the second dimension
+ * \param p1 The padding in the first dimension
+ * \param p2 The padding in the second dimension
  */
 template <typename A, typename M>
-void im2col_direct_tr(M& m, A&& sub, size_t k1, size_t k2) {
+void im2col_direct_tr(M& m, A&& sub, size_t k1, size_t k2, size_t s1 = 1, size_t s2 = 1, size_t p1 = 0, size_t p2 = 0) {
     static_assert(all_dma<A, M>, "im2col_direct_tr has only been implemented for direct memory access");
 
-    const size_t i1 = etl::dim<0>(sub);
-    const size_t i2 = etl::dim<1>(sub);
+    constexpr size_t D = decay_traits<A>::dimensions();
+
+    const size_t i1 = etl::dim(sub, D - 2);
+    const size_t i2 = etl::dim(sub, D - 1);
+
+    // The number of channels (1 for a single image)
+    const size_t C = etl::size(sub) / (i1 * i2);
 
-    const auto height = i1 - k1 + 1;
-    const auto width  = i2 - k2 + 1;
+    const auto height = (i1 + 2 * p1 - k1) / s1 + 1;
+    const auto width  = (i2 + 2 * p2 - k2) / s2 + 1;
 
     const auto mm = m.memory_start();
     const auto ss = sub.memory_start();
 
-    for (size_t c = 0; c < k1 * k2; ++c) {
+    for (size_t c = 0; c < C * k1 * k2; ++c) {
         const size_t w_source = c % k2;
         const size_t h_source = (c / k2) % k1;
         const size_t c_source = c / (k1 * k2);
 
+        const auto range = im2col_direct_tr_range(i2, width, w_source, s2, p2);
+
         for (size_t h = 0; h < height; ++h) {
-            const size_t block_source = (c_source * i1 + h + h_source) * i2 + w_source;
+            const size_t row          = h * s1 + h_source;
             const size_t block_target = (c * height + h) * width;
 
-            direct_copy_n(ss + block_source, mm + block_target, width);
+            if (row >= p1 && row - p1 < i1) {
+                const size_t block_source = (c_source * i1 + row - p1) * i2 + range.first * s2 + w_source - p2;
+
+                im2col_direct_tr_row(ss + block_source, mm + block_target, width, range, s2);
+            } else {
+                std::fill_n(mm + block_target, width, value_t<M>(0));
+            }
         }
     }
 }
@@ -522,36 +602,61 @@ void im2col_direct_tr(M& m, A&& sub, size_t k1, size_t k2) {
  *
  * This special version does not require any transposition when used.
  *
+ * When strides are given, only the columns of the strided output
+ * positions are generated. The padding is implicit, the images are never
+ * copied into padded images.
+ *
+ * When sub is a 4D [N, C, H, W] batch, the columns of all the channels are
+ * stacked in (C * k1 * k2) rows, with the columns of the N images side by
+ * side in each row.
+ *
  * \param m The output matrix
- * \param sub The input image
+ * \param sub The input images
  * \param k1 The first dimension of ther kernel
  * \param k2 The second dimension of ther kernel
+ * \param s1 The stride in the first dimension
+ * \param s2 The stride in the second dimension
+ * \param p1 The padding in the first dimension
+ * \param p2 The padding in the second dimension
  */
 template <typename A, typename M>
-void im2col_direct_tr_multi(M& m, A&& sub, size_t k1, size_t k2) {
+void im2col_direct_tr_multi(M& m, A&& sub, size_t k1, size_t k2, size_t s1 = 1, size_t s2 = 1, size_t p1 = 0, size_t p2 = 0) {
     static_assert(all_dma<A, M>, "im2col_direct_tr has only been implemented for direct memory access");
 
+    constexpr size_t D = decay_traits<A>::dimensions();
+
     const auto N  = etl::dim<0>(sub);
-    const auto i1 = etl::dim<1>(sub);
-    const auto i2 = etl::dim<2>(sub);
+    const auto i1 = etl::dim(sub, D - 2);
+    const auto i2 = etl::dim(sub, D - 1);
+
+    // The number of channels (1 for single-channel images)
+    const auto C = etl::size(sub) / (N * i1 * i2);
 
-    const auto height = i1 - k1 + 1;
-    const auto width  = i2 - k2 + 1;
+    const auto height = (i1 + 2 * p1 - k1) / s1 + 1;
+    const auto width  = (i2 + 2 * p2 - k2) / s2 + 1;
 
     const auto mm = m.memory_start();
     const auto ss = sub.memory_start();
 
-    for (size_t w = 0; w < k1 * k2; ++w) {
+    for (size_t w = 0; w < C * k1 * k2; ++w) {
         const auto w_source = w % k2;
         const auto h_source = (w / k2) % k1;
         const auto c_source = w / (k1 * k2);
 
+        const auto range = im2col_direct_tr_range(i2, width, w_source, s2, p2);
+
         for (size_t i = 0; i < N; ++i) {
             for (size_t h = 0; h < height; ++h) {
-                const auto block_source = ((c_source * i1 + h + h_source) * i2 + w_source) + (i) * (i1 * i2);
+                const auto row          = h * s1 + h_source;
                 const auto block_target = (w * N + i) * (height * width) + h * width;
 
-                etl::direct_copy_n(ss + block_source, mm + block_target, width);
+                if (row >= p1 && row - p1 < i1) {
+                    const auto block_source = (c_source * i1 + row - p1) * i2 + range.first * s2 + w_source - p2 + i * (C * i1 * i2);
+
+                    im2col_direct_tr_row(ss + block_source, mm + block_target, width, range, s2);
+                } else {
+                    std::fill_n(mm + block_target, width, value_t<M>(0));
+                }
             }
         }
     }
@@ -11,12 +11,26 @@ namespace etl {
 
 /*!
  * \brief Unary operation sampling with a Bernoulli distribution
+ *
+ * The samples are drawn from a counter-based generator, the sample of
+ * each element only depends on the key of the operator and on its index.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct bernoulli_unary_op {
     static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed = true;  ///< Indicates if the operator needs the index of the element
+
+    const uint64_t key; ///< The key of the counter-based generator
+
+    /*!
+     * \brief Construct a new bernoulli_unary_op with a new key
+     */
+    bernoulli_unary_op() : key(random_key()) {
+        //Nothing else to init
+    }
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
@@ -24,7 +38,10 @@ struct bernoulli_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
+    static constexpr bool vectorizable =
+            (V == vector_mode_t::SSE3 && is_floating_t<T>)
+        ||  (V == vector_mode_t::AVX && is_floating_t<T>)
+        ||  (V == vector_mode_t::AVX512 && is_floating_t<T>);
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -32,16 +49,42 @@ struct bernoulli_unary_op {
     template <typename E>
     static constexpr bool gpu_computable = false;
 
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    T apply(const T& x, size_t i) const {
+        return x > counter_uniform<random_real_t<T>>(key, i) ? 1.0 : 0.0;
+    }
 
-        return x > distribution(rand_engine) ? 1.0 : 0.0;
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    vec_type<V> load(const vec_type<V>& x, size_t i) const noexcept {
+        static constexpr size_t vec_size = V::template traits<T>::size;
+
+        alignas(64) T u[vec_size];
+        counter_uniform_fill(u, vec_size, key, i);
+
+        // x > u ? 1 : 0
+        auto one = V::set(T(1));
+        auto t1  = V::max(V::set(T(0)), V::sub(x, V::load(u)));
+        auto t2  = V::round_up(V::min(one, t1));
+
+        return t2;
     }
 
     /*!
@@ -111,12 +154,26 @@ public:
 
 /*!
  * \brief Unary operation sampling with a reverse Bernoulli distribution
+ *
+ * The samples are drawn from a counter-based generator, the sample of
+ * each element only depends on the key of the operator and on its index.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct reverse_bernoulli_unary_op {
     static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed = true;  ///< Indicates if the operator needs the index of the element
+
+    const uint64_t key; ///< The key of the counter-based generator
+
+    /*!
+     * \brief Construct a new reverse_bernoulli_unary_op with a new key
+     */
+    reverse_bernoulli_unary_op() : key(random_key()) {
+        //Nothing else to init
+    }
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
@@ -124,7 +181,10 @@ struct reverse_bernoulli_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
+    static constexpr bool vectorizable =
+            (V == vector_mode_t::SSE3 && is_floating_t<T>)
+        ||  (V == vector_mode_t::AVX && is_floating_t<T>)
+        ||  (V == vector_mode_t::AVX512 && is_floating_t<T>);
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -132,16 +192,42 @@ struct reverse_bernoulli_unary_op {
     template <typename E>
     static constexpr bool gpu_computable = false;
 
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    T apply(const T& x, size_t i) const {
+        return x > counter_uniform<random_real_t<T>>(key, i) ? 0.0 : 1.0;
+    }
 
-        return x > distribution(rand_engine) ? 0.0 : 1.0;
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    vec_type<V> load(const vec_type<V>& x, size_t i) const noexcept {
+        static constexpr size_t vec_size = V::template traits<T>::size;
+
+        alignas(64) T u[vec_size];
+        counter_uniform_fill(u, vec_size, key, i);
+
+        // x > u ? 1 : 0
+        auto one = V::set(T(1));
+        auto t1  = V::max(V::set(T(0)), V::sub(x, V::load(u)));
+        auto t2  = V::round_up(V::min(one, t1));
+
+        return V::sub(one, t2);
     }
 
     /*!
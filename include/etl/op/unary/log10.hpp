@@ -27,8 +27,9 @@ struct log10_unary_op {
      */
     template <vector_mode_t V>
     static constexpr bool vectorizable =
-                (V == vector_mode_t::SSE3 && is_single_precision_t<T>)
-            ||  (V == vector_mode_t::AVX && is_single_precision_t<T>)
+                (V == vector_mode_t::SSE3 && is_floating_t<T>)
+            ||  (V == vector_mode_t::AVX && is_floating_t<T>)
+            ||  (V == vector_mode_t::AVX512 && is_floating_t<T>)
             ||  (intel_compiler && !is_complex_t<T>);
 
     /*!
@@ -11,12 +11,26 @@ namespace etl {
 
 /*!
  * \brief Unary operation applying an uniform noise (0.0, 1.0(
+ *
+ * The noise is drawn from a counter-based generator, the noise of each
+ * element only depends on the key of the operator and on its index.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct uniform_noise_unary_op {
     static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed = true;  ///< Indicates if the operator needs the index of the element
+
+    const uint64_t key; ///< The key of the counter-based generator
+
+    /*!
+     * \brief Construct a new uniform_noise_unary_op with a new key
+     */
+    uniform_noise_unary_op() : key(random_key()) {
+        //Nothing else to init
+    }
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
@@ -24,7 +38,10 @@ struct uniform_noise_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
+    static constexpr bool vectorizable =
+            (V == vector_mode_t::SSE3 && is_floating_t<T>)
+        ||  (V == vector_mode_t::AVX && is_floating_t<T>)
+        ||  (V == vector_mode_t::AVX512 && is_floating_t<T>);
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -32,16 +49,37 @@ struct uniform_noise_unary_op {
     template <typename E>
     static constexpr bool gpu_computable = false;
 
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::uniform_real_distribution<double> real_distribution(0.0, 1.0);
+    T apply(const T& x, size_t i) const {
+        return x + counter_uniform<random_real_t<T>>(key, i);
+    }
 
-        return x + real_distribution(rand_engine);
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    vec_type<V> load(const vec_type<V>& x, size_t i) const noexcept {
+        static constexpr size_t vec_size = V::template traits<T>::size;
+
+        alignas(64) T u[vec_size];
+        counter_uniform_fill(u, vec_size, key, i);
+
+        return V::add(x, V::load(u));
     }
 
     /*!
@@ -111,12 +149,28 @@ public:
 
 /*!
  * \brief Unary operation applying a normal noise
+ *
+ * The noise is drawn from a counter-based generator, the noise of each
+ * element only depends on the key of the operator and on its index.
+ * The vectorized Box-Muller transform may differ from the scalar one in
+ * the last bits.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct normal_noise_unary_op {
     static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed = true;  ///< Indicates if the operator needs the index of the element
+
+    const uint64_t key; ///< The key of the counter-based generator
+
+    /*!
+     * \brief Construct a new normal_noise_unary_op with a new key
+     */
+    normal_noise_unary_op() : key(random_key()) {
+        //Nothing else to init
+    }
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
@@ -124,7 +178,10 @@ struct normal_noise_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
+    static constexpr bool vectorizable =
+            (V == vector_mode_t::SSE3 && is_floating_t<T>)
+        ||  (V == vector_mode_t::AVX && is_floating_t<T>)
+        ||  (V == vector_mode_t::AVX512 && is_floating_t<T>);
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -132,16 +189,45 @@ struct normal_noise_unary_op {
     template <typename E>
     static constexpr bool gpu_computable = false;
 
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::normal_distribution<double> normal_distribution(0.0, 1.0);
+    T apply(const T& x, size_t i) const {
+        return x + counter_normal<random_real_t<T>>(key, i);
+    }
 
-        return x + normal_distribution(rand_engine);
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    vec_type<V> load(const vec_type<V>& x, size_t i) const noexcept {
+        static constexpr size_t vec_size = V::template traits<T>::size;
+
+        alignas(64) T u1[vec_size];
+        alignas(64) T u2[vec_size];
+
+        for (size_t j = 0; j < vec_size; ++j) {
+            counter_uniform_pair(key, i + j, 0, u1[j], u2[j]);
+        }
+
+        // Box-Muller transform
+        auto r = V::sqrt(V::mul(V::set(T(-2)), V::log(V::load(u1))));
+        auto c = V::cos(V::mul(V::set(T(6.283185307179586476925)), V::load(u2)));
+
+        return V::add(x, V::mul(r, c));
     }
 
     /*!
@@ -211,12 +297,26 @@ public:
 
 /*!
  * \brief Unary operation applying a logistic noise
+ *
+ * The noise is drawn from a counter-based generator, the noise of each
+ * element only depends on the key of the operator and on its index.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct logistic_noise_unary_op {
     static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed = true;  ///< Indicates if the operator needs the index of the element
+
+    const uint64_t key; ///< The key of the counter-based generator
+
+    /*!
+     * \brief Construct a new logistic_noise_unary_op with a new key
+     */
+    logistic_noise_unary_op() : key(random_key()) {
+        //Nothing else to init
+    }
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
@@ -235,14 +335,11 @@ struct logistic_noise_unary_op {
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-
-        std::normal_distribution<double> noise_distribution(0.0, math::logistic_sigmoid(x));
-
-        return x + noise_distribution(rand_engine);
+    T apply(const T& x, size_t i) const {
+        return x + math::logistic_sigmoid(x) * counter_normal<random_real_t<T>>(key, i);
     }
 
     /*!
@@ -310,4 +407,67 @@ public:
     }
 };
 
+/*!
+ * \brief Unary operation applying a normal noise to the values that
+ * are not 0 or the given value.
+ *
+ * The noise is drawn from a counter-based generator, the noise of each
+ * element only depends on the key of the operator and on its index.
+ *
+ * \tparam T The type of value
+ */
+template <typename T>
+struct ranged_noise_unary_op {
+    static constexpr bool linear = true; ///< Indicates if the operator is linear
+    static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed = true;  ///< Indicates if the operator needs the index of the element
+
+    const T value;      ///< The value that is not modified
+    const uint64_t key; ///< The key of the counter-based generator
+
+    /*!
+     * \brief Construct a new ranged_noise_unary_op with a new key
+     * \param value The value that is not modified
+     */
+    explicit ranged_noise_unary_op(T value) : value(value), key(random_key()) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = false;
+
+    /*!
+     * \brief Indicates if the operator can be computed on GPU
+     */
+    template <typename E>
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Apply the unary operator on x
+     * \param x The value on which to apply the operator
+     * \param i The index of the element
+     * \return The result of applying the unary operator on x
+     */
+    T apply(const T& x, size_t i) const {
+        if (x == 0.0 || x == value) {
+            return x;
+        } else {
+            return x + counter_normal<random_real_t<T>>(key, i);
+        }
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operator
+     * \return a string representing the operator
+     */
+    static std::string desc() noexcept {
+        return "ranged_noise";
+    }
+};
+
 } //end of namespace etl
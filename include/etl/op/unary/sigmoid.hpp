@@ -29,6 +29,7 @@ struct sigmoid_unary_op {
     static constexpr bool vectorizable =
             (V == vector_mode_t::SSE3 && !is_complex_t<T>)
         ||  (V == vector_mode_t::AVX && !is_complex_t<T>)
+        ||  (V == vector_mode_t::AVX512 && !is_complex_t<T>)
         ||  (intel_compiler && !is_complex_t<T>);
 
     /*!
@@ -26,7 +26,10 @@ struct sinh_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
+    static constexpr bool vectorizable =
+                (V == vector_mode_t::SSE3 && is_floating_t<T>)
+            ||  (V == vector_mode_t::AVX && is_floating_t<T>)
+            ||  (V == vector_mode_t::AVX512 && is_floating_t<T>);
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -38,6 +41,12 @@ struct sinh_unary_op {
             || (is_complex_single_t<T> && impl::egblas::has_csinh)
             || (is_complex_double_t<T> && impl::egblas::has_zsinh);
 
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
@@ -47,6 +56,17 @@ struct sinh_unary_op {
         return std::sinh(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static vec_type<V> load(const vec_type<V>& x) noexcept {
+        return V::sinh(x);
+    }
+
     /*!
      * \brief Compute the result of the operation using the GPU
      *
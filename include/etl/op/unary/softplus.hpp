@@ -26,7 +26,10 @@ struct softplus_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
+    static constexpr bool vectorizable =
+                (V == vector_mode_t::SSE3 && is_floating_t<T>)
+            ||  (V == vector_mode_t::AVX && is_floating_t<T>)
+            ||  (V == vector_mode_t::AVX512 && is_floating_t<T>);
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -38,6 +41,12 @@ struct softplus_unary_op {
             || (is_complex_single_t<T> && impl::egblas::has_csoftplus)
             || (is_complex_double_t<T> && impl::egblas::has_zsoftplus);
 
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
@@ -47,6 +56,27 @@ struct softplus_unary_op {
         return math::softplus(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static vec_type<V> load(const vec_type<V>& x) noexcept {
+        auto zero = V::set(T(0));
+        auto one  = V::set(T(1));
+
+        // softplus(x) = max(x, 0) + log1p(exp(-|x|)) does not overflow
+        auto u = V::exp(V::min(x, V::minus(x)));
+        auto w = V::add(one, u);
+
+        // log1p(u) = log(1 + u) corrected by the rounding error of 1 + u
+        auto t1 = V::log(w);
+        auto t2 = V::div(V::sub(u, V::sub(w, one)), w);
+        return V::add(V::max(x, zero), V::add(t1, t2));
+    }
+
     /*!
      * \brief Compute the result of the operation using the GPU
      *
@@ -0,0 +1,317 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Contains the packed convolution filters, kernels that are prepared
+ * once to be used by several convolutions.
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief Convolution kernels prepared once to be used by several
+ * convolutions.
+ *
+ * The kernels are stored flipped, which is the layout directly used by
+ * the matrix multiplication and the vectorized convolutions. When the
+ * kernels are 3x3 and the Winograd convolution is possible, the
+ * transformed kernels of both Winograd tile sizes are stored as well.
+ *
+ * The filter must be packed again when the kernels are modified.
+ *
+ * \tparam T The value type
+ * \tparam D The number of dimensions of the kernels, 4 for [K, C, m1, m2]
+ * kernels or 3 for [K, m1, m2] kernels
+ */
+template <typename T, size_t D>
+struct packed_conv_filter {
+    static_assert(D == 3 || D == 4, "Packed filters are only supported for 3D and 4D kernels");
+
+    using value_type     = T;                  ///< The value type
+    using container_type = dyn_matrix<T, D>;   ///< The type of the flipped kernels
+    using transform_type = dyn_vector<T>;      ///< The type of the Winograd transformed kernels
+
+    /*!
+     * \brief Construct an empty filter
+     */
+    packed_conv_filter() = default;
+
+    /*!
+     * \brief Construct a filter from the given kernels
+     * \param kernels The kernels, not flipped
+     */
+    template <typename K, cpp_enable_iff(is_etl_expr<K>)>
+    explicit packed_conv_filter(const K& kernels) {
+        pack(kernels);
+    }
+
+    /*!
+     * \brief Prepare the filter for the given kernels.
+     *
+     * The kernels must keep the same dimensions between two packs.
+     *
+     * \param kernels The kernels, not flipped
+     */
+    template <typename K>
+    void pack(const K& kernels) {
+        static_assert(etl::dimensions<K>() == D, "Invalid number of dimensions for the kernels of the packed filter");
+
+        flipped = kernels;
+        flipped.deep_fflip_inplace();
+
+        pack_winograd();
+    }
+
+    /*!
+     * \brief Returns the flipped kernels
+     * \return a reference to the flipped kernels
+     */
+    const container_type& kernels() const noexcept {
+        return flipped;
+    }
+
+    /*!
+     * \brief Indicates if the filter contains the Winograd transformed kernels
+     * \return true if the transformed kernels are available, false otherwise
+     */
+    bool has_winograd_kernels() const noexcept {
+        return etl::size(u2) > 0;
+    }
+
+    /*!
+     * \brief Returns the kernels transformed for the F(2x2, 3x3) Winograd algorithm
+     * \return a reference to the transformed kernels, laid out as by transform_kernels<2>
+     */
+    const transform_type& winograd_kernels_2() const noexcept {
+        return u2;
+    }
+
+    /*!
+     * \brief Returns the kernels transformed for the F(4x4, 3x3) Winograd algorithm
+     * \return a reference to the transformed kernels, laid out as by transform_kernels<4>
+     */
+    const transform_type& winograd_kernels_4() const noexcept {
+        return u4;
+    }
+
+private:
+    /*!
+     * \brief Transform the flipped kernels for the Winograd algorithm, if
+     * it can be used for these kernels.
+     */
+    template <size_t DD = D, cpp_enable_iff(DD == 4 && impl::vec::winograd_possible<container_type, container_type, container_type>)>
+    void pack_winograd() {
+        namespace wg = impl::vec::winograd;
+
+        const size_t K = etl::dim<0>(flipped);
+        const size_t C = etl::dim<1>(flipped);
+
+        if (etl::dim<2>(flipped) != 3 || etl::dim<3>(flipped) != 3) {
+            return;
+        }
+
+        constexpr size_t a2 = wg::transform<2>::alpha * wg::transform<2>::alpha;
+        constexpr size_t a4 = wg::transform<4>::alpha * wg::transform<4>::alpha;
+
+        if (etl::size(u2) != a2 * K * C) {
+            u2 = transform_type(a2 * K * C);
+            u4 = transform_type(a4 * K * C);
+        }
+
+        // The kernels are already flipped
+        wg::transform_kernels<2>(flipped.memory_start(), K, C, u2.memory_start(), false, false);
+        wg::transform_kernels<4>(flipped.memory_start(), K, C, u4.memory_start(), false, false);
+
+        u2.invalidate_gpu();
+        u4.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Transform the flipped kernels for the Winograd algorithm, if
+     * it can be used for these kernels.
+     */
+    template <size_t DD = D, cpp_disable_iff(DD == 4 && impl::vec::winograd_possible<container_type, container_type, container_type>)>
+    void pack_winograd() {
+        // Nothing to transform
+    }
+
+    container_type flipped; ///< The flipped kernels
+    transform_type u2;      ///< The kernels transformed for F(2x2, 3x3)
+    transform_type u4;      ///< The kernels transformed for F(4x4, 3x3)
+};
+
+namespace detail {
+
+/*!
+ * \brief Compute a 4D valid convolution with the Winograd transformed
+ * kernels of a packed filter, if this is the selected implementation.
+ *
+ * \param input The input expression
+ * \param filter The packed filter
+ * \param conv The output
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ *
+ * \return true if the convolution has been computed, false otherwise
+ */
+template <typename A, typename T, typename C>
+bool packed_conv4_valid_winograd(const A& input, const packed_conv_filter<T, 4>& filter, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    using K = typename packed_conv_filter<T, 4>::container_type;
+
+    if (!filter.has_winograd_kernels() || s1 != 1 || s2 != 1) {
+        return false;
+    }
+
+    auto& kernels = filter.kernels();
+
+    auto impl = select_conv4_valid_impl<A, K, C>(etl::dim<1>(input), etl::dim<0>(kernels), etl::dim<2>(input), etl::dim<3>(input), 3, 3, s1, s2);
+
+    if (impl != etl::conv4_impl::WINOGRAD) {
+        return false;
+    }
+
+    impl::vec::winograd_conv4_valid_transformed(smart_forward(input), filter.winograd_kernels_2(), filter.winograd_kernels_4(), conv, p1, p2);
+
+    return true;
+}
+
+/*!
+ * \brief Assert that the convolution of a packed filter is done on correct dimensions
+ */
+template <typename A, typename T, typename C>
+void check_packed_conv4_valid(const A& input, const packed_conv_filter<T, 4>& filter, const C& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    static_assert(etl::dimensions<A>() == 4, "Invalid number of dimensions for input of conv4_valid");
+    static_assert(etl::dimensions<C>() == 4, "Invalid number of dimensions for conv of conv4_valid");
+
+    auto& kernel = filter.kernels();
+
+    cpp_assert(etl::dim(conv, 0) == etl::dim(input, 0), "Invalid dimensions for conv4_valid");
+    cpp_assert(etl::dim(conv, 1) == etl::dim(kernel, 0), "Invalid dimensions for conv4_valid");
+    cpp_assert(etl::dim(input, 1) == etl::dim(kernel, 1), "Invalid dimensions for conv4_valid");
+
+    cpp_assert(etl::dim(conv, 2) == (etl::dim(input, 2) - etl::dim(kernel, 2) + 2 * p1) / s1 + 1, "Invalid dimensions for conv4_valid");
+    cpp_assert(etl::dim(conv, 3) == (etl::dim(input, 3) - etl::dim(kernel, 3) + 2 * p2) / s2 + 1, "Invalid dimensions for conv4_valid");
+
+    cpp_unused(input);
+    cpp_unused(kernel);
+    cpp_unused(conv);
+    cpp_unused(s1);
+    cpp_unused(s2);
+    cpp_unused(p1);
+    cpp_unused(p2);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the 'valid' 4D convolution of a and the kernels of a
+ * packed filter, the result will be stored in c.
+ *
+ * The kernels are neither copied nor flipped and, when the Winograd
+ * convolution is selected, they are not transformed either.
+ *
+ * \param a The input expression, of [N, C, H, W] dimensions
+ * \param b The packed filter, of [K, C, m1, m2] kernels
+ * \param c The result
+ *
+ * \return c
+ */
+template <size_t S1 = 1, size_t S2 = 1, size_t P1 = 0, size_t P2 = 0, typename A, typename T, typename C>
+auto conv_4d_valid(A&& a, const packed_conv_filter<T, 4>& b, C&& c) {
+    static_assert(all_etl_expr<A, C>, "Convolution only supported for ETL expressions");
+
+    detail::check_packed_conv4_valid(a, b, c, S1, S2, P1, P2);
+
+    if (!detail::packed_conv4_valid_winograd(a, b, c, S1, S2, P1, P2)) {
+        c = conv_4d_valid_flipped<S1, S2, P1, P2>(a, b.kernels());
+    }
+
+    return c;
+}
+
+/*!
+ * \brief Compute the 'valid' 4D convolution of a and the kernels of a
+ * packed filter, the result will be stored in c.
+ *
+ * The kernels are neither copied nor flipped and, when the Winograd
+ * convolution is selected, they are not transformed either.
+ *
+ * \param a The input expression, of [N, C, H, W] dimensions
+ * \param b The packed filter, of [K, C, m1, m2] kernels
+ * \param c The result
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ *
+ * \return c
+ */
+template <typename A, typename T, typename C>
+auto conv_4d_valid(A&& a, const packed_conv_filter<T, 4>& b, C&& c, size_t s1, size_t s2, size_t p1, size_t p2) {
+    static_assert(all_etl_expr<A, C>, "Convolution only supported for ETL expressions");
+
+    detail::check_packed_conv4_valid(a, b, c, s1, s2, p1, p2);
+
+    if (!detail::packed_conv4_valid_winograd(a, b, c, s1, s2, p1, p2)) {
+        c = conv_4d_valid_flipped(a, b.kernels(), s1, s2, p1, p2);
+    }
+
+    return c;
+}
+
+/*!
+ * \brief Compute the 'valid' 2D convolution of a with each of the kernels
+ * of a packed filter, the result will be stored in c.
+ *
+ * The kernels are neither copied nor flipped.
+ *
+ * \param a The input expression
+ * \param b The packed filter, of [K, m1, m2] kernels
+ * \param c The result
+ *
+ * \return c
+ */
+template <size_t S1 = 1, size_t S2 = 1, size_t P1 = 0, size_t P2 = 0, typename A, typename T, typename C>
+auto conv_2d_valid_multi(A&& a, const packed_conv_filter<T, 3>& b, C&& c) {
+    static_assert(all_etl_expr<A, C>, "Convolution only supported for ETL expressions");
+
+    c = conv_2d_valid_multi_flipped<S1, S2, P1, P2>(a, b.kernels());
+
+    return c;
+}
+
+/*!
+ * \brief Compute the 'valid' 2D convolution of a with each of the kernels
+ * of a packed filter, the result will be stored in c.
+ *
+ * The kernels are neither copied nor flipped.
+ *
+ * \param a The input expression
+ * \param b The packed filter, of [K, m1, m2] kernels
+ * \param c The result
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ *
+ * \return c
+ */
+template <typename A, typename T, typename C>
+auto conv_2d_valid_multi(A&& a, const packed_conv_filter<T, 3>& b, C&& c, size_t s1, size_t s2, size_t p1, size_t p2) {
+    static_assert(all_etl_expr<A, C>, "Convolution only supported for ETL expressions");
+
+    c = conv_2d_valid_multi_flipped(a, b.kernels(), s1, s2, p1, p2);
+
+    return c;
+}
+
+} //end of namespace etl
@@ -13,6 +13,11 @@
 #pragma once
 
 #include <random>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 
 namespace etl {
 
@@ -21,4 +26,231 @@ namespace etl {
  */
 using random_engine = std::mt19937_64;
 
+/*!
+ * \brief Counter-based Philox4x32-10 random generator.
+ *
+ * The generator has no state, a block of four random words is
+ * computed from a key and a counter. Using the index of an element as
+ * the counter makes the generated values independent of the order of
+ * evaluation and therefore of the number of threads.
+ */
+struct philox4x32 {
+    using block_type = std::array<uint32_t, 4>; ///< The type of a generated block
+
+    static constexpr uint32_t M0 = 0xD2511F53; ///< The first multiplier
+    static constexpr uint32_t M1 = 0xCD9E8D57; ///< The second multiplier
+    static constexpr uint32_t W0 = 0x9E3779B9; ///< The first Weyl constant
+    static constexpr uint32_t W1 = 0xBB67AE85; ///< The second Weyl constant
+
+    /*!
+     * \brief Generate the block of random words of the given counter
+     * \param key The key of the generator
+     * \param counter The low part of the counter
+     * \param stream The high part of the counter
+     * \return the four random words
+     */
+    static block_type block(uint64_t key, uint64_t counter, uint64_t stream = 0) noexcept {
+        uint32_t k0 = uint32_t(key);
+        uint32_t k1 = uint32_t(key >> 32);
+
+        block_type c{{uint32_t(counter), uint32_t(counter >> 32), uint32_t(stream), uint32_t(stream >> 32)}};
+
+        for (size_t r = 0; r < 10; ++r) {
+            const uint64_t p0 = uint64_t(M0) * c[0];
+            const uint64_t p1 = uint64_t(M1) * c[2];
+
+            c = {{uint32_t(p1 >> 32) ^ c[1] ^ k0, uint32_t(p1), uint32_t(p0 >> 32) ^ c[3] ^ k1, uint32_t(p0)}};
+
+            k0 += W0;
+            k1 += W1;
+        }
+
+        return c;
+    }
+};
+
+namespace detail {
+
+/*!
+ * \brief Returns the global counter used to derive the keys of the
+ * counter-based generators.
+ */
+inline std::atomic<uint64_t>& random_key_counter() {
+    static std::atomic<uint64_t> counter(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return counter;
+}
+
+/*!
+ * \brief Convert a random word to a float in [0, 1)
+ */
+inline float uniform_from_bits(uint32_t a) noexcept {
+    return float(a >> 8) * (1.0f / 16777216.0f);
+}
+
+/*!
+ * \brief Convert two random words to a double in [0, 1)
+ */
+inline double uniform_from_bits(uint32_t a, uint32_t b) noexcept {
+    return double(((uint64_t(a) << 32) | b) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Seed the keys of the counter-based generators.
+ *
+ * The expressions built after this call draw the same random values
+ * for the same seed.
+ *
+ * \param seed The seed
+ */
+inline void random_seed(uint64_t seed) {
+    detail::random_key_counter() = seed;
+}
+
+/*!
+ * \brief Returns a new key for a counter-based generator
+ */
+inline uint64_t random_key() {
+    // splitmix64 finalizer, to decorrelate successive keys
+    uint64_t z = detail::random_key_counter().fetch_add(0x9E3779B97F4A7C15ULL) + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/*!
+ * \brief The floating point type used to draw random values for the type T
+ */
+template <typename T>
+using random_real_t = std::conditional_t<std::is_same<T, float>::value, float, double>;
+
+/*!
+ * \brief Draw the uniform [0, 1) value of the element i
+ *
+ * Each block of the generator is shared by four consecutive float
+ * elements or by two consecutive double elements.
+ *
+ * \param key The key of the generator
+ * \param i The index of the element
+ * \param stream The stream of values
+ * \return a random value in [0, 1)
+ */
+template <typename T>
+T counter_uniform(uint64_t key, size_t i, uint64_t stream = 0) noexcept;
+
+/*!
+ * \copydoc counter_uniform
+ */
+template <>
+inline float counter_uniform<float>(uint64_t key, size_t i, uint64_t stream) noexcept {
+    return detail::uniform_from_bits(philox4x32::block(key, i / 4, stream)[i % 4]);
+}
+
+/*!
+ * \copydoc counter_uniform
+ */
+template <>
+inline double counter_uniform<double>(uint64_t key, size_t i, uint64_t stream) noexcept {
+    auto b = philox4x32::block(key, i / 2, stream);
+    return detail::uniform_from_bits(b[2 * (i % 2)], b[2 * (i % 2) + 1]);
+}
+
+/*!
+ * \brief Draw the uniform [0, 1) values of the n elements starting at
+ * first.
+ *
+ * This gives the same values as counter_uniform but only computes each
+ * block of the generator once.
+ *
+ * \param out The output memory
+ * \param n The number of elements
+ * \param key The key of the generator
+ * \param first The index of the first element
+ * \param stream The stream of values
+ */
+template <typename T>
+void counter_uniform_fill(T* out, size_t n, uint64_t key, size_t first, uint64_t stream = 0) noexcept;
+
+/*!
+ * \copydoc counter_uniform_fill
+ */
+template <>
+inline void counter_uniform_fill<float>(float* out, size_t n, uint64_t key, size_t first, uint64_t stream) noexcept {
+    size_t j = 0;
+
+    while (j < n) {
+        auto b = philox4x32::block(key, (first + j) / 4, stream);
+
+        for (size_t w = (first + j) % 4; w < 4 && j < n; ++w, ++j) {
+            out[j] = detail::uniform_from_bits(b[w]);
+        }
+    }
+}
+
+/*!
+ * \copydoc counter_uniform_fill
+ */
+template <>
+inline void counter_uniform_fill<double>(double* out, size_t n, uint64_t key, size_t first, uint64_t stream) noexcept {
+    size_t j = 0;
+
+    while (j < n) {
+        auto b = philox4x32::block(key, (first + j) / 2, stream);
+
+        for (size_t w = (first + j) % 2; w < 2 && j < n; ++w, ++j) {
+            out[j] = detail::uniform_from_bits(b[2 * w], b[2 * w + 1]);
+        }
+    }
+}
+
+/*!
+ * \brief Draw the two uniform values used by the Box-Muller transform
+ * for the element i.
+ *
+ * \param key The key of the generator
+ * \param i The index of the element
+ * \param stream The stream of values
+ * \param u1 The first value, in (0, 1]
+ * \param u2 The second value, in [0, 1)
+ */
+template <typename T>
+void counter_uniform_pair(uint64_t key, size_t i, uint64_t stream, T& u1, T& u2) noexcept;
+
+/*!
+ * \copydoc counter_uniform_pair
+ */
+template <>
+inline void counter_uniform_pair<float>(uint64_t key, size_t i, uint64_t stream, float& u1, float& u2) noexcept {
+    auto b = philox4x32::block(key, i, stream);
+    u1     = 1.0f - detail::uniform_from_bits(b[0]);
+    u2     = detail::uniform_from_bits(b[1]);
+}
+
+/*!
+ * \copydoc counter_uniform_pair
+ */
+template <>
+inline void counter_uniform_pair<double>(uint64_t key, size_t i, uint64_t stream, double& u1, double& u2) noexcept {
+    auto b = philox4x32::block(key, i, stream);
+    u1     = 1.0 - detail::uniform_from_bits(b[0], b[1]);
+    u2     = detail::uniform_from_bits(b[2], b[3]);
+}
+
+/*!
+ * \brief Draw the standard normal value of the element i
+ * \param key The key of the generator
+ * \param i The index of the element
+ * \param stream The stream of values
+ * \return a random value from N(0, 1)
+ */
+template <typename T>
+T counter_normal(uint64_t key, size_t i, uint64_t stream = 0) noexcept {
+    T u1;
+    T u2;
+    counter_uniform_pair(key, i, stream, u1, u2);
+
+    return std::sqrt(T(-2) * std::log(u1)) * std::cos(T(6.283185307179586476925) * u2);
+}
+
 } //end of namespace etl
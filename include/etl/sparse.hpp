@@ -220,7 +220,7 @@ struct sparse_matrix_impl<T, sparse_storage::COO, D> final : dyn_base<sparse_mat
     using this_type              = sparse_matrix_impl<T, sparse_storage::COO, D>;    ///< this type
     using base_type              = dyn_base<this_type, T, D>;                        ///< The base type
     using reference_type         = sparse_detail::sparse_reference<this_type>;       ///< The type of reference returned by the functions
-    using const_reference_type   = sparse_detail::sparse_reference<const this_type>; ///< The type of const reference returned by the functions
+    using const_reference_type   = T;                                                ///< The type of const reference returned by the functions
     using value_type             = T;                                                ///< The type of value returned by the function
     using dimension_storage_impl = std::array<size_t, n_dimensions>;                 ///< The type used to store the dimensions
     using memory_type            = value_type*;                                      ///< The memory type
@@ -379,19 +379,25 @@ private:
      * already taken if its place of insertion is already taken.
      */
     size_t find_n(size_t i, size_t j) const noexcept {
-        for (size_t n = 0; n < nnz; ++n) {
-            //The value exists, modify it
-            if (_row_index[n] == i && _col_index[n] == j) {
-                return n;
-            }
+        // The elements are sorted by (row, column), binary search for
+        // the first element not before (i,j)
+
+        size_t first = 0;
+        size_t count = nnz;
+
+        while (count > 0) {
+            const size_t step = count / 2;
+            const size_t n    = first + step;
 
-            //The insertion point has been found
-            if ((_row_index[n] == i && _col_index[n] > j) || _row_index[n] > i) {
-                return n;
+            if (_row_index[n] < i || (_row_index[n] == i && _col_index[n] < j)) {
+                first = n + 1;
+                count -= step + 1;
+            } else {
+                count = step;
             }
         }
 
-        return nnz;
+        return first;
     }
 
     /*!
@@ -549,6 +555,40 @@ public:
         build_from_iterable(list);
     }
 
+    /*!
+     * \brief Copy construct a sparse matrix
+     * \param rhs The matrix to copy from
+     */
+    sparse_matrix_impl(const sparse_matrix_impl& rhs) : base_type(rhs), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(rhs.nnz) {
+        if (nnz > 0) {
+            _memory    = allocate(nnz);
+            _row_index = base_type::template allocate<index_type>(nnz);
+            _col_index = base_type::template allocate<index_type>(nnz);
+
+            std::copy_n(rhs._memory, nnz, _memory);
+            std::copy_n(rhs._row_index, nnz, _row_index);
+            std::copy_n(rhs._col_index, nnz, _col_index);
+        }
+    }
+
+    /*!
+     * \brief Move construct a sparse matrix
+     * \param rhs The matrix to move from
+     */
+    sparse_matrix_impl(sparse_matrix_impl&& rhs) noexcept : base_type(std::move(rhs)),
+                                                            _memory(rhs._memory),
+                                                            _row_index(rhs._row_index),
+                                                            _col_index(rhs._col_index),
+                                                            nnz(rhs.nnz) {
+        rhs._memory    = nullptr;
+        rhs._row_index = nullptr;
+        rhs._col_index = nullptr;
+        rhs.nnz        = 0;
+        rhs._size      = 0;
+
+        std::fill(rhs._dimensions.begin(), rhs._dimensions.end(), 0);
+    }
+
     /*!
      * \brief Copy assign from another matrix
      *
@@ -575,6 +615,43 @@ public:
         return *this;
     }
 
+    /*!
+     * \brief Move assign from another matrix
+     *
+     * This operator can change the dimensions of the matrix
+     *
+     * \param rhs The matrix to move from
+     * \return A reference to the matrix
+     */
+    sparse_matrix_impl& operator=(sparse_matrix_impl&& rhs) noexcept {
+        if (this != &rhs) {
+            if (_memory) {
+                release(_memory, nnz);
+                release(_row_index, nnz);
+                release(_col_index, nnz);
+            }
+
+            _size       = rhs._size;
+            _dimensions = rhs._dimensions;
+            _memory     = rhs._memory;
+            _row_index  = rhs._row_index;
+            _col_index  = rhs._col_index;
+            nnz         = rhs.nnz;
+
+            rhs._memory    = nullptr;
+            rhs._row_index = nullptr;
+            rhs._col_index = nullptr;
+            rhs.nnz        = 0;
+            rhs._size      = 0;
+
+            std::fill(rhs._dimensions.begin(), rhs._dimensions.end(), 0);
+        }
+
+        check_invariants();
+
+        return *this;
+    }
+
     /*!
      * \brief Assign an ETL expression to the sparse matrix
      */
@@ -646,16 +723,16 @@ public:
     }
 
     /*!
-     * \brief Returns a reference to the element at the position (i,j)
+     * \brief Returns the value of the element at the position (i,j)
      * \param i The first index
      * \param j The second index
-     * \return a sparse reference (proxy reference) to the element at position (i,j)
+     * \return the value of the element at position (i,j)
      */
     const_reference_type operator()(size_t i, size_t j) const noexcept(assert_nothrow) {
         cpp_assert(i < dim(0), "Out of bounds");
         cpp_assert(j < dim(1), "Out of bounds");
 
-        return {*this, i, j};
+        return get(i, j);
     }
 
     /*!
@@ -672,16 +749,14 @@ public:
     }
 
     /*!
-     * \brief Returns the element at the given index
-     * This function may result in insertion of deletion of elements
-     * in the matrix and therefore invalidation of some references.
+     * \brief Returns the value of the element at the given index
      * \param n The index
-     * \return a reference to the element at the given index.
+     * \return the value of the element at the given index.
      */
     const_reference_type operator[](size_t n) const noexcept(assert_nothrow) {
         cpp_assert(n < size(), "Out of bounds");
 
-        return {*this, n / columns(), n % columns()};
+        return get(n / columns(), n % columns());
     }
 
     /*!
@@ -706,6 +781,26 @@ public:
         return nnz;
     }
 
+    /*!
+     * \brief Apply the given functor to each non-zero element of the
+     * rows [first, last), in order.
+     *
+     * The functor is called with the row, the column and the value of
+     * the element.
+     *
+     * \param first The first row
+     * \param last The end of the range of rows
+     * \param functor The functor to apply
+     */
+    template <typename F>
+    void for_each_non_zero(size_t first, size_t last, F&& functor) const {
+        const size_t n_last = find_n(last, 0);
+
+        for (size_t n = find_n(first, 0); n < n_last; ++n) {
+            functor(_row_index[n], _col_index[n], _memory[n]);
+        }
+    }
+
     /*!
      * \brief Sets the element at the given position (i, j) to the given value
      * \param i The first index
@@ -763,7 +858,19 @@ public:
      */
     template <typename E, cpp_enable_iff(is_sparse_matrix<E>)>
     bool alias(const E& rhs) const noexcept {
-        return this == &rhs;
+        return static_cast<const void*>(this) == static_cast<const void*>(&rhs);
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E, cpp_enable_iff(is_dma<E>)>
+    bool alias(const E& rhs) const noexcept {
+        // A dense matrix never shares memory with a sparse matrix
+        cpp_unused(rhs);
+        return false;
     }
 
     /*!
@@ -771,7 +878,7 @@ public:
      * \param rhs The other expression to test
      * \return true if the two expressions aliases, false otherwise
      */
-    template <typename E, cpp_disable_iff(is_sparse_matrix<E>)>
+    template <typename E, cpp_disable_iff(is_sparse_matrix<E> || is_dma<E>)>
     bool alias(const E& rhs) const noexcept {
         return rhs.alias(*this);
     }
@@ -885,4 +992,911 @@ public:
     }
 };
 
+
+/*!
+ * \brief Sparse matrix implementation with CSR storage type
+ *
+ * The values are stored row by row, each row sorted by column. The
+ * position of the first element of each row is stored in a row index,
+ * allowing lookup of an element with a binary search in its row. The
+ * storage grows geometrically so that successive insertions are
+ * amortized.
+ *
+ * \tparam T The type of value
+ * \tparam D The number of dimensions
+ */
+template <typename T, size_t D>
+struct sparse_matrix_impl<T, sparse_storage::CSR, D> final : dyn_base<sparse_matrix_impl<T, sparse_storage::CSR, D>, T, D> {
+    static constexpr size_t n_dimensions           = D;                                      ///< The number of dimensions
+    static constexpr sparse_storage storage_format = sparse_storage::CSR;                    ///< The sparse storage scheme
+    static constexpr order storage_order           = order::RowMajor;                        ///< The storage order
+    static constexpr size_t alignment              = default_intrinsic_traits<T>::alignment; ///< The alignment
+
+    using this_type              = sparse_matrix_impl<T, sparse_storage::CSR, D>;    ///< this type
+    using base_type              = dyn_base<this_type, T, D>;                        ///< The base type
+    using reference_type         = sparse_detail::sparse_reference<this_type>;       ///< The type of reference returned by the functions
+    using const_reference_type   = T;                                                ///< The type of const reference returned by the functions
+    using value_type             = T;                                                ///< The type of value returned by the function
+    using dimension_storage_impl = std::array<size_t, n_dimensions>;                 ///< The type used to store the dimensions
+    using memory_type            = value_type*;                                      ///< The memory type
+    using const_memory_type      = const value_type*;                                ///< The const memory type
+    using index_type             = size_t;                                           ///< The type used to store the CSR index
+    using index_memory_type      = index_type*;                                      ///< The memory type to the CSR index
+
+    friend struct sparse_detail::sparse_reference<this_type>;
+    friend struct sparse_detail::sparse_reference<const this_type>;
+
+    static_assert(n_dimensions == 2, "Only 2D sparse matrix are supported");
+
+private:
+    using base_type::_size;
+    using base_type::_dimensions;
+    memory_type _memory;          ///< The memory
+    index_memory_type _col_index; ///< The column index of each element
+    index_memory_type _row_index; ///< The position of the first element of each row (rows + 1)
+    size_t nnz;                   ///< The number of nonzeros in the matrix
+    size_t capacity;              ///< The number of elements that can be stored without reallocation
+
+    using base_type::release;
+    using base_type::allocate;
+    using base_type::check_invariants;
+
+    /*!
+     * \brief Allocate the row index for the current dimensions
+     */
+    void init_row_index() {
+        _row_index = base_type::template allocate<index_type>(rows() + 1);
+        std::fill_n(_row_index, rows() + 1, index_type(0));
+    }
+
+    /*!
+     * \brief Release all the memory of the matrix
+     */
+    void release_all() {
+        if (_memory) {
+            release(_memory, capacity);
+            release(_col_index, capacity);
+        }
+
+        if (_row_index) {
+            release(_row_index, rows() + 1);
+        }
+
+        _memory    = nullptr;
+        _col_index = nullptr;
+        _row_index = nullptr;
+        nnz        = 0;
+        capacity   = 0;
+    }
+
+    /*!
+     * \brief Make sure that at least n elements can be stored
+     * \param n The number of elements to store
+     */
+    void grow(size_t n) {
+        if (n <= capacity) {
+            return;
+        }
+
+        const size_t new_capacity = std::max(n, 2 * capacity);
+
+        auto new_memory    = allocate(new_capacity);
+        auto new_col_index = base_type::template allocate<index_type>(new_capacity);
+
+        if (_memory) {
+            std::copy_n(_memory, nnz, new_memory);
+            std::copy_n(_col_index, nnz, new_col_index);
+
+            release(_memory, capacity);
+            release(_col_index, capacity);
+        }
+
+        _memory    = new_memory;
+        _col_index = new_col_index;
+        capacity   = new_capacity;
+    }
+
+    /*!
+     * \brief Copy the content of another CSR matrix of the same dimensions
+     * \param rhs The matrix to copy from
+     */
+    void copy_from(const sparse_matrix_impl& rhs) {
+        grow(rhs.nnz);
+
+        std::copy_n(rhs._memory, rhs.nnz, _memory);
+        std::copy_n(rhs._col_index, rhs.nnz, _col_index);
+
+        // A default-constructed matrix has no row index
+        if (rhs._row_index) {
+            std::copy_n(rhs._row_index, rows() + 1, _row_index);
+        } else {
+            std::fill_n(_row_index, rows() + 1, index_type(0));
+        }
+
+        nnz = rhs.nnz;
+    }
+
+    /*!
+     * \brief Build the content of the sparse matrix from an
+     * iterable collection
+     */
+    template <typename It>
+    void build_from_iterable(const It& iterable) {
+        size_t count = 0;
+        for (auto v : iterable) {
+            if (sparse_detail::is_non_zero(v)) {
+                ++count;
+            }
+        }
+
+        grow(count);
+
+        auto it = iterable.begin();
+
+        for (size_t i = 0; i < rows(); ++i) {
+            _row_index[i] = nnz;
+
+            for (size_t j = 0; j < columns(); ++j) {
+                if (sparse_detail::is_non_zero(*it)) {
+                    _memory[nnz]    = *it;
+                    _col_index[nnz] = j;
+                    ++nnz;
+                }
+
+                ++it;
+            }
+        }
+
+        _row_index[rows()] = nnz;
+    }
+
+    /*!
+     * \brief Reserve enough space to put a value in position n of
+     * the row i
+     */
+    void reserve_hint(size_t i, size_t n) {
+        cpp_assert(n < nnz + 1, "Invalid hint for reserve_hint");
+
+        grow(nnz + 1);
+
+        std::copy_backward(_memory + n, _memory + nnz, _memory + nnz + 1);
+        std::copy_backward(_col_index + n, _col_index + nnz, _col_index + nnz + 1);
+
+        for (size_t r = i + 1; r <= rows(); ++r) {
+            ++_row_index[r];
+        }
+
+        ++nnz;
+    }
+
+    /*!
+     * \brief Erase the value in position n of the row i
+     */
+    void erase_hint(size_t i, size_t n) {
+        cpp_assert(nnz > 0, "Invalid erase_hint call (no non-zero elements");
+
+        std::copy(_memory + n + 1, _memory + nnz, _memory + n);
+        std::copy(_col_index + n + 1, _col_index + nnz, _col_index + n);
+
+        for (size_t r = i + 1; r <= rows(); ++r) {
+            --_row_index[r];
+        }
+
+        --nnz;
+    }
+
+    /*!
+     * \brief Find the position of the value at (i,j) with a binary
+     * search in the row i. Returns the insertion position if the value
+     * is not present.
+     */
+    size_t find_n(size_t i, size_t j) const noexcept {
+        if (!_row_index) {
+            return 0;
+        }
+
+        return std::lower_bound(_col_index + _row_index[i], _col_index + _row_index[i + 1], j) - _col_index;
+    }
+
+    /*!
+     * \brief Indicates if the value at (i,j) is stored at position n
+     */
+    bool is_hint(size_t i, size_t j, size_t n) const noexcept {
+        return n < _row_index[i + 1] && _col_index[n] == j;
+    }
+
+    /*!
+     * \brief Set the value at index (i,j) and position n
+     * \param value The new value to set
+     */
+    void unsafe_set_hint(size_t i, size_t j, size_t n, value_type value) {
+        //The value exists, modify it
+        if (is_hint(i, j, n)) {
+            _memory[n] = value;
+            return;
+        }
+
+        reserve_hint(i, n);
+
+        _memory[n]    = value;
+        _col_index[n] = j;
+    }
+
+    /*!
+     * \brief Get the value at index (i,j) and position n
+     */
+    template <bool B = n_dimensions == 2, cpp_enable_iff(B)>
+    value_type get_hint(size_t i, size_t j, size_t n) const noexcept {
+        if (_row_index && is_hint(i, j, n)) {
+            return _memory[n];
+        }
+
+        return 0.0;
+    }
+
+    /*!
+     * \brief Set the value at index (i,j) and position n.
+     */
+    void set_hint(size_t i, size_t j, size_t n, value_type value) {
+        if (is_hint(i, j, n)) {
+            //At this point, there is already a value for (i,j)
+            //If zero, we remove it, otherwise edit it
+            if (sparse_detail::is_non_zero(value)) {
+                _memory[n] = value;
+            } else {
+                erase_hint(i, n);
+            }
+        } else if (sparse_detail::is_non_zero(value)) {
+            //At this point, the value does not exist
+            //We insert it if not zero
+            unsafe_set_hint(i, j, n, value);
+        }
+    }
+
+    /*!
+     * \brief Get a direct reference to the element at position n
+     */
+    value_type& unsafe_ref_hint(size_t n) {
+        return _memory[n];
+    }
+
+    /*!
+     * \brief Get a direct const reference to the element at position n
+     */
+    const value_type& unsafe_ref_hint(size_t n) const {
+        return _memory[n];
+    }
+
+    /*!
+     * \brief Inherit the dimensions of an ETL expressions.
+     * This must only be called when the matrix has no dimensions
+     * \param e The expression to get the dimensions from.
+     */
+    template <typename E, cpp_enable_iff(etl::decay_traits<E>::is_generator)>
+    void inherit(const E& e){
+        cpp_assert(false, "Impossible to inherit dimensions from generators");
+        cpp_unused(e);
+    }
+
+    /*!
+     * \brief Inherit the dimensions of an ETL expressions.
+     * This must only be called when the matrix has no dimensions
+     * \param e The expression to get the dimensions from.
+     */
+    template <typename E, cpp_disable_iff(etl::decay_traits<E>::is_generator)>
+    void inherit(const E& e){
+        cpp_assert(n_dimensions == etl::dimensions(e), "Invalid number of dimensions");
+
+        release_all();
+
+        // Compute the size and new dimensions
+        _size = 1;
+        for (size_t d = 0; d < n_dimensions; ++d) {
+            _dimensions[d] = etl::dim(e, d);
+            _size *= _dimensions[d];
+        }
+
+        init_row_index();
+    }
+
+public:
+    using base_type::dim;
+    using base_type::rows;
+    using base_type::columns;
+    using base_type::size;
+
+    // Construction
+
+    /*!
+     * \brief Constructs a new empty sparse matrix
+     */
+    sparse_matrix_impl() noexcept : base_type(), _memory(nullptr), _col_index(nullptr), _row_index(nullptr), nnz(0), capacity(0) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions,
+     * filled with zeroes
+     */
+    template <typename... S, cpp_enable_iff(sizeof...(S) == D && cpp::all_convertible_to_v<size_t, S...>)>
+    explicit sparse_matrix_impl(S... sizes) noexcept : base_type(util::size(sizes...), {{static_cast<size_t>(sizes)...}}),
+                                                       _memory(nullptr),
+                                                       _col_index(nullptr),
+                                                       _row_index(nullptr),
+                                                       nnz(0),
+                                                       capacity(0) {
+        init_row_index();
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions
+     * and use the initializer list to fill the matrix
+     */
+    template <typename... S, cpp_enable_iff(dyn_detail::is_initializer_list_constructor<S...>::value)>
+    explicit sparse_matrix_impl(S... sizes) noexcept : base_type(util::size(std::make_index_sequence<(sizeof...(S)-1)>(), sizes...),
+                                                                 dyn_detail::sizes(std::make_index_sequence<(sizeof...(S)-1)>(), sizes...)),
+                                                       _memory(nullptr),
+                                                       _col_index(nullptr),
+                                                       _row_index(nullptr),
+                                                       nnz(0),
+                                                       capacity(0) {
+        static_assert(sizeof...(S) == D + 1, "Invalid number of dimensions");
+
+        init_row_index();
+
+        auto list = cpp::last_value(sizes...);
+        build_from_iterable(list);
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions
+     * and use the list of values list to fill the matrix
+     */
+    template <typename S1, typename... S, cpp_enable_iff(
+                                              (sizeof...(S) == D)
+                                              && cpp::is_specialization_of_v<values_t, typename cpp::last_type<S1, S...>::type>)>
+    explicit sparse_matrix_impl(S1 s1, S... sizes) noexcept : base_type(util::size(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...),
+                                                                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...)),
+                                                              _memory(nullptr),
+                                                              _col_index(nullptr),
+                                                              _row_index(nullptr),
+                                                              nnz(0),
+                                                              capacity(0) {
+        init_row_index();
+
+        auto list = cpp::last_value(sizes...).template list<value_type>();
+        build_from_iterable(list);
+    }
+
+    /*!
+     * \brief Copy construct a sparse matrix
+     * \param rhs The matrix to copy from
+     */
+    sparse_matrix_impl(const sparse_matrix_impl& rhs) : base_type(rhs), _memory(nullptr), _col_index(nullptr), _row_index(nullptr), nnz(0), capacity(0) {
+        if (rhs._row_index) {
+            init_row_index();
+            copy_from(rhs);
+        }
+    }
+
+    /*!
+     * \brief Move construct a sparse matrix
+     * \param rhs The matrix to move from
+     */
+    sparse_matrix_impl(sparse_matrix_impl&& rhs) noexcept : base_type(std::move(rhs)),
+                                                            _memory(rhs._memory),
+                                                            _col_index(rhs._col_index),
+                                                            _row_index(rhs._row_index),
+                                                            nnz(rhs.nnz),
+                                                            capacity(rhs.capacity) {
+        rhs._memory    = nullptr;
+        rhs._col_index = nullptr;
+        rhs._row_index = nullptr;
+        rhs.nnz        = 0;
+        rhs.capacity   = 0;
+        rhs._size      = 0;
+
+        std::fill(rhs._dimensions.begin(), rhs._dimensions.end(), 0);
+    }
+
+    /*!
+     * \brief Copy assign from another matrix
+     *
+     * This operator can change the dimensions of the matrix
+     *
+     * \param rhs The matrix to copy from
+     * \return A reference to the matrix
+     */
+    sparse_matrix_impl& operator=(const sparse_matrix_impl& rhs) {
+        if (this != &rhs) {
+            if (!_size) {
+                inherit(rhs);
+            } else {
+                validate_assign(*this, rhs);
+            }
+
+            copy_from(rhs);
+        }
+
+        check_invariants();
+
+        return *this;
+    }
+
+    /*!
+     * \brief Move assign from another matrix
+     *
+     * This operator can change the dimensions of the matrix
+     *
+     * \param rhs The matrix to move from
+     * \return A reference to the matrix
+     */
+    sparse_matrix_impl& operator=(sparse_matrix_impl&& rhs) noexcept {
+        if (this != &rhs) {
+            release_all();
+
+            _size       = rhs._size;
+            _dimensions = rhs._dimensions;
+            _memory     = rhs._memory;
+            _col_index  = rhs._col_index;
+            _row_index  = rhs._row_index;
+            nnz         = rhs.nnz;
+            capacity    = rhs.capacity;
+
+            rhs._memory    = nullptr;
+            rhs._col_index = nullptr;
+            rhs._row_index = nullptr;
+            rhs.nnz        = 0;
+            rhs.capacity   = 0;
+            rhs._size      = 0;
+
+            std::fill(rhs._dimensions.begin(), rhs._dimensions.end(), 0);
+        }
+
+        check_invariants();
+
+        return *this;
+    }
+
+    /*!
+     * \brief Assign an ETL expression to the sparse matrix
+     */
+    template <typename E, cpp_enable_iff(!std::is_same<std::decay_t<E>, sparse_matrix_impl<T, storage_format, D>>::value && std::is_convertible<value_t<E>, value_type>::value && is_etl_expr<E>)>
+    sparse_matrix_impl& operator=(E&& e) {
+        // It is possible that the matrix was not initialized before
+        // In the case, get the the dimensions from the expression and
+        // initialize the matrix
+        if(!_size){
+            inherit(e);
+        } else {
+            validate_assign(*this, e);
+        }
+
+        // Avoid aliasing issues
+        if /*constexpr*/ (!decay_traits<E>::is_linear) {
+            if (e.alias(*this)) {
+                // Create a temporary to hold the result
+                this_type tmp(*this);
+
+                // Assign the expression to the temporary
+                tmp = e;
+
+                // Assign the temporary to this matrix
+                *this = tmp;
+            } else {
+                e.assign_to(*this);
+            }
+        } else {
+            // Direct assignment of the expression into this matrix
+            e.assign_to(*this);
+        }
+
+        check_invariants();
+
+        return *this;
+    }
+
+    /*!
+     * \brief Build the content of the matrix from a collection of
+     * (row, column, value) triplets.
+     *
+     * The previous content of the matrix is discarded. The triplets do
+     * not need to be sorted, the values of duplicate triplets are summed
+     * and zeroes are not stored. The construction is done in
+     * O(nnz log(nnz / rows)). The storage of the matrix is grown at most
+     * once, but the triplets are first grouped by row in a temporary
+     * buffer.
+     *
+     * \param first Iterator to the first triplet
+     * \param last Iterator past the last triplet
+     */
+    template <typename It>
+    void build_from_triplets(It first, It last) {
+        const size_t n = std::distance(first, last);
+
+        // A default-constructed matrix has no row index yet
+        if (!_row_index) {
+            init_row_index();
+        }
+
+        nnz = 0;
+        std::fill_n(_row_index, rows() + 1, index_type(0));
+
+        grow(n);
+
+        // Count the elements of each row
+
+        for (auto it = first; it != last; ++it) {
+            cpp_assert(size_t(std::get<0>(*it)) < rows(), "Out of bounds");
+            cpp_assert(size_t(std::get<1>(*it)) < columns(), "Out of bounds");
+
+            ++_row_index[std::get<0>(*it) + 1];
+        }
+
+        for (size_t i = 0; i < rows(); ++i) {
+            _row_index[i + 1] += _row_index[i];
+        }
+
+        // Scatter the elements in their row
+
+        std::vector<std::pair<index_type, value_type>> elements(n);
+        std::vector<index_type> next(_row_index, _row_index + rows());
+
+        for (auto it = first; it != last; ++it) {
+            elements[next[std::get<0>(*it)]++] = std::make_pair(index_type(std::get<1>(*it)), value_type(std::get<2>(*it)));
+        }
+
+        // Sort each row, sum the duplicates and remove the zeroes
+
+        size_t row_first = 0;
+
+        for (size_t i = 0; i < rows(); ++i) {
+            const size_t row_last = _row_index[i + 1];
+
+            std::sort(elements.begin() + row_first, elements.begin() + row_last,
+                      [](auto& lhs, auto& rhs) { return lhs.first < rhs.first; });
+
+            _row_index[i] = nnz;
+
+            for (size_t k = row_first; k < row_last;) {
+                auto column = elements[k].first;
+                auto value  = elements[k].second;
+
+                for (++k; k < row_last && elements[k].first == column; ++k) {
+                    value += elements[k].second;
+                }
+
+                if (sparse_detail::is_non_zero(value)) {
+                    _memory[nnz]    = value;
+                    _col_index[nnz] = column;
+                    ++nnz;
+                }
+            }
+
+            row_first = row_last;
+        }
+
+        _row_index[rows()] = nnz;
+    }
+
+    /*!
+     * \brief Returns the value at the given (i,j) position in the matrix.
+     *
+     * This function will never insert a new element in the matrix. It is
+     * suited when only reading the matrix and not neeeding references.
+     *
+     * \param i The row
+     * \param j The column
+     *
+     * \return The value at the (i,j) position.
+     */
+    value_type get(size_t i, size_t j) const noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+        return get_hint(i, j, n);
+    }
+
+    /*!
+     * \brief Returns a reference to the element at the position (i,j)
+     * \param i The first index
+     * \param j The second index
+     * \return a sparse reference (proxy reference) to the element at position (i,j)
+     */
+    reference_type operator()(size_t i, size_t j) noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        return {*this, i, j};
+    }
+
+    /*!
+     * \brief Returns the value of the element at the position (i,j)
+     * \param i The first index
+     * \param j The second index
+     * \return the value of the element at position (i,j)
+     */
+    const_reference_type operator()(size_t i, size_t j) const noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        return get(i, j);
+    }
+
+    /*!
+     * \brief Returns the element at the given index
+     * This function may result in insertion of deletion of elements
+     * in the matrix and therefore invalidation of some references.
+     * \param n The index
+     * \return a reference to the element at the given index.
+     */
+    reference_type operator[](size_t n) noexcept(assert_nothrow) {
+        cpp_assert(n < size(), "Out of bounds");
+
+        return {*this, n / columns(), n % columns()};
+    }
+
+    /*!
+     * \brief Returns the value of the element at the given index
+     * \param n The index
+     * \return the value of the element at the given index.
+     */
+    const_reference_type operator[](size_t n) const noexcept(assert_nothrow) {
+        cpp_assert(n < size(), "Out of bounds");
+
+        return get(n / columns(), n % columns());
+    }
+
+    /*!
+     * \brief Returns the value at the given index
+     * This function never alters the state of the container.
+     * \param n The index
+     * \return the value at the given index.
+     */
+    template <bool B = n_dimensions == 2, cpp_enable_iff(B)>
+    value_type read_flat(size_t n) const noexcept {
+        return get(n / columns(), n % columns());
+    }
+
+    /*!
+     * \brief Returns Returns the number of non zeros entries in the sparse matrix.
+     *
+     * This is a constant time O(1) operation.
+     *
+     * \return The number of non zeros entries in the sparse matrix.
+     */
+    size_t non_zeros() const noexcept {
+        return nnz;
+    }
+
+    /*!
+     * \brief Apply the given functor to each non-zero element of the
+     * rows [first, last), in order.
+     *
+     * The functor is called with the row, the column and the value of
+     * the element.
+     *
+     * \param first The first row
+     * \param last The end of the range of rows
+     * \param functor The functor to apply
+     */
+    template <typename F>
+    void for_each_non_zero(size_t first, size_t last, F&& functor) const {
+        for (size_t i = first; i < last; ++i) {
+            for (size_t n = _row_index[i]; n < _row_index[i + 1]; ++n) {
+                functor(i, _col_index[n], _memory[n]);
+            }
+        }
+    }
+
+    /*!
+     * \brief Returns a pointer to the non-zero values, stored row by row
+     */
+    const_memory_type values() const noexcept {
+        return _memory;
+    }
+
+    /*!
+     * \brief Returns a pointer to the column index of each non-zero value
+     */
+    const index_type* column_indices() const noexcept {
+        return _col_index;
+    }
+
+    /*!
+     * \brief Returns a pointer to the position of the first non-zero
+     * value of each row. The array has rows() + 1 elements.
+     */
+    const index_type* row_pointers() const noexcept {
+        return _row_index;
+    }
+
+    /*!
+     * \brief Sets the element at the given position (i, j) to the given value
+     * \param i The first index
+     * \param j The second index
+     * \param value The new value
+     */
+    void set(size_t i, size_t j, value_type value) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+        set_hint(i, j, n, value);
+    }
+
+    /*!
+     * \brief Sets the element at the given position (i, j) to the given value
+     *
+     * This function will always set the element to the given value, even if it
+     * is zero (the normal behaviour would have been to erase it). This must be
+     * used when we need a pointer to the element in memory.
+     *
+     * \param i The first index
+     * \param j The second index
+     * \param value The new value
+     */
+    void unsafe_set(size_t i, size_t j, value_type value) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+
+        unsafe_set_hint(i, j, n, value);
+    }
+
+    /*!
+     * \brief Erases (sets to zero) the element at the given position (i, j)
+     * \param i The first index
+     * \param j The second index
+     */
+    void erase(size_t i, size_t j) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+
+        if (is_hint(i, j, n)) {
+            erase_hint(i, n);
+        }
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E, cpp_enable_iff(is_sparse_matrix<E>)>
+    bool alias(const E& rhs) const noexcept {
+        return static_cast<const void*>(this) == static_cast<const void*>(&rhs);
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E, cpp_enable_iff(is_dma<E>)>
+    bool alias(const E& rhs) const noexcept {
+        // A dense matrix never shares memory with a sparse matrix
+        cpp_unused(rhs);
+        return false;
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E, cpp_disable_iff(is_sparse_matrix<E> || is_dma<E>)>
+    bool alias(const E& rhs) const noexcept {
+        return rhs.alias(*this);
+    }
+
+    // Internals
+
+    /*!
+     * \brief Apply the given visitor to this expression and its descendants.
+     * \param visitor The visitor to apply
+     */
+    template<typename V>
+    void visit(V&& visitor) const {
+        cpp_unused(visitor);
+    }
+
+    /*!
+     * \brief Destructs the matrix and releases all its memory
+     */
+    ~sparse_matrix_impl() noexcept {
+        release_all();
+    }
+
+    /*!
+     * \brief Ensures that the GPU memory is allocated and that the GPU memory
+     * is up to date (to undefined value).
+     */
+    void ensure_cpu_up_to_date() const {
+        // No GPU support for sparse matrix so far
+    }
+
+    /*!
+     * \brief Copy back from the GPU to the expression memory if
+     * necessary.
+     */
+    void ensure_gpu_up_to_date() const {
+        // No GPU support for sparse matrix so far
+    }
+
+    /*!
+     * \brief Assign to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_to(L&& lhs)  const {
+        std_assign_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_add_to(L&& lhs)  const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief sub to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_sub_to(L&& lhs)  const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief mul to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mul_to(L&& lhs)  const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Div to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_div_to(L&& lhs)  const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Mod to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mod_to(L&& lhs)  const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Prints a fast matrix type (not the contents) to the given stream
+     * \param os The output stream
+     * \param matrix The fast matrix to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const sparse_matrix_impl& matrix) {
+        os << "SM[" << matrix.dim(0);
+
+        for (size_t i = 1; i < D; ++i) {
+            os << "," << matrix.dim(i);
+        }
+
+        return os << "]";
+    }
+};
+
 } //end of namespace etl
@@ -18,7 +18,8 @@ namespace etl {
  * \brief Enumeration for sparse storage formats
  */
 enum class sparse_storage {
-    COO ///< Coordinate Format (COO)
+    COO, ///< Coordinate Format (COO)
+    CSR  ///< Compressed Sparse Row Format (CSR)
 };
 
 } //end of namespace etl
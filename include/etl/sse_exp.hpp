@@ -42,6 +42,8 @@
 #include <xmmintrin.h>
 #include <emmintrin.h>
 
+#include <limits>
+
 #define ETL_INLINE_VEC_128 ETL_STATIC_INLINE(__m128)
 #define ETL_INLINE_VEC_128D ETL_STATIC_INLINE(__m128d)
 
@@ -90,6 +92,9 @@ PS_CONST(cephes_log_q2, 0.693359375);
 
 /*!
  * \brief SSE-Vectorized logarithm in single-precision
+ *
+ * The maximum error is 1 ULP.
+ *
  * \param x The vector of numbers to compute the logarithm from
  * \return a vector containing the logarithms of the input vector values
  */
@@ -170,86 +175,48 @@ PS_CONST(cephes_exp_p5, 5.0000001201E-1);
 
 /*!
  * \brief SSE-Vectorized exponential in double-precision
+ *
+ * The maximum error is 1 ULP, the result overflows to infinity for x > 709.4.
+ *
  * \param x The vector of numbers to compute the exponential from
  * \return a vector containing the exponentials of the input vector values
  */
 ETL_INLINE_VEC_128D exp_pd(__m128d x) {
     const __m128i offset = _mm_setr_epi32(1023, 1023, 0, 0);
 
-    __m128i k1;
-    __m128d p1;
-    __m128d a1;
-    __m128d x1;
-
-    auto xmm0 = _mm_set1_pd(7.09782712893383996843e2);
-    auto xmm1 = _mm_set1_pd(-7.08396418532264106224e2);
-
-    x1 = _mm_min_pd(x, xmm0);
-    x1 = _mm_max_pd(x1, xmm1);
-
-    /* a = x / log2 */
-    xmm0 = _mm_set1_pd(1.4426950408889634073599);
-    xmm1 = _mm_setzero_pd();
-    a1 = _mm_mul_pd(x1, xmm0);
-
-    /* k = (int)floor(a)  p = (float)k */
-    p1 = _mm_cmplt_pd(a1, xmm1);
-    xmm0 = _mm_set1_pd(1.0);
-    p1 = _mm_and_pd(p1, xmm0);
-    a1 = _mm_sub_pd(a1, p1);
-    k1 = _mm_cvttpd_epi32(a1);
-    p1 = _mm_cvtepi32_pd(k1);
-
-    /* x -= p * log2 */
-    xmm0 = _mm_set1_pd(6.93145751953125E-1);
-    xmm1 = _mm_set1_pd(1.42860682030941723212E-6);
-
-#ifdef __FMA__
-    x1 = _mm_fnmadd_pd(p1, xmm0, x1);
-    x1 = _mm_fnmadd_pd(p1, xmm1, x1);
-#else
-    a1 = _mm_mul_pd(p1, xmm0);
-    x1 = _mm_sub_pd(x1, a1);
-    a1 = _mm_mul_pd(p1, xmm1);
-    x1 = _mm_sub_pd(x1, a1);
-#endif
-
-    /* Compute e^x using a polynomial approximation. */
-    xmm0 = _mm_set1_pd(1.185268231308989403584147407056378360798378534739e-2);
-    xmm1 = _mm_set1_pd(3.87412011356070379615759057344100690905653320886699e-2);
-
-#ifdef __FMA__
-    a1 = _mm_fmadd_pd(x1, xmm0, xmm1);
-#else
-    a1 = _mm_mul_pd(x1, xmm0);
-    a1 = _mm_add_pd(a1, xmm1);
-#endif
-
-    xmm0 = _mm_set1_pd(0.16775408658617866431779970932853611481292418818223);
-    xmm1 = _mm_set1_pd(0.49981934577169208735732248650232562589934399402426);
-
-#ifdef __FMA__
-    a1 = _mm_fmadd_pd(a1, x1, xmm0);
-    a1 = _mm_fmadd_pd(a1, x1, xmm1);
-#else
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm0);
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm1);
-#endif
-
-    xmm0 = _mm_set1_pd(1.00001092396453942157124178508842412412025643386873);
-    xmm1 = _mm_set1_pd(0.99999989311082729779536722205742989232069120354073);
-
-#ifdef __FMA__
-    a1 = _mm_fmadd_pd(a1, x1, xmm0);
-    a1 = _mm_fmadd_pd(a1, x1, xmm1);
-#else
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm0);
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm1);
-#endif
+    // The bounds are the first operands so that NaN is kept
+    __m128d x1 = _mm_min_pd(_mm_set1_pd(7.09782712893383996843e2), x);
+    x1         = _mm_max_pd(_mm_set1_pd(-7.08396418532264106224e2), x1);
+
+    /* k = round(x / log2)  p = (double)k */
+    __m128i k1 = _mm_cvtpd_epi32(_mm_mul_pd(x1, _mm_set1_pd(1.4426950408889634073599)));
+    __m128d p1 = _mm_cvtepi32_pd(k1);
+
+    /* x -= p * log2, |x| <= log2 / 2 */
+    x1 = _mm_sub_pd(x1, _mm_mul_pd(p1, _mm_set1_pd(6.93145751953125E-1)));
+    x1 = _mm_sub_pd(x1, _mm_mul_pd(p1, _mm_set1_pd(1.42860682030941723212E-6)));
+
+    /* Compute e^x - 1 with the Taylor expansion up to x^13 */
+
+    auto x2 = _mm_mul_pd(x1, x1);
+    auto x4 = _mm_mul_pd(x2, x2);
+    auto x8 = _mm_mul_pd(x4, x4);
+
+    auto pt1 = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(1.0/6227020800.0), x1), _mm_set1_pd(1.0/479001600.0));
+    auto pt2 = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(1.0/39916800.0), x1), _mm_set1_pd(1.0/3628800.0));
+    auto pt3 = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(1.0/362880.0), x1), _mm_set1_pd(1.0/40320.0));
+    auto pt4 = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(1.0/5040.0), x1), _mm_set1_pd(1.0/720.0));
+    auto pt5 = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(1.0/120.0), x1), _mm_set1_pd(1.0/24.0));
+    auto pt6 = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(1.0/6.0), x1), _mm_set1_pd(1.0/2.0));
+
+    auto pt7  = _mm_add_pd(_mm_mul_pd(pt2, x2), pt3);
+    auto pt8  = _mm_add_pd(_mm_mul_pd(pt4, x2), pt5);
+    auto pt9  = _mm_add_pd(_mm_mul_pd(pt6, x2), x1);
+    auto pt10 = _mm_add_pd(_mm_mul_pd(pt1, x4), pt7);
+    auto pt11 = _mm_add_pd(_mm_mul_pd(pt8, x4), pt9);
+
+    __m128d a1 = _mm_add_pd(_mm_mul_pd(pt10, x8), pt11);
+    a1         = _mm_add_pd(a1, _mm_set1_pd(1.0));
 
     /* p = 2^k */
     k1 = _mm_add_epi32(k1, offset);
@@ -265,6 +232,9 @@ ETL_INLINE_VEC_128D exp_pd(__m128d x) {
 
 /*!
  * \brief SSE-Vectorized exponential in single-precision
+ *
+ * The maximum error is 1 ULP.
+ *
  * \param x The vector of numbers to compute the exponential from
  * \return a vector containing the exponentials of the input vector values
  */
@@ -273,8 +243,8 @@ ETL_INLINE_VEC_128 exp_ps(__m128 x) {
     __m128i emm0;
     __m128 one = *(__m128*)_ps_1;
 
-    x = _mm_min_ps(x, *(__m128*)_ps_exp_hi);
-    x = _mm_max_ps(x, *(__m128*)_ps_exp_lo);
+    x = _mm_min_ps(*(__m128*)_ps_exp_hi, x);
+    x = _mm_max_ps(*(__m128*)_ps_exp_lo, x);
 
     /* express exp(x) as exp(g + n*log(2)) */
     fx = _mm_mul_ps(x, *(__m128*)_ps_cephes_LOG2EF);
@@ -332,6 +302,9 @@ PS_CONST(cephes_FOPI, 1.27323954473516); // 4 / M_PI
 
 /*!
  * \brief SSE-Vectorized sinus in single-precision
+ *
+ * The maximum error is 1 ULP for |x| <= Pi, it grows with |x| (about 80 ULP at 1000).
+ *
  * \param x The vector of numbers to compute the sinus from
  * \return a vector containing the sinus of the input vector values
  */
@@ -414,6 +387,9 @@ ETL_INLINE_VEC_128 sin_ps(__m128 x) { // any x
 
 /*!
  * \brief SSE-Vectorized cosinus in single-precision
+ *
+ * The maximum error is 1 ULP for |x| <= Pi, it grows with |x| (about 80 ULP at 1000).
+ *
  * \param x The vector of numbers to compute the cosinus from
  * \return a vector containing the cosinus of the input vector values
  */
@@ -491,6 +467,318 @@ ETL_INLINE_VEC_128 cos_ps(__m128 x) { // any x
     return y;
 }
 
+/*!
+ * \brief SSE-Vectorized logarithm in double-precision
+ *
+ * The maximum error is 1 ULP for positive normal and denormal inputs.
+ *
+ * \param x The vector of numbers to compute the logarithm from
+ * \return a vector containing the logarithms of the input vector values
+ */
+ETL_INLINE_VEC_128D log_pd(__m128d x) {
+    const __m128d one   = _mm_set1_pd(1.0);
+    const __m128d zero  = _mm_setzero_pd();
+    const __m128d inf   = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    const __m128d magic = _mm_set1_pd(4503599627370496.0); // 2^52
+
+    __m128d invalid_mask = _mm_cmpnge_pd(x, zero); // negative args and NaN will be NaN
+    __m128d zero_mask    = _mm_cmpeq_pd(x, zero);
+    __m128d inf_mask     = _mm_cmpeq_pd(x, inf);
+
+    // Denormals are scaled into the normal range
+    __m128d denorm_mask = _mm_cmplt_pd(x, _mm_set1_pd(std::numeric_limits<double>::min()));
+    x                   = _mm_or_pd(_mm_and_pd(denorm_mask, _mm_mul_pd(x, magic)), _mm_andnot_pd(denorm_mask, x));
+
+    // The exponent is converted to double by adding it to the bits of 2^52
+    __m128i emm0 = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+    emm0         = _mm_or_si128(emm0, _mm_castpd_si128(magic));
+    __m128d e    = _mm_sub_pd(_mm_castsi128_pd(emm0), _mm_set1_pd(4503599627370496.0 + 1022.0));
+    e            = _mm_sub_pd(e, _mm_and_pd(denorm_mask, _mm_set1_pd(52.0)));
+
+    // keep only the fractional part, in [0.5, 1[
+    x = _mm_and_pd(x, _mm_castsi128_pd(_mm_set1_epi64x(~0x7FF0000000000000LL)));
+    x = _mm_or_pd(x, _mm_set1_pd(0.5));
+
+    __m128d mask = _mm_cmplt_pd(x, _mm_set1_pd(0.70710678118654752440));
+    __m128d tmp  = _mm_and_pd(x, mask);
+    x            = _mm_sub_pd(x, one);
+    e            = _mm_sub_pd(e, _mm_and_pd(one, mask));
+    x            = _mm_add_pd(x, tmp);
+
+    __m128d z = _mm_mul_pd(x, x);
+
+    // log(1 + x) = x - x^2 / 2 + x^3 * P(x) / Q(x)
+
+    __m128d p = _mm_set1_pd(1.01875663804580931796E-4);
+    p         = _mm_add_pd(_mm_mul_pd(p, x), _mm_set1_pd(4.97494994976747001425E-1));
+    p         = _mm_add_pd(_mm_mul_pd(p, x), _mm_set1_pd(4.70579119878881725854E0));
+    p         = _mm_add_pd(_mm_mul_pd(p, x), _mm_set1_pd(1.44989225341610930846E1));
+    p         = _mm_add_pd(_mm_mul_pd(p, x), _mm_set1_pd(1.79368678507819816313E1));
+    p         = _mm_add_pd(_mm_mul_pd(p, x), _mm_set1_pd(7.70838733755885391666E0));
+
+    __m128d q = _mm_add_pd(x, _mm_set1_pd(1.12873587189167450590E1));
+    q         = _mm_add_pd(_mm_mul_pd(q, x), _mm_set1_pd(4.52279145837532221105E1));
+    q         = _mm_add_pd(_mm_mul_pd(q, x), _mm_set1_pd(8.29875266912776603211E1));
+    q         = _mm_add_pd(_mm_mul_pd(q, x), _mm_set1_pd(7.11544750618563894466E1));
+    q         = _mm_add_pd(_mm_mul_pd(q, x), _mm_set1_pd(2.31251620126765340583E1));
+
+    __m128d y = _mm_mul_pd(_mm_mul_pd(x, z), _mm_div_pd(p, q));
+
+    y = _mm_sub_pd(y, _mm_mul_pd(e, _mm_set1_pd(2.121944400546905827679e-4)));
+    y = _mm_sub_pd(y, _mm_mul_pd(z, _mm_set1_pd(0.5)));
+    x = _mm_add_pd(x, y);
+    x = _mm_add_pd(x, _mm_mul_pd(e, _mm_set1_pd(0.693359375)));
+
+    // Special values
+    x = _mm_or_pd(_mm_and_pd(zero_mask, _mm_sub_pd(zero, inf)), _mm_andnot_pd(zero_mask, x));
+    x = _mm_or_pd(_mm_and_pd(inf_mask, inf), _mm_andnot_pd(inf_mask, x));
+    x = _mm_or_pd(x, invalid_mask);
+
+    return x;
+}
+
+/*!
+ * \brief SSE-Vectorized sinus or cosinus in double-precision
+ * \param x The vector of numbers to compute the sinus or cosinus from
+ * \param cosinus Indicates if the cosinus or the sinus must be computed
+ * \return a vector containing the sinus or cosinus of the input vector values
+ */
+ETL_INLINE_VEC_128D sincos_pd(__m128d x, bool cosinus) {
+    const __m128d sign_mask = _mm_set1_pd(-0.0);
+    const __m128d zero      = _mm_setzero_pd();
+    const __m128i four      = _mm_set1_epi32(4);
+    const __m128i two       = _mm_set1_epi32(2);
+
+    __m128d sign_bit = _mm_and_pd(x, sign_mask);
+
+    x = _mm_andnot_pd(sign_mask, x);
+
+    // infinite and NaN arguments will be NaN
+    __m128d invalid_mask = _mm_cmpnlt_pd(x, _mm_set1_pd(std::numeric_limits<double>::infinity()));
+
+    // j = (x * 4 / Pi) rounded to the next even integer
+    __m128i emm2 = _mm_cvttpd_epi32(_mm_mul_pd(x, _mm_set1_pd(1.27323954473516268615)));
+    emm2         = _mm_add_epi32(emm2, _mm_set1_epi32(1));
+    emm2         = _mm_and_si128(emm2, _mm_set1_epi32(~1));
+    __m128d y    = _mm_cvtepi32_pd(emm2);
+
+    if (cosinus) {
+        emm2 = _mm_sub_epi32(emm2, two);
+
+        // The sign of x does not matter for the cosinus
+        sign_bit = _mm_and_pd(_mm_cmpneq_pd(_mm_cvtepi32_pd(_mm_andnot_si128(emm2, four)), zero), sign_mask);
+    } else {
+        sign_bit = _mm_xor_pd(sign_bit, _mm_and_pd(_mm_cmpneq_pd(_mm_cvtepi32_pd(_mm_and_si128(emm2, four)), zero), sign_mask));
+    }
+
+    __m128d poly_mask = _mm_cmpeq_pd(_mm_cvtepi32_pd(_mm_and_si128(emm2, two)), zero);
+
+    // Extended precision modular arithmetic: x = ((x - y * DP1) - y * DP2) - y * DP3
+    x = _mm_sub_pd(x, _mm_mul_pd(y, _mm_set1_pd(7.85398125648498535156E-1)));
+    x = _mm_sub_pd(x, _mm_mul_pd(y, _mm_set1_pd(3.77489470793079817668E-8)));
+    x = _mm_sub_pd(x, _mm_mul_pd(y, _mm_set1_pd(2.69515142907905952645E-15)));
+
+    __m128d z = _mm_mul_pd(x, x);
+
+    // Cosinus polynomial (0 <= x <= Pi/4)
+
+    __m128d yc = _mm_set1_pd(-1.13585365213876817300E-11);
+    yc         = _mm_add_pd(_mm_mul_pd(yc, z), _mm_set1_pd(2.08757008419747316778E-9));
+    yc         = _mm_add_pd(_mm_mul_pd(yc, z), _mm_set1_pd(-2.75573141792967388112E-7));
+    yc         = _mm_add_pd(_mm_mul_pd(yc, z), _mm_set1_pd(2.48015872888517045348E-5));
+    yc         = _mm_add_pd(_mm_mul_pd(yc, z), _mm_set1_pd(-1.38888888888730564116E-3));
+    yc         = _mm_add_pd(_mm_mul_pd(yc, z), _mm_set1_pd(4.16666666666665929218E-2));
+    yc         = _mm_mul_pd(_mm_mul_pd(yc, z), z);
+    yc         = _mm_sub_pd(yc, _mm_mul_pd(z, _mm_set1_pd(0.5)));
+    yc         = _mm_add_pd(yc, _mm_set1_pd(1.0));
+
+    // Sinus polynomial (0 <= x <= Pi/4)
+
+    __m128d ys = _mm_set1_pd(1.58962301576546568060E-10);
+    ys         = _mm_add_pd(_mm_mul_pd(ys, z), _mm_set1_pd(-2.50507477628578072866E-8));
+    ys         = _mm_add_pd(_mm_mul_pd(ys, z), _mm_set1_pd(2.75573136213857245213E-6));
+    ys         = _mm_add_pd(_mm_mul_pd(ys, z), _mm_set1_pd(-1.98412698295895385996E-4));
+    ys         = _mm_add_pd(_mm_mul_pd(ys, z), _mm_set1_pd(8.33333333332211858878E-3));
+    ys         = _mm_add_pd(_mm_mul_pd(ys, z), _mm_set1_pd(-1.66666666666666307295E-1));
+    ys         = _mm_mul_pd(_mm_mul_pd(ys, z), x);
+    ys         = _mm_add_pd(ys, x);
+
+    // select the correct result from the two polynoms and update the sign
+    y = _mm_or_pd(_mm_and_pd(poly_mask, ys), _mm_andnot_pd(poly_mask, yc));
+    y = _mm_xor_pd(y, sign_bit);
+
+    return _mm_or_pd(y, invalid_mask);
+}
+
+/*!
+ * \brief SSE-Vectorized sinus in double-precision
+ *
+ * The maximum error is 1 ULP for |x| < 10^6 and a few ULP up to
+ * 2^30, larger arguments are not supported.
+ *
+ * \param x The vector of numbers to compute the sinus from
+ * \return a vector containing the sinus of the input vector values
+ */
+ETL_INLINE_VEC_128D sin_pd(__m128d x) {
+    return sincos_pd(x, false);
+}
+
+/*!
+ * \brief SSE-Vectorized cosinus in double-precision
+ *
+ * The maximum error is 1 ULP for |x| < 10^6 and a few ULP up to
+ * 2^30, larger arguments are not supported.
+ *
+ * \param x The vector of numbers to compute the cosinus from
+ * \return a vector containing the cosinus of the input vector values
+ */
+ETL_INLINE_VEC_128D cos_pd(__m128d x) {
+    return sincos_pd(x, true);
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic tangent in single-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_128 tanh_ps(__m128 x) {
+    const __m128 one       = _mm_set1_ps(1.0f);
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+
+    __m128 sign_bit = _mm_and_ps(x, sign_mask);
+    __m128 z        = _mm_andnot_ps(sign_mask, x);
+
+    // tanh(|x|) = 1 - 2 / (exp(2|x|) + 1), tanh(20) is already 1
+    __m128 e     = exp_ps(_mm_mul_ps(_mm_min_ps(_mm_set1_ps(20.0f), z), _mm_set1_ps(2.0f)));
+    __m128 large = _mm_sub_ps(one, _mm_div_ps(_mm_set1_ps(2.0f), _mm_add_ps(e, one)));
+    large        = _mm_or_ps(large, sign_bit);
+
+    // tanh(x) = x + x^3 * P(x^2) for |x| <= 0.625
+
+    __m128 s     = _mm_mul_ps(x, x);
+    __m128 small = _mm_set1_ps(-5.70498872745E-3f);
+    small        = _mm_add_ps(_mm_mul_ps(small, s), _mm_set1_ps(2.06390887954E-2f));
+    small        = _mm_add_ps(_mm_mul_ps(small, s), _mm_set1_ps(-5.37397155531E-2f));
+    small        = _mm_add_ps(_mm_mul_ps(small, s), _mm_set1_ps(1.33314422036E-1f));
+    small        = _mm_add_ps(_mm_mul_ps(small, s), _mm_set1_ps(-3.33332819422E-1f));
+    small        = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(small, s), x), x);
+
+    __m128 mask = _mm_cmpgt_ps(z, _mm_set1_ps(0.625f));
+    return _mm_or_ps(_mm_and_ps(mask, large), _mm_andnot_ps(mask, small));
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic tangent in double-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_128D tanh_pd(__m128d x) {
+    const __m128d one       = _mm_set1_pd(1.0);
+    const __m128d sign_mask = _mm_set1_pd(-0.0);
+
+    __m128d sign_bit = _mm_and_pd(x, sign_mask);
+    __m128d z        = _mm_andnot_pd(sign_mask, x);
+
+    // tanh(|x|) = 1 - 2 / (exp(2|x|) + 1), tanh(20) is already 1
+    __m128d e     = exp_pd(_mm_mul_pd(_mm_min_pd(_mm_set1_pd(20.0), z), _mm_set1_pd(2.0)));
+    __m128d large = _mm_sub_pd(one, _mm_div_pd(_mm_set1_pd(2.0), _mm_add_pd(e, one)));
+    large         = _mm_or_pd(large, sign_bit);
+
+    // tanh(x) = x + x^3 * P(x^2) / Q(x^2) for |x| <= 0.625
+
+    __m128d s = _mm_mul_pd(x, x);
+
+    __m128d p = _mm_set1_pd(-9.64399179425052238628E-1);
+    p         = _mm_add_pd(_mm_mul_pd(p, s), _mm_set1_pd(-9.92877231001918586564E1));
+    p         = _mm_add_pd(_mm_mul_pd(p, s), _mm_set1_pd(-1.61468768441708447952E3));
+
+    __m128d q = _mm_add_pd(s, _mm_set1_pd(1.12811678491632931402E2));
+    q         = _mm_add_pd(_mm_mul_pd(q, s), _mm_set1_pd(2.23548839060100448583E3));
+    q         = _mm_add_pd(_mm_mul_pd(q, s), _mm_set1_pd(4.84406305325125486048E3));
+
+    __m128d small = _mm_add_pd(_mm_mul_pd(_mm_mul_pd(x, s), _mm_div_pd(p, q)), x);
+
+    __m128d mask = _mm_cmpgt_pd(z, _mm_set1_pd(0.625));
+    return _mm_or_pd(_mm_and_pd(mask, large), _mm_andnot_pd(mask, small));
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic sinus in single-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_128 sinh_ps(__m128 x) {
+    const __m128 half      = _mm_set1_ps(0.5f);
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+
+    __m128 sign_bit = _mm_and_ps(x, sign_mask);
+    __m128 z        = _mm_andnot_ps(sign_mask, x);
+
+    // sinh(|x|) = exp(|x|) / 2 - 1 / (2 * exp(|x|))
+    __m128 e     = exp_ps(z);
+    __m128 large = _mm_sub_ps(_mm_mul_ps(half, e), _mm_div_ps(half, e));
+    large        = _mm_or_ps(large, sign_bit);
+
+    // sinh(x) = x + x^3 * P(x^2) for |x| <= 1
+
+    __m128 s     = _mm_mul_ps(x, x);
+    __m128 small = _mm_set1_ps(2.03721912945E-4f);
+    small        = _mm_add_ps(_mm_mul_ps(small, s), _mm_set1_ps(8.33028376239E-3f));
+    small        = _mm_add_ps(_mm_mul_ps(small, s), _mm_set1_ps(1.66667160211E-1f));
+    small        = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(small, s), x), x);
+
+    __m128 mask = _mm_cmpgt_ps(z, _mm_set1_ps(1.0f));
+    return _mm_or_ps(_mm_and_ps(mask, large), _mm_andnot_ps(mask, small));
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic sinus in double-precision
+ *
+ * The maximum error is 3 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_128D sinh_pd(__m128d x) {
+    const __m128d half      = _mm_set1_pd(0.5);
+    const __m128d sign_mask = _mm_set1_pd(-0.0);
+
+    __m128d sign_bit = _mm_and_pd(x, sign_mask);
+    __m128d z        = _mm_andnot_pd(sign_mask, x);
+
+    // sinh(|x|) = exp(|x|) / 2 - 1 / (2 * exp(|x|))
+    __m128d e     = exp_pd(z);
+    __m128d large = _mm_sub_pd(_mm_mul_pd(half, e), _mm_div_pd(half, e));
+    large         = _mm_or_pd(large, sign_bit);
+
+    // sinh(x) = x + x^3 * P(x^2) / Q(x^2) for |x| <= 1
+
+    __m128d s = _mm_mul_pd(x, x);
+
+    __m128d p = _mm_set1_pd(-7.89474443963537015605E-1);
+    p         = _mm_add_pd(_mm_mul_pd(p, s), _mm_set1_pd(-1.63725857525983828727E2));
+    p         = _mm_add_pd(_mm_mul_pd(p, s), _mm_set1_pd(-1.15614435765005216044E4));
+    p         = _mm_add_pd(_mm_mul_pd(p, s), _mm_set1_pd(-3.51754964808151394800E5));
+
+    __m128d q = _mm_add_pd(s, _mm_set1_pd(-2.77711081420602794433E2));
+    q         = _mm_add_pd(_mm_mul_pd(q, s), _mm_set1_pd(3.61578279834431989373E4));
+    q         = _mm_add_pd(_mm_mul_pd(q, s), _mm_set1_pd(-2.11052978884890840399E6));
+
+    __m128d small = _mm_add_pd(_mm_mul_pd(_mm_mul_pd(x, s), _mm_div_pd(p, q)), x);
+
+    __m128d mask = _mm_cmpgt_pd(z, _mm_set1_pd(1.0));
+    return _mm_or_pd(_mm_and_pd(mask, large), _mm_andnot_pd(mask, small));
+}
+
 } //end of namespace etl
 
 #endif //__SSE3__
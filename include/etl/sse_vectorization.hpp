@@ -1193,6 +1193,50 @@ struct sse_vec {
         return etl::sin_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) cos(sse_simd_double x) {
+        return etl::cos_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) sin(sse_simd_double x) {
+        return etl::sin_pd(x.value);
+    }
+
+    // Hyperbolic functions
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_float) tanh(sse_simd_float x) {
+        return etl::tanh_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) tanh(sse_simd_double x) {
+        return etl::tanh_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_float) sinh(sse_simd_float x) {
+        return etl::sinh_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) sinh(sse_simd_double x) {
+        return etl::sinh_pd(x.value);
+    }
+
 //The Intel C++ Compiler (icc) has more intrinsics.
 //ETL uses them when compiled with icc
 
@@ -1219,6 +1263,13 @@ struct sse_vec {
         return etl::log_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) log(sse_simd_double x) {
+        return etl::log_pd(x.value);
+    }
+
 #else //__INTEL_COMPILER
 
     //Exponential
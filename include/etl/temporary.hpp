@@ -209,11 +209,13 @@ decltype(auto) force_temporary_dim_only(E&& expr) {
  * \brief Make a temporary out of the expression if necessary
  *
  * A temporary is necessary when the expression has no direct access.
+ * Sparse matrices are forwarded as is, the kernels using them only
+ * iterate over their non-zero elements.
  *
  * \param expr The expression to make a temporary from
  * \return a temporary of the expression if necessary, otherwise the expression itself
  */
-template <typename E, cpp_enable_iff(has_direct_access<E>)>
+template <typename E, cpp_enable_iff(has_direct_access<E> || is_sparse_matrix<E>)>
 decltype(auto) make_temporary(E&& expr) {
     return std::forward<E>(expr);
 }
@@ -226,7 +228,7 @@ decltype(auto) make_temporary(E&& expr) {
  * \param expr The expression to make a temporary from
  * \return a temporary of the expression if necessary, otherwise the expression itself
  */
-template <typename E, cpp_enable_iff(!has_direct_access<E>)>
+template <typename E, cpp_enable_iff(!has_direct_access<E> && !is_sparse_matrix<E>)>
 decltype(auto) make_temporary(E&& expr) {
     return force_temporary(std::forward<E>(expr));
 }
@@ -24,12 +24,22 @@ constexpr size_t gemm_rr_small_threshold    = 1000; ///< The number of elements
 constexpr size_t gemm_nt_rr_small_threshold = 1000; ///< The number of elements of B after which we use BLAS-like kernel (for GEMM)
 constexpr size_t gemm_cc_small_threshold    = 1000; ///< The number of elements of B after which we use BLAS-like kernel (for GEMM)
 
+constexpr size_t gemm_blis_parallel_threshold = 1000; ///< The number of elements of C after which we use the parallel BLIS-like kernel (for GEMM)
+
+constexpr size_t gemm_rr_parallel_threshold = 1000; ///< The number of multiply-adds after which the row-major GEMM kernels are parallelized
+constexpr size_t gemm_cc_parallel_threshold = 1000; ///< The number of multiply-adds after which the column-major GEMM kernels are parallelized
+constexpr size_t gemm_cr_parallel_threshold = 1000; ///< The number of multiply-adds after which the GEMM kernels with a column-major lhs are parallelized
+constexpr size_t gemm_rc_parallel_threshold = 1000; ///< The number of multiply-adds after which the GEMM kernels with a column-major rhs are parallelized
+
 constexpr size_t gevm_rm_small_threshold = 1000; ///< The number of elements of b after which we use BLAS-like kernel
 constexpr size_t gevm_cm_small_threshold = 1000; ///< The number of elements of b after which we use BLAS-like kernel
 
 constexpr size_t gemv_rm_small_threshold = 1000; ///< The number of elements of A after which we use BLAS-like kernel
 constexpr size_t gemv_cm_small_threshold = 1000; ///< The number of elements of A after which we use BLAS-like kernel
 
+constexpr size_t gevm_parallel_threshold = 1000; ///< The number of elements of b after which we use the parallel GEVM
+constexpr size_t gemv_parallel_threshold = 1000; ///< The number of elements of A after which we use the parallel GEMV
+
 constexpr size_t parallel_threshold = 2 * 1024; ///< The minimum number of elements before considering parallel implementation
 
 constexpr size_t sum_parallel_threshold = 1024 * 2; ///< The minimum number of elements before considering parallel acc implementation
@@ -38,12 +48,26 @@ constexpr size_t vec_sum_parallel_threshold = 1024 * 2; ///< The minimum number
 constexpr size_t conv1_parallel_threshold_conv   = 100; ///< The mimum output size before considering parallel convolution
 constexpr size_t conv1_parallel_threshold_kernel = 16;  ///< The mimum kernel size before considering parallel convolution
 
+constexpr size_t conv_winograd_parallel_threshold = 1024; ///< The minimum number of transformed elements before considering parallel Winograd convolution
+constexpr size_t winograd_large_tile_min          = 8;    ///< The minimum output size before using the large tiles of the Winograd convolution
+constexpr size_t winograd_max_tile_block          = 16;   ///< The maximum number of tiles of the blocks of the Winograd convolution
+constexpr size_t winograd_block_workspace         = 4096; ///< The size, in bytes, of the transformed tiles of the blocks of the Winograd convolution
+constexpr size_t winograd_min_channels            = 4;    ///< The minimum number of input and output channels before using the Winograd valid convolution
+
+constexpr size_t conv4_gemm_batch_columns = 1024; ///< The number of columns of the GEMM under which several images are lowered together in the 4D convolution
+
 constexpr size_t fft1_many_threshold_transforms = 16;  ///< The mimum number of transforms to parallelize them
 constexpr size_t fft1_many_threshold_n          = 768; ///< The mimum size of the transforms to parallelize them
 
 constexpr size_t fft2_many_threshold_transforms = 16;   ///< The mimum number of transforms to parallelize them
 constexpr size_t fft2_many_threshold_n          = 1024; ///< The mimum size of the transforms to parallelize them
 
+constexpr size_t fft2_strip_width = 4; ///< The number of columns transformed together by the 2D FFT
+
+constexpr size_t transpose_block_size         = 16;      ///< The size of the cache blocks of the vectorized transposition
+constexpr size_t transpose_parallel_threshold = 32 * 32; ///< The minimum number of elements before considering parallel transposition
+constexpr size_t inplace_transpose_threshold  = 32 * 32; ///< The minimum number of elements before transposing rectangular matrices without a copy
+
 constexpr size_t stream_threshold = 1024; ///< The threshold at which stream is used
 
 #else
@@ -55,12 +79,22 @@ constexpr size_t gemm_rr_small_threshold    = 10000;     ///< The number of elem
 constexpr size_t gemm_nt_rr_small_threshold = 500 * 500; ///< The number of elements of B after which we use BLAS-like kernel (for GEMM)
 constexpr size_t gemm_cc_small_threshold    = 40000;     ///< The number of elements of B after which we use BLAS-like kernel (for GEMM)
 
+constexpr size_t gemm_blis_parallel_threshold = 256 * 256; ///< The number of elements of C after which we use the parallel BLIS-like kernel (for GEMM)
+
+constexpr size_t gemm_rr_parallel_threshold = 64 * 64 * 64; ///< The number of multiply-adds after which the row-major GEMM kernels are parallelized
+constexpr size_t gemm_cc_parallel_threshold = 64 * 64 * 64; ///< The number of multiply-adds after which the column-major GEMM kernels are parallelized
+constexpr size_t gemm_cr_parallel_threshold = 48 * 48 * 48; ///< The number of multiply-adds after which the GEMM kernels with a column-major lhs are parallelized
+constexpr size_t gemm_rc_parallel_threshold = 32 * 32 * 32; ///< The number of multiply-adds after which the GEMM kernels with a column-major rhs are parallelized
+
 constexpr size_t gevm_rm_small_threshold = 72000;   ///< The number of elements of b after which we use BLAS-like kernel
 constexpr size_t gevm_cm_small_threshold = 4000000; ///< The number of elements of b after which we use BLAS-like kernel
 
 constexpr size_t gemv_rm_small_threshold = 4500000; ///< The number of elements of A after which we use BLAS-like kernel
 constexpr size_t gemv_cm_small_threshold = 2400000; ///< The number of elements of A after which we use BLAS-like kernel
 
+constexpr size_t gevm_parallel_threshold = 128 * 1024; ///< The number of elements of b after which we use the parallel GEVM
+constexpr size_t gemv_parallel_threshold = 128 * 1024; ///< The number of elements of A after which we use the parallel GEMV
+
 constexpr size_t parallel_threshold = 128 * 1024; ///< The minimum number of elements before considering parallel implementation
 
 constexpr size_t sum_parallel_threshold = 1024 * 32; ///< The minimum number of elements before considering parallel acc implementation
@@ -69,12 +103,26 @@ constexpr size_t vec_sum_parallel_threshold = 1024 * 128; ///< The minimum numbe
 constexpr size_t conv1_parallel_threshold_conv   = 100; ///< The mimum output size before considering parallel convolution
 constexpr size_t conv1_parallel_threshold_kernel = 16;  ///< The mimum kernel size before considering parallel convolution
 
+constexpr size_t conv_winograd_parallel_threshold = 64 * 1024;  ///< The minimum number of transformed elements before considering parallel Winograd convolution
+constexpr size_t winograd_large_tile_min          = 12;         ///< The minimum output size before using the large tiles of the Winograd convolution
+constexpr size_t winograd_max_tile_block          = 256;        ///< The maximum number of tiles of the blocks of the Winograd convolution
+constexpr size_t winograd_block_workspace         = 256 * 1024; ///< The size, in bytes, of the transformed tiles of the blocks of the Winograd convolution
+constexpr size_t winograd_min_channels            = 48;         ///< The minimum number of input and output channels before using the Winograd valid convolution
+
+constexpr size_t conv4_gemm_batch_columns = 256; ///< The number of columns of the GEMM under which several images are lowered together in the 4D convolution
+
 constexpr size_t fft1_many_threshold_transforms = 16;  ///< The mimum number of transforms to parallelize them
 constexpr size_t fft1_many_threshold_n          = 768; ///< The mimum size of the transforms to parallelize them
 
 constexpr size_t fft2_many_threshold_transforms = 16;   ///< The mimum number of transforms to parallelize them
 constexpr size_t fft2_many_threshold_n          = 1024; ///< The mimum size of the transforms to parallelize them
 
+constexpr size_t fft2_strip_width = 32; ///< The number of columns transformed together by the 2D FFT
+
+constexpr size_t transpose_block_size         = 64;          ///< The size of the cache blocks of the vectorized transposition
+constexpr size_t transpose_parallel_threshold = 256 * 256;   ///< The minimum number of elements before considering parallel transposition
+constexpr size_t inplace_transpose_threshold  = 4096 * 4096; ///< The minimum number of elements before transposing rectangular matrices without a copy
+
 constexpr size_t stream_threshold = cache_size; ///< The threshold at which stream is used
 
 #endif
@@ -89,6 +89,19 @@ struct is_sparse_matrix_impl : std::false_type {};
 template <typename V1, sparse_storage V2, size_t V3>
 struct is_sparse_matrix_impl<sparse_matrix_impl<V1, V2, V3>> : std::true_type {};
 
+/*!
+ * \brief Traits to test if the given type is a packed convolution filter
+ * \tparam T The type to test
+ */
+template <typename T>
+struct is_packed_conv_filter_impl : std::false_type {};
+
+/*!
+ * \copydoc is_packed_conv_filter_impl
+ */
+template <typename T, size_t D>
+struct is_packed_conv_filter_impl<packed_conv_filter<T, D>> : std::true_type {};
+
 /*!
  * \brief Special traits helper to detect if type is a dyn_matrix_view
  * \tparam T The type to test
@@ -196,6 +209,20 @@ constexpr size_t gpu_inc_impl(){
     return 1;
 }
 
+/*!
+ * \brief Helper traits to test if an operator needs the flat index of the
+ * element it is computing.
+ */
+template<typename Op, typename Enable = void>
+struct is_indexed_op_impl : std::false_type {};
+
+/*!
+ * \brief Helper traits to test if an operator needs the flat index of the
+ * element it is computing.
+ */
+template<typename Op>
+struct is_indexed_op_impl <Op, std::enable_if_t<Op::indexed>> : std::true_type {};
+
 } // end of namespace traits_detail
 
 // CPP17: Remove and_v and use variadic &&
@@ -275,6 +302,13 @@ constexpr bool is_custom_dyn_matrix = traits_detail::is_custom_dyn_matrix_impl<s
 template <typename T>
 constexpr bool is_sparse_matrix = traits_detail::is_sparse_matrix_impl<std::decay_t<T>>::value;
 
+/*!
+ * \brief Traits indicating if the given type is a packed convolution filter
+ * \tparam T The type to test
+ */
+template <typename T>
+constexpr bool is_packed_conv_filter = traits_detail::is_packed_conv_filter_impl<std::decay_t<T>>::value;
+
 /*!
  * \brief Traits indicating if the given ETL type is a symmetric matrix
  * \tparam T The type to test
@@ -359,6 +393,14 @@ constexpr bool is_binary_expr = cpp::is_specialization_of_v<etl::binary_expr, st
 template <typename T>
 constexpr bool is_generator_expr = cpp::is_specialization_of_v<etl::generator_expr, std::decay_t<T>>;
 
+/*!
+ * \brief Traits indicating if the given operator (or generator) needs
+ * the flat index of the element it is computing.
+ * \tparam Op The operator to test
+ */
+template <typename Op>
+constexpr bool is_indexed_op = traits_detail::is_indexed_op_impl<Op>::value;
+
 /*!
  * \brief Traits indicating if the given ETL type is an optimized expression.
  * \tparam T The type to test
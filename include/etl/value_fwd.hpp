@@ -286,4 +286,17 @@ using custom_fast_matrix = custom_fast_matrix_impl<T, cpp::array_wrapper<T>, ord
 template <typename T, size_t D = 2>
 using sparse_matrix                 = sparse_matrix_impl<T, sparse_storage::COO, D>;
 
+/*!
+ * \brief A sparse matrix, of D dimensions, in CSR storage
+ */
+template <typename T, size_t D = 2>
+using sparse_csr_matrix             = sparse_matrix_impl<T, sparse_storage::CSR, D>;
+
+/*!
+ * \brief Convolution kernels prepared once to be used by several
+ * convolutions.
+ */
+template <typename T, size_t D = 4>
+struct packed_conv_filter;
+
 } //end of namespace etl
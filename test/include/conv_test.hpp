@@ -325,6 +325,44 @@ DYN_CONV_FUNCTOR(blas_vec_dyn_conv4_valid_filter_flipped, c = selected_helper(et
 #define DYN_CONV4_VALID_FILTER_FLIPPED_TEST_CASE_SECTION_BLAS_VEC
 #endif
 
+#ifdef TEST_VEC
+CONV_FUNCTOR(winograd_conv4_valid, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid<S1,S2,P1,P2>(a, b))))
+CONV_FUNCTOR(winograd_conv4_valid_flipped, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_flipped<S1,S2,P1,P2>(a, b))))
+CONV_FUNCTOR(winograd_conv4_valid_back, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_back<S1,S2,P1,P2>(a, b))))
+CONV_FUNCTOR(winograd_conv4_valid_back_flipped, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_back_flipped<S1,S2,P1,P2>(a, b))))
+CONV_FUNCTOR(winograd_conv4_full, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_full(a, b))))
+CONV_FUNCTOR(winograd_conv4_full_flipped, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_full_flipped(a, b))))
+
+DYN_CONV_FUNCTOR(winograd_dyn_conv4_valid, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid(a, b, s1, s2, p1, p2))))
+DYN_CONV_FUNCTOR(winograd_dyn_conv4_valid_flipped, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_flipped(a, b, s1, s2, p1, p2))))
+DYN_CONV_FUNCTOR(winograd_dyn_conv4_valid_back, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_back(a, b, s1, s2, p1, p2))))
+DYN_CONV_FUNCTOR(winograd_dyn_conv4_valid_back_flipped, c = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_back_flipped(a, b, s1, s2, p1, p2))))
+
+#define CONV4_VALID_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_conv4_valid)
+#define CONV4_VALID_FLIPPED_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_conv4_valid_flipped)
+#define CONV4_VALID_BACK_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_conv4_valid_back)
+#define CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_conv4_valid_back_flipped)
+#define CONV4_FULL_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_conv4_full)
+#define CONV4_FULL_FLIPPED_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_conv4_full_flipped)
+
+#define DYN_CONV4_VALID_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_dyn_conv4_valid)
+#define DYN_CONV4_VALID_FLIPPED_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_dyn_conv4_valid_flipped)
+#define DYN_CONV4_VALID_BACK_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_dyn_conv4_valid_back)
+#define DYN_CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_WINOGRAD CONV_TEST_CASE_SECTIONS(winograd_dyn_conv4_valid_back_flipped)
+#else
+#define CONV4_VALID_TEST_CASE_SECTION_WINOGRAD
+#define CONV4_VALID_FLIPPED_TEST_CASE_SECTION_WINOGRAD
+#define CONV4_VALID_BACK_TEST_CASE_SECTION_WINOGRAD
+#define CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_WINOGRAD
+#define CONV4_FULL_TEST_CASE_SECTION_WINOGRAD
+#define CONV4_FULL_FLIPPED_TEST_CASE_SECTION_WINOGRAD
+
+#define DYN_CONV4_VALID_TEST_CASE_SECTION_WINOGRAD
+#define DYN_CONV4_VALID_FLIPPED_TEST_CASE_SECTION_WINOGRAD
+#define DYN_CONV4_VALID_BACK_TEST_CASE_SECTION_WINOGRAD
+#define DYN_CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_WINOGRAD
+#endif
+
 #ifdef ETL_BLAS_MODE
 CONV_FUNCTOR(blas_mkl_conv2_valid_multi, c = selected_helper(etl::conv_multi_impl::BLAS_MKL, (etl::conv_2d_valid_multi<S1, S2, P1, P2>(a, b))))
 CONV_FUNCTOR(blas_mkl_conv2_valid_multi_multi_flipped, c = selected_helper(etl::conv_multi_impl::BLAS_MKL, (etl::conv_2d_valid_multi_multi_flipped<S1, S2, P1, P2>(a, b))))
@@ -799,6 +837,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         CONV4_VALID_TEST_CASE_SECTION_DEFAULT    \
         CONV4_VALID_TEST_CASE_SECTION_STD        \
         CONV4_VALID_TEST_CASE_SECTION_BLAS_VEC   \
+        CONV4_VALID_TEST_CASE_SECTION_WINOGRAD   \
         CONV4_VALID_TEST_CASE_SECTION_BLAS_MKL   \
         CONV4_VALID_TEST_CASE_SECTION_VEC        \
         CONV4_VALID_TEST_CASE_SECTION_CUDNN      \
@@ -810,6 +849,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         CONV4_VALID_FLIPPED_TEST_CASE_SECTION_DEFAULT    \
         CONV4_VALID_FLIPPED_TEST_CASE_SECTION_STD        \
         CONV4_VALID_FLIPPED_TEST_CASE_SECTION_BLAS_VEC   \
+        CONV4_VALID_FLIPPED_TEST_CASE_SECTION_WINOGRAD   \
         CONV4_VALID_FLIPPED_TEST_CASE_SECTION_BLAS_MKL   \
         CONV4_VALID_FLIPPED_TEST_CASE_SECTION_VEC        \
         CONV4_VALID_FLIPPED_TEST_CASE_SECTION_CUDNN      \
@@ -821,6 +861,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         DYN_CONV4_VALID_TEST_CASE_SECTION_DEFAULT    \
         DYN_CONV4_VALID_TEST_CASE_SECTION_STD        \
         DYN_CONV4_VALID_TEST_CASE_SECTION_BLAS_VEC   \
+        DYN_CONV4_VALID_TEST_CASE_SECTION_WINOGRAD   \
         DYN_CONV4_VALID_TEST_CASE_SECTION_BLAS_MKL   \
         DYN_CONV4_VALID_TEST_CASE_SECTION_VEC        \
         DYN_CONV4_VALID_TEST_CASE_SECTION_CUDNN      \
@@ -832,6 +873,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         DYN_CONV4_VALID_FLIPPED_TEST_CASE_SECTION_DEFAULT    \
         DYN_CONV4_VALID_FLIPPED_TEST_CASE_SECTION_STD        \
         DYN_CONV4_VALID_FLIPPED_TEST_CASE_SECTION_BLAS_VEC   \
+        DYN_CONV4_VALID_FLIPPED_TEST_CASE_SECTION_WINOGRAD   \
         DYN_CONV4_VALID_FLIPPED_TEST_CASE_SECTION_BLAS_MKL   \
         DYN_CONV4_VALID_FLIPPED_TEST_CASE_SECTION_VEC        \
         DYN_CONV4_VALID_FLIPPED_TEST_CASE_SECTION_CUDNN      \
@@ -843,6 +885,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         CONV4_VALID_BACK_TEST_CASE_SECTION_DEFAULT    \
         CONV4_VALID_BACK_TEST_CASE_SECTION_STD        \
         CONV4_VALID_BACK_TEST_CASE_SECTION_BLAS_VEC   \
+        CONV4_VALID_BACK_TEST_CASE_SECTION_WINOGRAD   \
         CONV4_VALID_BACK_TEST_CASE_SECTION_BLAS_MKL   \
         CONV4_VALID_BACK_TEST_CASE_SECTION_VEC        \
     }                                                 \
@@ -853,6 +896,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_DEFAULT    \
         CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_STD        \
         CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_BLAS_VEC   \
+        CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_WINOGRAD   \
         CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_BLAS_MKL   \
         CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_VEC        \
     }                                                         \
@@ -863,6 +907,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         DYN_CONV4_VALID_BACK_TEST_CASE_SECTION_DEFAULT    \
         DYN_CONV4_VALID_BACK_TEST_CASE_SECTION_STD        \
         DYN_CONV4_VALID_BACK_TEST_CASE_SECTION_BLAS_VEC   \
+        DYN_CONV4_VALID_BACK_TEST_CASE_SECTION_WINOGRAD   \
         DYN_CONV4_VALID_BACK_TEST_CASE_SECTION_BLAS_MKL   \
         DYN_CONV4_VALID_BACK_TEST_CASE_SECTION_VEC        \
     }                                                 \
@@ -873,6 +918,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         DYN_CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_DEFAULT    \
         DYN_CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_STD        \
         DYN_CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_BLAS_VEC   \
+        DYN_CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_WINOGRAD   \
         DYN_CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_BLAS_MKL   \
         DYN_CONV4_VALID_BACK_FLIPPED_TEST_CASE_SECTION_VEC        \
     }                                                         \
@@ -923,6 +969,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         CONV4_FULL_TEST_CASE_SECTION_DEFAULT    \
         CONV4_FULL_TEST_CASE_SECTION_STD        \
         CONV4_FULL_TEST_CASE_SECTION_VEC        \
+        CONV4_FULL_TEST_CASE_SECTION_WINOGRAD   \
         CONV4_FULL_TEST_CASE_SECTION_FFT_STD    \
         CONV4_FULL_TEST_CASE_SECTION_FFT_MKL    \
         CONV4_FULL_TEST_CASE_SECTION_FFT_CUFFT  \
@@ -935,6 +982,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         CONV4_FULL_FLIPPED_TEST_CASE_SECTION_DEFAULT    \
         CONV4_FULL_FLIPPED_TEST_CASE_SECTION_STD        \
         CONV4_FULL_FLIPPED_TEST_CASE_SECTION_VEC        \
+        CONV4_FULL_FLIPPED_TEST_CASE_SECTION_WINOGRAD   \
         CONV4_FULL_FLIPPED_TEST_CASE_SECTION_FFT_STD    \
         CONV4_FULL_FLIPPED_TEST_CASE_SECTION_FFT_MKL    \
         CONV4_FULL_FLIPPED_TEST_CASE_SECTION_FFT_CUFFT  \
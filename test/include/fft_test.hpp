@@ -5,6 +5,14 @@
 //  http://opensource.org/licenses/MIT)
 //=======================================================================
 
+#ifdef ETL_VECTORIZE_IMPL
+#ifdef __AVX__
+#define TEST_VEC
+#elif defined(__SSE3__)
+#define TEST_VEC
+#endif
+#endif
+
 #define FFT_FUNCTOR(name, ...)            \
     struct name {                         \
         template <typename A, typename C> \
@@ -73,6 +81,40 @@ FFT_FUNCTOR(std_ifft2_many, c = selected_helper(etl::fft_impl::STD, etl::ifft_2d
 #define IFFT2_REAL_TEST_CASE_SECTION_DEFAULT FFT_TEST_CASE_SECTIONS(default_ifft2_real)
 #define IFFT2_REAL_TEST_CASE_SECTION_STD FFT_TEST_CASE_SECTIONS(std_ifft2_real)
 
+#ifdef TEST_VEC
+FFT_FUNCTOR(vec_fft1, c = selected_helper(etl::fft_impl::VEC, etl::fft_1d(a)))
+FFT_FUNCTOR(vec_fft1_many, c = selected_helper(etl::fft_impl::VEC, etl::fft_1d_many(a)))
+FFT_FUNCTOR(vec_ifft1_many, c = selected_helper(etl::fft_impl::VEC, etl::ifft_1d_many(a)))
+FFT_FUNCTOR(vec_ifft1, c = selected_helper(etl::fft_impl::VEC, etl::ifft_1d(a)))
+FFT_FUNCTOR(vec_ifft1_real, c = selected_helper(etl::fft_impl::VEC, etl::ifft_1d_real(a)))
+FFT_FUNCTOR(vec_fft2, c = selected_helper(etl::fft_impl::VEC, etl::fft_2d(a)))
+FFT_FUNCTOR(vec_ifft2, c = selected_helper(etl::fft_impl::VEC, etl::ifft_2d(a)))
+FFT_FUNCTOR(vec_ifft2_real, c = selected_helper(etl::fft_impl::VEC, etl::ifft_2d_real(a)))
+FFT_FUNCTOR(vec_fft2_many, c = selected_helper(etl::fft_impl::VEC, etl::fft_2d_many(a)))
+FFT_FUNCTOR(vec_ifft2_many, c = selected_helper(etl::fft_impl::VEC, etl::ifft_2d_many(a)))
+#define FFT1_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_fft1)
+#define FFT1_MANY_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_fft1_many)
+#define IFFT1_MANY_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_ifft1_many)
+#define IFFT1_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_ifft1)
+#define IFFT1_REAL_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_ifft1_real)
+#define FFT2_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_fft2)
+#define IFFT2_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_ifft2)
+#define IFFT2_REAL_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_ifft2_real)
+#define FFT2_MANY_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_fft2_many)
+#define IFFT2_MANY_TEST_CASE_SECTION_VEC FFT_TEST_CASE_SECTIONS(vec_ifft2_many)
+#else
+#define FFT1_TEST_CASE_SECTION_VEC
+#define FFT1_MANY_TEST_CASE_SECTION_VEC
+#define IFFT1_MANY_TEST_CASE_SECTION_VEC
+#define IFFT1_TEST_CASE_SECTION_VEC
+#define IFFT1_REAL_TEST_CASE_SECTION_VEC
+#define FFT2_TEST_CASE_SECTION_VEC
+#define IFFT2_TEST_CASE_SECTION_VEC
+#define IFFT2_REAL_TEST_CASE_SECTION_VEC
+#define FFT2_MANY_TEST_CASE_SECTION_VEC
+#define IFFT2_MANY_TEST_CASE_SECTION_VEC
+#endif
+
 #ifdef ETL_MKL_MODE
 FFT_FUNCTOR(mkl_fft1, c = selected_helper(etl::fft_impl::MKL, etl::fft_1d(a)))
 FFT_FUNCTOR(mkl_fft1_many, c = selected_helper(etl::fft_impl::MKL, etl::fft_1d_many(a)))
@@ -163,6 +205,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) { \
         FFT1_TEST_CASE_SECTION_DEFAULT      \
         FFT1_TEST_CASE_SECTION_STD          \
+        FFT1_TEST_CASE_SECTION_VEC          \
         FFT1_TEST_CASE_SECTION_MKL          \
         FFT1_TEST_CASE_SECTION_CUFFT        \
     }                                       \
@@ -172,6 +215,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) {    \
         FFT1_MANY_TEST_CASE_SECTION_DEFAULT    \
         FFT1_MANY_TEST_CASE_SECTION_STD        \
+        FFT1_MANY_TEST_CASE_SECTION_VEC        \
         FFT1_MANY_TEST_CASE_SECTION_MKL        \
         FFT1_MANY_TEST_CASE_SECTION_CUFFT      \
     }                                          \
@@ -181,6 +225,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) {     \
         IFFT1_MANY_TEST_CASE_SECTION_DEFAULT    \
         IFFT1_MANY_TEST_CASE_SECTION_STD        \
+        IFFT1_MANY_TEST_CASE_SECTION_VEC        \
         IFFT1_MANY_TEST_CASE_SECTION_MKL        \
         IFFT1_MANY_TEST_CASE_SECTION_CUFFT      \
     }                                           \
@@ -190,6 +235,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) { \
         IFFT1_TEST_CASE_SECTION_DEFAULT     \
         IFFT1_TEST_CASE_SECTION_STD         \
+        IFFT1_TEST_CASE_SECTION_VEC         \
         IFFT1_TEST_CASE_SECTION_MKL         \
         IFFT1_TEST_CASE_SECTION_CUFFT       \
     }                                       \
@@ -199,6 +245,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) {     \
         IFFT1_REAL_TEST_CASE_SECTION_DEFAULT    \
         IFFT1_REAL_TEST_CASE_SECTION_STD        \
+        IFFT1_REAL_TEST_CASE_SECTION_VEC        \
         IFFT1_REAL_TEST_CASE_SECTION_MKL        \
         IFFT1_REAL_TEST_CASE_SECTION_CUFFT      \
     }                                           \
@@ -208,6 +255,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) { \
         FFT2_TEST_CASE_SECTION_DEFAULT      \
         FFT2_TEST_CASE_SECTION_STD          \
+        FFT2_TEST_CASE_SECTION_VEC          \
         FFT2_TEST_CASE_SECTION_MKL          \
         FFT2_TEST_CASE_SECTION_CUFFT        \
     }                                       \
@@ -217,6 +265,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) {    \
         FFT2_MANY_TEST_CASE_SECTION_DEFAULT    \
         FFT2_MANY_TEST_CASE_SECTION_STD        \
+        FFT2_MANY_TEST_CASE_SECTION_VEC        \
         FFT2_MANY_TEST_CASE_SECTION_MKL        \
         FFT2_MANY_TEST_CASE_SECTION_CUFFT      \
     }                                          \
@@ -226,6 +275,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) {     \
         IFFT2_MANY_TEST_CASE_SECTION_DEFAULT    \
         IFFT2_MANY_TEST_CASE_SECTION_STD        \
+        IFFT2_MANY_TEST_CASE_SECTION_VEC        \
         IFFT2_MANY_TEST_CASE_SECTION_MKL        \
         IFFT2_MANY_TEST_CASE_SECTION_CUFFT      \
     }                                           \
@@ -235,6 +285,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) { \
         IFFT2_TEST_CASE_SECTION_DEFAULT     \
         IFFT2_TEST_CASE_SECTION_STD         \
+        IFFT2_TEST_CASE_SECTION_VEC         \
         IFFT2_TEST_CASE_SECTION_MKL         \
         IFFT2_TEST_CASE_SECTION_CUFFT       \
     }                                       \
@@ -244,6 +295,7 @@ FFT_FUNCTOR(cufft_ifft2_many, c = selected_helper(etl::fft_impl::CUFFT, etl::iff
     FFT_TEST_CASE_DECL(name, description) {     \
         IFFT2_REAL_TEST_CASE_SECTION_DEFAULT    \
         IFFT2_REAL_TEST_CASE_SECTION_STD        \
+        IFFT2_REAL_TEST_CASE_SECTION_VEC        \
         IFFT2_REAL_TEST_CASE_SECTION_MKL        \
         IFFT2_REAL_TEST_CASE_SECTION_CUFFT      \
     }                                           \
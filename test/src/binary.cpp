@@ -105,7 +105,54 @@ TEMPLATE_TEST_CASE_2("pow/3", "[fast][pow]", Z, float, double) {
     REQUIRE_EQUALS_APPROX(d[7], Z(1.0) / Z(36.0));
 }
 
-TEMPLATE_TEST_CASE_2("pow_int/0", "[fast][pow_int]", Z, float, double) {
+TEMPLATE_TEST_CASE_2("pow/4", "[fast][pow]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 4> a = {-3.0, -2.0, 0.0, 1.0, -1.0, 4.0, -5.0, 0.5};
+    etl::fast_matrix<Z, 2, 4> d;
+
+    d = pow(a, 2.0);
+
+    REQUIRE_EQUALS_APPROX(d[0], Z(9.0));
+    REQUIRE_EQUALS_APPROX(d[1], Z(4.0));
+    REQUIRE_EQUALS_APPROX(d[2], Z(0.0));
+    REQUIRE_EQUALS_APPROX(d[3], Z(1.0));
+    REQUIRE_EQUALS_APPROX(d[4], Z(1.0));
+    REQUIRE_EQUALS_APPROX(d[5], Z(16.0));
+    REQUIRE_EQUALS_APPROX(d[6], Z(25.0));
+    REQUIRE_EQUALS_APPROX(d[7], Z(0.25));
+}
+
+TEMPLATE_TEST_CASE_2("pow/5", "[fast][pow]", Z, float, double) {
+    etl::dyn_vector<Z> a(17);
+    etl::dyn_vector<Z> d(17);
+
+    for (size_t i = 0; i < 17; ++i) {
+        a[i] = Z(i) - Z(8);
+    }
+
+    d = pow(a, 3.0);
+
+    for (size_t i = 0; i < 17; ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], std::pow(a[i], Z(3)));
+    }
+
+    d = pow(a, 0.5);
+
+    for (size_t i = 0; i < 17; ++i) {
+        if (a[i] < Z(0)) {
+            REQUIRE_DIRECT(std::isnan(d[i]));
+        } else {
+            REQUIRE_EQUALS_APPROX(d[i], std::sqrt(a[i]));
+        }
+    }
+
+    d = pow(a, 0.0);
+
+    for (size_t i = 0; i < 17; ++i) {
+        REQUIRE_EQUALS(d[i], Z(1));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("pow_int/0","[fast][pow_int]", Z, float, double) {
     etl::fast_matrix<Z, 2, 4> a = {-1.0, 2.0, 0.0, 1.0, 2.0, 4.0, 5.0, 6.0};
     etl::fast_matrix<Z, 2, 4> d;
 
@@ -147,3 +147,31 @@ CONV4_FULL_FLIPPED_TEST_CASE("conv/4d/full/flipped/2", "[conv][conv4][full]") {
         REQUIRE_EQUALS_APPROX(c[i], ref[i]);
     }
 }
+
+CONV4_FULL_TEST_CASE("conv/4d/full/4", "[conv][conv4][full]") {
+    etl::fast_matrix<T, 3, 5, 11, 11> I;
+    etl::fast_matrix<T, 5, 4, 3, 3> K;
+
+    I = etl::sequence_generator(-2.0) * 0.1;
+    K = etl::sequence_generator(1.3) * 0.6;
+
+    etl::fast_matrix<T, 3, 4, 13, 13> ref;
+    etl::fast_matrix<T, 3, 4, 13, 13> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t c = 0; c < etl::dim<1>(K); ++c) {
+                for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+                    ref(i)(c) += conv_2d_full(I(i)(k), K(k)(c));
+                }
+            }
+        }
+    }
+
+    Impl::apply(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
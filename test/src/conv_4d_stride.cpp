@@ -150,6 +150,90 @@ DYN_CONV4_VALID_TEST_CASE("conv/4d/stride/valid/5", "[conv][conv4][valid]") {
     }
 }
 
+CONV4_VALID_TEST_CASE("conv/4d/stride/valid/6", "[conv][conv4][valid]") {
+    etl::fast_matrix<T, 3, 3, 10, 11> I;
+    etl::fast_matrix<T, 4, 3, 3, 3> K;
+
+    I = etl::sequence_generator(10.0) * 4.0;
+    K = etl::sequence_generator(2.0) * 0.3;
+
+    etl::fast_matrix<T, 3, 4, 5, 4> ref;
+    etl::fast_matrix<T, 3, 4, 5, 4> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t c = 0; c < etl::dim<1>(K); ++c) {
+                for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+                    ref(i)(k) += etl::conv_2d_valid<2, 3, 1, 1>(I(i)(c), K(k)(c));
+                }
+            }
+        }
+    }
+
+    Impl::template apply<2, 3, 1, 1>(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
+    }
+}
+
+CONV4_VALID_TEST_CASE("conv/4d/stride/valid/7", "[conv][conv4][valid]") {
+    etl::fast_matrix<T, 2, 3, 7, 8> I;
+    etl::fast_matrix<T, 4, 3, 5, 5> K;
+
+    I = etl::sequence_generator(10.0) * 4.0;
+    K = etl::sequence_generator(2.0) * 0.3;
+
+    etl::fast_matrix<T, 2, 4, 4, 4> ref;
+    etl::fast_matrix<T, 2, 4, 4, 4> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t c = 0; c < etl::dim<1>(K); ++c) {
+                for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+                    ref(i)(k) += etl::conv_2d_valid<2, 2, 2, 2>(I(i)(c), K(k)(c));
+                }
+            }
+        }
+    }
+
+    Impl::template apply<2, 2, 2, 2>(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
+    }
+}
+
+CONV4_VALID_TEST_CASE("conv/4d/stride/valid/8", "[conv][conv4][valid]") {
+    etl::fast_matrix<T, 2, 3, 9, 10> I;
+    etl::fast_matrix<T, 4, 3, 8, 8> K;
+
+    I = etl::sequence_generator(10.0) * 0.4;
+    K = etl::sequence_generator(2.0) * 0.03;
+
+    etl::fast_matrix<T, 2, 4, 6, 7> ref;
+    etl::fast_matrix<T, 2, 4, 6, 7> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t c = 0; c < etl::dim<1>(K); ++c) {
+                for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+                    ref(i)(k) += etl::conv_2d_valid<1, 1, 2, 2>(I(i)(c), K(k)(c));
+                }
+            }
+        }
+    }
+
+    Impl::template apply<1, 1, 2, 2>(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
+    }
+}
+
 // conv_4d_valid_flipped
 
 CONV4_VALID_FLIPPED_TEST_CASE("conv/4d/stride/valid/flipped/1", "[conv][conv4][valid]") {
@@ -264,6 +348,34 @@ CONV4_VALID_FLIPPED_TEST_CASE("conv/4d/stride/valid/flipped/4", "[conv][conv4][v
     }
 }
 
+CONV4_VALID_FLIPPED_TEST_CASE("conv/4d/stride/valid/flipped/5", "[conv][conv4][valid]") {
+    etl::fast_matrix<T, 2, 3, 9, 10> I;
+    etl::fast_matrix<T, 4, 3, 8, 8> K;
+
+    I = etl::sequence_generator(10.0) * 0.4;
+    K = etl::sequence_generator(2.0) * 0.03;
+
+    etl::fast_matrix<T, 2, 4, 6, 7> ref;
+    etl::fast_matrix<T, 2, 4, 6, 7> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t c = 0; c < etl::dim<1>(K); ++c) {
+                for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+                    ref(i)(k) += etl::conv_2d_valid_flipped<1, 1, 2, 2>(I(i)(c), K(k)(c));
+                }
+            }
+        }
+    }
+
+    Impl::template apply<1, 1, 2, 2>(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
+    }
+}
+
 // conv_4d_valid_filter
 
 CONV4_VALID_FILTER_TEST_CASE("conv/4d/stride/valid/filter/1", "[conv][conv4][valid]") {
@@ -294,6 +406,34 @@ CONV4_VALID_FILTER_TEST_CASE("conv/4d/stride/valid/filter/1", "[conv][conv4][val
     }
 }
 
+CONV4_VALID_FILTER_TEST_CASE("conv/4d/stride/valid/filter/2", "[conv][conv4][valid]") {
+    etl::fast_matrix<T, 3, 2, 9, 10> I;
+    etl::fast_matrix<T, 3, 4, 8, 8> K;
+
+    I = etl::sequence_generator(3.0) * 0.04;
+    K = etl::sequence_generator(2.0) * 0.03;
+
+    etl::fast_matrix<T, 4, 2, 6, 7> ref;
+    etl::fast_matrix<T, 4, 2, 6, 7> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t k = 0; k < etl::dim<1>(K); ++k) {
+                for (size_t c = 0; c < etl::dim<1>(I); ++c) {
+                    ref(k)(c) += etl::conv_2d_valid<1, 1, 2, 2>(I(i)(c), K(i)(k));
+                }
+            }
+        }
+    }
+
+    Impl::template apply<1, 1, 2, 2>(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
+    }
+}
+
 // conv_4d_valid_filter_flipped
 
 CONV4_VALID_FILTER_FLIPPED_TEST_CASE("conv/4d/stride/valid/filter/flipped/1", "[conv][conv4][valid]") {
@@ -323,3 +463,31 @@ CONV4_VALID_FILTER_FLIPPED_TEST_CASE("conv/4d/stride/valid/filter/flipped/1", "[
         REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
     }
 }
+
+CONV4_VALID_FILTER_FLIPPED_TEST_CASE("conv/4d/stride/valid/filter/flipped/2", "[conv][conv4][valid]") {
+    etl::fast_matrix<T, 3, 2, 9, 10> I;
+    etl::fast_matrix<T, 3, 4, 8, 8> K;
+
+    I = etl::sequence_generator(3.0) * 0.04;
+    K = etl::sequence_generator(2.0) * 0.03;
+
+    etl::fast_matrix<T, 4, 2, 6, 7> ref;
+    etl::fast_matrix<T, 4, 2, 6, 7> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t k = 0; k < etl::dim<1>(K); ++k) {
+                for (size_t c = 0; c < etl::dim<1>(I); ++c) {
+                    ref(k)(c) += etl::conv_2d_valid_flipped<1, 1, 2, 2>(I(i)(c), K(i)(k));
+                }
+            }
+        }
+    }
+
+    Impl::template apply<1, 1, 2, 2>(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
+    }
+}
@@ -175,3 +175,208 @@ CONV4_VALID_FLIPPED_TEST_CASE("conv_4d/valid_6", "[conv][conv4][valid]") {
         REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
     }
 }
+
+CONV4_VALID_TEST_CASE("conv_4d/valid_7", "[conv][conv4][valid]") {
+    etl::fast_matrix<T, 3, 6, 14, 14> I;
+    etl::fast_matrix<T, 5, 6, 3, 3> K;
+
+    I = etl::sequence_generator(-10.0) * 0.04;
+    K = etl::sequence_generator(-2.0) * 0.56;
+
+    etl::fast_matrix<T, 3, 5, 14, 14> ref;
+    etl::fast_matrix<T, 3, 5, 14, 14> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t c = 0; c < etl::dim<1>(K); ++c) {
+                for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+                    ref(i)(k) += etl::conv_2d_valid<1, 1, 1, 1>(I(i)(c), K(k)(c));
+                }
+            }
+        }
+    }
+
+    Impl::template apply<1, 1, 1, 1>(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
+    }
+}
+
+CONV4_VALID_TEST_CASE("conv_4d/valid_8", "[conv][conv4][valid]") {
+    etl::fast_matrix<T, 11, 3, 6, 6> I;
+    etl::fast_matrix<T, 4, 3, 3, 3> K;
+
+    I = etl::sequence_generator(-10.0) * 0.04;
+    K = etl::sequence_generator(-2.0) * 0.56;
+
+    etl::fast_matrix<T, 11, 4, 4, 4> ref;
+    etl::fast_matrix<T, 11, 4, 4, 4> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t c = 0; c < etl::dim<1>(K); ++c) {
+                for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+                    ref(i)(k) += conv_2d_valid(I(i)(c), K(k)(c));
+                }
+            }
+        }
+    }
+
+    Impl::apply(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/valid/select/winograd", "[conv][conv4][valid]", Z, float, double) {
+    using I = etl::dyn_matrix<Z, 4>;
+
+    constexpr size_t C = etl::winograd_min_channels;
+
+    // Winograd is only implemented for unit strides
+    auto unit    = etl::detail::select_default_conv4_valid_impl<I, I, I>(true, C, C, 32, 32, 3, 3, 1, 1);
+    auto strided = etl::detail::select_default_conv4_valid_impl<I, I, I>(true, C, C, 32, 32, 3, 3, 2, 2);
+
+    auto back_unit    = etl::detail::select_default_conv4_valid_back_impl<I, I, I>(C, C, 32, 32, 3, 3, 1, 1);
+    auto back_strided = etl::detail::select_default_conv4_valid_back_impl<I, I, I>(C, C, 32, 32, 3, 3, 2, 2);
+
+    REQUIRE_DIRECT(strided != etl::conv4_impl::WINOGRAD);
+    REQUIRE_DIRECT(back_strided != etl::conv4_impl::WINOGRAD);
+
+    if (etl::impl::vec::winograd_possible<I, I, I>) {
+        REQUIRE_DIRECT(unit == etl::conv4_impl::WINOGRAD);
+        REQUIRE_DIRECT(back_unit == etl::conv4_impl::WINOGRAD);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/valid/packed/1", "[conv][conv4][valid][packed]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> I(3, 6, 15, 14);
+    etl::dyn_matrix<Z, 4> K(5, 6, 3, 3);
+
+    I = etl::sequence_generator(10.0) * 0.04;
+    K = etl::sequence_generator(-2.0) * 0.3;
+
+    etl::packed_conv_filter<Z> filter(K);
+
+    etl::dyn_matrix<Z, 4> ref(3, 5, 15, 14);
+    etl::dyn_matrix<Z, 4> c(3, 5, 15, 14);
+    etl::dyn_matrix<Z, 4> ref_s(3, 5, 13, 12);
+    etl::dyn_matrix<Z, 4> c_s(3, 5, 13, 12);
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        ref   = etl::conv_4d_valid<1, 1, 1, 1>(I, K);
+        ref_s = etl::conv_4d_valid(I, K, 1, 1, 0, 0);
+    }
+
+    constexpr bool winograd = etl::impl::vec::winograd_possible<etl::dyn_matrix<Z, 4>, etl::dyn_matrix<Z, 4>, etl::dyn_matrix<Z, 4>>;
+
+    REQUIRE_DIRECT(filter.has_winograd_kernels() == winograd);
+
+    etl::conv_4d_valid<1, 1, 1, 1>(I, filter, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    etl::conv_4d_valid(I, filter, c_s, 1, 1, 0, 0);
+
+    for (size_t i = 0; i < ref_s.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c_s[i], ref_s[i]);
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::WINOGRAD) {
+        c = 0;
+        etl::conv_4d_valid<1, 1, 1, 1>(I, filter, c);
+
+        for (size_t i = 0; i < ref.size(); ++i) {
+            REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+        }
+
+        c_s = 0;
+        etl::conv_4d_valid(I, filter, c_s, 1, 1, 0, 0);
+
+        for (size_t i = 0; i < ref_s.size(); ++i) {
+            REQUIRE_EQUALS_APPROX(c_s[i], ref_s[i]);
+        }
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::BLAS_VEC) {
+        c = 0;
+        etl::conv_4d_valid<1, 1, 1, 1>(I, filter, c);
+
+        for (size_t i = 0; i < ref.size(); ++i) {
+            REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+        }
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::VEC) {
+        c = 0;
+        etl::conv_4d_valid<1, 1, 1, 1>(I, filter, c);
+
+        for (size_t i = 0; i < ref.size(); ++i) {
+            REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/valid/packed/2", "[conv][conv4][valid][packed]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> I(2, 5, 9, 8);
+    etl::dyn_matrix<Z, 4> K(4, 5, 3, 3);
+
+    I = etl::sequence_generator(3.0) * 0.05;
+    K = etl::sequence_generator(1.0) * 0.2;
+
+    etl::packed_conv_filter<Z> filter(K);
+
+    etl::dyn_matrix<Z, 4> ref(2, 4, 7, 6);
+    etl::dyn_matrix<Z, 4> c(2, 4, 7, 6);
+
+    // Small outputs, with the small Winograd tiles
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        ref = etl::conv_4d_valid<1, 1, 0, 0>(I, K);
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::WINOGRAD) {
+        etl::conv_4d_valid<1, 1, 0, 0>(I, filter, c);
+    }
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    // Strided convolutions do not use the transformed kernels
+    etl::dyn_matrix<Z, 4> ref_s(2, 4, 5, 4);
+    etl::dyn_matrix<Z, 4> c_s(2, 4, 5, 4);
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        ref_s = etl::conv_4d_valid<2, 2, 1, 1>(I, K);
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::WINOGRAD) {
+        etl::conv_4d_valid<2, 2, 1, 1>(I, filter, c_s);
+    }
+
+    for (size_t i = 0; i < ref_s.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c_s[i], ref_s[i]);
+    }
+
+    // The filter is packed again after the kernels are modified
+    K = etl::sequence_generator(-4.0) * 0.1;
+    filter.pack(K);
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        ref = etl::conv_4d_valid<1, 1, 0, 0>(I, K);
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::WINOGRAD) {
+        etl::conv_4d_valid<1, 1, 0, 0>(I, filter, c);
+    }
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
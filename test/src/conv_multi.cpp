@@ -733,3 +733,43 @@ TEST_CASE("conv2/full/multi/mixed/1", "[conv][conv2][conv_multi]") {
         REQUIRE_EQUALS_APPROX(c_2[i], c_1[i]);
     }
 }
+
+TEMPLATE_TEST_CASE_2("conv2/valid/multi/packed/1", "[conv][conv2][conv_multi][packed]", Z, float, double) {
+    etl::dyn_matrix<Z, 2> I(11, 9);
+    etl::dyn_matrix<Z, 3> K(4, 3, 5);
+
+    I = etl::sequence_generator(2.0) * 0.5;
+    K = etl::sequence_generator(-3.0) * 0.25;
+
+    etl::packed_conv_filter<Z, 3> filter(K);
+
+    etl::dyn_matrix<Z, 3> ref(4, 9, 5);
+    etl::dyn_matrix<Z, 3> c(4, 9, 5);
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+            ref(k) = etl::conv_2d_valid(I, K(k));
+        }
+    }
+
+    etl::conv_2d_valid_multi(I, filter, c);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    etl::dyn_matrix<Z, 3> ref_s(4, 6, 5);
+    etl::dyn_matrix<Z, 3> c_s(4, 6, 5);
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+            ref_s(k) = etl::conv_2d_valid(I, K(k), 2, 1, 1, 0);
+        }
+    }
+
+    etl::conv_2d_valid_multi(I, filter, c_s, 2, 1, 1, 0);
+
+    for (size_t i = 0; i < etl::size(ref_s); ++i) {
+        REQUIRE_EQUALS_APPROX(c_s[i], ref_s[i]);
+    }
+}
@@ -99,3 +99,22 @@ DOT_TEST_CASE("dot/8", "[dot]") {
 
     REQUIRE_EQUALS_APPROX(value, 70331.7876);
 }
+
+DOT_TEST_CASE("dot/9", "[dot]") {
+    etl::dyn_vector<T> a(10007);
+    etl::dyn_vector<T> b(10007);
+
+    double expected = 0.0;
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(0.001) * T(i % 1013);
+        b[i] = T(0.002) * T(i % 997);
+
+        expected += double(a[i]) * double(b[i]);
+    }
+
+    T value = 0;
+    Impl::apply(a, b, value);
+
+    REQUIRE_EQUALS_APPROX_E(value, expected, 0.001);
+}
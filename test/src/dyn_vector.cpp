@@ -612,6 +612,133 @@ TEMPLATE_TEST_CASE_2("dyn_vector/norm_1", "[dyn][reduc][norm]", Z, double, float
     REQUIRE_EQUALS_APPROX(d, 8.30662);
 }
 
+TEMPLATE_TEST_CASE_2("dyn_vector/norm_2", "[dyn][reduc][norm]", Z, double, float) {
+    etl::dyn_vector<Z> a(10007);
+
+    double expected = 0.0;
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = Z(0.01) * Z(int(i % 101) - 50);
+
+        expected += double(a[i]) * double(a[i]);
+    }
+
+    REQUIRE_EQUALS_APPROX_E(norm(a), std::sqrt(expected), 0.001);
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/norm_3", "[dyn][reduc][norm]", Z, double, float) {
+    const Z big   = std::numeric_limits<Z>::max() / Z(4);
+    const Z small = std::numeric_limits<Z>::min() * Z(4);
+
+    etl::dyn_vector<Z> a{Z(3) * big / Z(5), Z(-4) * big / Z(5), Z(0)};
+    etl::dyn_vector<Z> b{Z(-3) * small, Z(4) * small, Z(0)};
+
+    REQUIRE_EQUALS_APPROX(norm(a) / big, Z(1));
+    REQUIRE_EQUALS_APPROX(norm(b) / small, Z(5));
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/max_index_1", "[dyn][reduc][max]", Z, double, float) {
+    etl::dyn_vector<Z> a(1037);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 37) % 1000) * Z(0.5) - Z(100.0);
+    }
+
+    size_t max_ref = 0;
+    size_t min_ref = 0;
+
+    for (size_t i = 1; i < etl::size(a); ++i) {
+        if (a[i] > a[max_ref]) {
+            max_ref = i;
+        }
+
+        if (a[i] < a[min_ref]) {
+            min_ref = i;
+        }
+    }
+
+    REQUIRE_EQUALS(etl::max_index(a), max_ref);
+    REQUIRE_EQUALS(etl::min_index(a), min_ref);
+    REQUIRE_EQUALS(etl::max(a), a[max_ref]);
+    REQUIRE_EQUALS(etl::min(a), a[min_ref]);
+    REQUIRE_EQUALS(etl::max_index(a + a), max_ref);
+    REQUIRE_EQUALS(etl::min_index(a + a), min_ref);
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/max_index_2", "[dyn][reduc][max]", Z, double, float) {
+    etl::dyn_vector<Z> a(555);
+
+    a = Z(1.0);
+
+    a[123] = Z(3.0);
+    a[321] = Z(3.0);
+    a[200] = Z(-2.0);
+    a[500] = Z(-2.0);
+
+    REQUIRE_EQUALS(etl::max_index(a), 123UL);
+    REQUIRE_EQUALS(etl::min_index(a), 200UL);
+
+    a = Z(1.0);
+
+    REQUIRE_EQUALS(etl::max_index(a), 0UL);
+    REQUIRE_EQUALS(etl::min_index(a), 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/max_index_3", "[dyn][reduc][max]", Z, int, long) {
+    etl::dyn_vector<Z> a = {3, -1, 9, 2, 9, -1};
+
+    REQUIRE_EQUALS(etl::max_index(a), 2UL);
+    REQUIRE_EQUALS(etl::min_index(a), 1UL);
+    REQUIRE_EQUALS(etl::max(a), 9);
+    REQUIRE_EQUALS(etl::min(a), -1);
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/stddev_1", "[dyn][reduc][stddev]", Z, double, float) {
+    etl::dyn_vector<Z> a(1029);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 13) % 101) * Z(0.1);
+    }
+
+    double mean = 0.0;
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        mean += a[i];
+    }
+
+    mean /= etl::size(a);
+
+    double var = 0.0;
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        var += (a[i] - mean) * (a[i] - mean);
+    }
+
+    var /= etl::size(a);
+
+    REQUIRE_EQUALS_APPROX(etl::variance(a), Z(var));
+    REQUIRE_EQUALS_APPROX(etl::stddev(a), Z(std::sqrt(var)));
+    REQUIRE_EQUALS_APPROX(etl::stddev(a + a), Z(2.0 * std::sqrt(var)));
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/stddev_2", "[dyn][reduc][stddev]", Z, double, float) {
+    // Large offset, a two-moments formula loses all precision here
+    etl::dyn_vector<Z> a(1000);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(10000.0) + (i % 2 ? Z(1.0) : Z(-1.0));
+    }
+
+    REQUIRE_EQUALS_APPROX_E(etl::stddev(a), Z(1.0), 0.001);
+    REQUIRE_EQUALS_APPROX_E(etl::variance(a), Z(1.0), 0.001);
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/stddev_3", "[dyn][reduc][stddev]", Z, int, long) {
+    etl::dyn_vector<Z> a = {2, 4, 4, 4, 5, 5, 7, 9};
+
+    REQUIRE_EQUALS(etl::stddev(a), 2);
+}
+
 // Complex tests
 
 TEMPLATE_TEST_CASE_2("dyn_vector/complex", "dyn_vector::complex", Z, double, float) {
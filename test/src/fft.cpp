@@ -331,6 +331,31 @@ FFT1_TEST_CASE("fft_1d/11", "[fast][fft]") {
     REQUIRE_EQUALS(c(6), ComplexApprox<T>(4.61047, 0.186805));
 }
 
+FFT1_TEST_CASE("fft_1d/12", "[fast][fft]") {
+    // Power of two sizes, going through all the combinations of radix
+    for (size_t n = 1; n <= 1024; n *= 2) {
+        etl::dyn_vector<std::complex<T>> a(n);
+        etl::dyn_vector<std::complex<T>> c(n);
+
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = std::complex<T>(T(i % 7) - T(3), T(i % 5) * T(0.5));
+        }
+
+        Impl::apply(a, c);
+
+        for (size_t k = 0; k < n; ++k) {
+            std::complex<double> ref(0.0, 0.0);
+
+            for (size_t i = 0; i < n; ++i) {
+                const double theta = -2.0 * M_PI * double((i * k) % n) / double(n);
+                ref += std::complex<double>(a[i].real(), a[i].imag()) * std::complex<double>(std::cos(theta), std::sin(theta));
+            }
+
+            REQUIRE_DIRECT(std::abs(std::complex<double>(c[k].real(), c[k].imag()) - ref) < 1e-3 * std::sqrt(double(n)));
+        }
+    }
+}
+
 /* fft_many tests */
 
 FFT1_MANY_TEST_CASE("fft_1d_many/1", "[fast][fft]") {
@@ -504,3 +529,89 @@ TEMPLATE_TEST_CASE_2("fft_1d_many/6", "[fast][fft]", Z, float, double) {
         REQUIRE_EQUALS(c_1[i], c_2[i]);
     }
 }
+
+TEMPLATE_TEST_CASE_2("fft_1d_many/7", "[fast][fft]", Z, float, double) {
+    // Enough different sizes to go through the whole cache of plans
+    for (size_t n = 2; n < 100; ++n) {
+        etl::dyn_matrix<std::complex<Z>> a(3, n);
+        etl::dyn_matrix<std::complex<Z>> c_1(3, n);
+        etl::dyn_matrix<std::complex<Z>> c_2(3, n);
+        etl::dyn_matrix<std::complex<Z>> d(3, n);
+
+        for (size_t i = 0; i < a.size(); ++i) {
+            a[i] = std::complex<Z>(Z(i % 7) - Z(3), Z(i % 5) * Z(0.5));
+        }
+
+        c_1 = etl::fft_1d_many(a);
+
+        for (size_t i = 0; i < 3; ++i) {
+            c_2(i) = etl::fft_1d(a(i));
+            d(i)   = etl::ifft_1d(c_2(i));
+        }
+
+        for (size_t i = 0; i < a.size(); ++i) {
+            REQUIRE_EQUALS_APPROX_E(c_1[i].real(), c_2[i].real(), 0.001);
+            REQUIRE_EQUALS_APPROX_E(c_1[i].imag(), c_2[i].imag(), 0.001);
+            REQUIRE_EQUALS_APPROX_E(d[i].real(), a[i].real(), 0.001);
+            REQUIRE_EQUALS_APPROX_E(d[i].imag(), a[i].imag(), 0.001);
+        }
+    }
+}
+
+//rfft_1d / irfft_1d
+
+TEMPLATE_TEST_CASE_2("rfft_1d/1", "[fast][fft]", Z, float, double) {
+    etl::fast_vector<Z, 8> a{1.0, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0};
+    etl::fast_vector<std::complex<Z>, 5> c;
+
+    c = etl::rfft_1d(a);
+
+    REQUIRE_EQUALS_APPROX(c(0).real(), Z(4.0));
+    REQUIRE_EQUALS_APPROX(c(0).imag(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(1).real(), Z(1.0));
+    REQUIRE_EQUALS_APPROX(c(1).imag(), Z(-2.41421));
+    REQUIRE_EQUALS_APPROX(c(2).real(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(2).imag(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(3).real(), Z(1.0));
+    REQUIRE_EQUALS_APPROX(c(3).imag(), Z(-0.41421));
+    REQUIRE_EQUALS_APPROX(c(4).real(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(4).imag(), Z(0.0));
+}
+
+TEMPLATE_TEST_CASE_2("rfft_1d/2", "[fast][fft]", Z, float, double) {
+    for (size_t n = 1; n < 50; ++n) {
+        etl::dyn_vector<Z> a(n);
+        etl::dyn_vector<std::complex<Z>> c_1(n / 2 + 1);
+        etl::dyn_vector<std::complex<Z>> c_2(n);
+        etl::dyn_vector<Z> d(n);
+
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = Z(i % 7) - Z(2.5);
+        }
+
+        etl::rfft_1d(a, c_1);
+        c_2 = etl::fft_1d(a);
+        etl::irfft_1d(c_1, d);
+
+        for (size_t i = 0; i < n / 2 + 1; ++i) {
+            REQUIRE_DIRECT(std::abs(c_1[i] - c_2[i]) < Z(0.001));
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            REQUIRE_EQUALS_APPROX_E(d[i], a[i], 0.001);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("irfft_1d/1", "[fast][fft]", Z, float, double) {
+    etl::fast_vector<Z, 8> a{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+    etl::fast_vector<std::complex<Z>, 5> c;
+    etl::fast_vector<Z, 8> d;
+
+    c = etl::rfft_1d(a);
+    d = etl::irfft_1d(c);
+
+    for (size_t i = 0; i < 8; ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], a[i]);
+    }
+}
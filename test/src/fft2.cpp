@@ -130,6 +130,35 @@ FFT2_TEST_CASE("fft_2d_c/4", "[fast][fft]") {
     REQUIRE_EQUALS_APPROX(a(2, 1).imag(), T(6.4192));
 }
 
+FFT2_TEST_CASE("fft_2d_c/5", "[fast][fft]") {
+    const size_t n1 = 16;
+    const size_t n2 = 37;
+
+    etl::dyn_matrix<std::complex<T>> a(n1, n2);
+    etl::dyn_matrix<std::complex<T>> c(n1, n2);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = std::complex<T>(T(i % 7) - T(2.5), T(i % 5) - T(1.5));
+    }
+
+    Impl::apply(a, c);
+
+    for (size_t u = 0; u < n1; ++u) {
+        for (size_t v = 0; v < n2; ++v) {
+            std::complex<double> ref(0.0, 0.0);
+
+            for (size_t i = 0; i < n1; ++i) {
+                for (size_t j = 0; j < n2; ++j) {
+                    const double angle = -2.0 * M_PI * (double((u * i) % n1) / n1 + double((v * j) % n2) / n2);
+                    ref += std::complex<double>(a(i, j).real(), a(i, j).imag()) * std::polar(1.0, angle);
+                }
+            }
+
+            REQUIRE_DIRECT(std::abs(std::complex<double>(c(u, v).real(), c(u, v).imag()) - ref) < 0.01);
+        }
+    }
+}
+
 //fft_2d_many
 
 FFT2_MANY_TEST_CASE("fft_2d_many/0", "[fast][fft]") {
@@ -183,6 +212,26 @@ FFT2_MANY_TEST_CASE("fft_2d_many/1", "[fast][fft]") {
     REQUIRE_EQUALS_APPROX(c(1, 1, 1).imag(), T(1.0));
 }
 
+FFT2_MANY_TEST_CASE("fft_2d_many/3", "[fast][fft]") {
+    etl::dyn_matrix<std::complex<T>, 3> a(3, 8, 21);
+    etl::dyn_matrix<std::complex<T>, 3> c(3, 8, 21);
+    etl::dyn_matrix<std::complex<T>> c_ref(8, 21);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = std::complex<T>(T(i % 9) - T(3.5), T(i % 4) - T(1.5));
+    }
+
+    Impl::apply(a, c);
+
+    for (size_t b = 0; b < 3; ++b) {
+        c_ref = etl::fft_2d(a(b));
+
+        for (size_t i = 0; i < c_ref.size(); ++i) {
+            REQUIRE_DIRECT(std::abs(c(b)[i] - c_ref[i]) < T(0.01));
+        }
+    }
+}
+
 // In place operations
 
 TEMPLATE_TEST_CASE_2("fft_2d_c/3", "[fast][fft]", Z, float, double) {
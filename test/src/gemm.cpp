@@ -238,3 +238,29 @@ TEMPLATE_TEST_CASE_2("gemm/12", "[gemm]", T, float, double) {
 
     REQUIRE_DIRECT(etl::approx_equals(c, r, base_eps_etl_large));
 }
+
+TEMPLATE_TEST_CASE_2("gemm/13", "[gemm][parallel]", T, float, double) {
+    etl::dyn_matrix<T> a(131, 1031);
+    etl::dyn_matrix<T> b(1031, 93);
+    etl::dyn_matrix<T> c(131, 93);
+    etl::dyn_matrix<T> r(131, 93);
+
+    a = 0.001 * etl::sequence_generator(1.0);
+    b = -0.0032 * etl::sequence_generator(1.0);
+
+    PARALLEL_SECTION {
+        c = a * b;
+    }
+
+    for (size_t i = 0; i < rows(a); i++) {
+        for (size_t j = 0; j < columns(b); j++) {
+            T t(0);
+            for (size_t k = 0; k < columns(a); k++) {
+                t += a(i, k) * b(k, j);
+            }
+            r(i,j) = t;
+        }
+    }
+
+    REQUIRE_DIRECT(etl::approx_equals(c, r, base_eps_etl_large));
+}
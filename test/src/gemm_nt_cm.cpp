@@ -192,3 +192,27 @@ GEMM_NT_TEST_CASE("gemm_nt/cm/9", "[gemm]") {
 
     REQUIRE_DIRECT(etl::approx_equals(c, r, base_eps_etl_large));
 }
+
+GEMM_NT_TEST_CASE("gemm_nt/cm/10", "[gemm]") {
+    etl::dyn_matrix_cm<T> a(77, 41);
+    etl::dyn_matrix_cm<T> b(59, 41);
+    etl::dyn_matrix_cm<T> c(77, 59);
+    etl::dyn_matrix_cm<T> r(77, 59);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(a, b, c);
+
+    for (size_t i = 0; i < rows(a); i++) {
+        for (size_t j = 0; j < rows(b); j++) {
+            T t(0);
+            for (size_t k = 0; k < columns(a); k++) {
+                t += a(i, k) * b(j, k);
+            }
+            r(i,j) = t;
+        }
+    }
+
+    REQUIRE_DIRECT(etl::approx_equals(c, r, base_eps_etl_large));
+}
@@ -192,3 +192,27 @@ GEMM_TN_TEST_CASE("gemm_tn/11", "[gemm]") {
 
     REQUIRE_DIRECT(etl::approx_equals(c, r, base_eps_etl_large));
 }
+
+GEMM_TN_TEST_CASE("gemm_tn/12", "[gemm]") {
+    etl::dyn_matrix<T> a(41, 77);
+    etl::dyn_matrix<T> b(41, 59);
+    etl::dyn_matrix<T> c(77, 59);
+    etl::dyn_matrix<T> r(77, 59);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(a, b, c);
+
+    r = 0;
+
+    for (size_t k = 0; k < rows(a); k++) {
+        for (size_t i = 0; i < columns(a); i++) {
+            for (size_t j = 0; j < columns(b); j++) {
+                r(i, j) += a(k, i) * b(k, j);
+            }
+        }
+    }
+
+    REQUIRE_DIRECT(etl::approx_equals(c, r, base_eps_etl_large));
+}
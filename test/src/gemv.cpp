@@ -131,6 +131,31 @@ GEMV_TEST_CASE("gemv/6", "[gemv]") {
     }
 }
 
+GEMV_TEST_CASE("gemv/8", "[gemv]") {
+    etl::dyn_matrix<T> a(257, 333);
+    etl::dyn_vector<T> b(333);
+
+    etl::dyn_vector<T> c(257);
+    etl::dyn_vector<T> c_ref(257);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(a, b, c);
+
+    c_ref = 0;
+
+    for (size_t i = 0; i < 257; i++) {
+        for (size_t k = 0; k < 333; k++) {
+            c_ref(i) += a(i, k) * b(k);
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
+    }
+}
+
 GEMV_T_TEST_CASE("gemv_t/1", "[gemv][gemv_t]") {
     etl::dyn_matrix<T> a(368, 512);
     etl::dyn_vector<T> b(368);
@@ -181,6 +206,31 @@ GEMV_T_TEST_CASE("gemv_t/2", "[gemv][gemv_t]") {
     }
 }
 
+GEMV_T_TEST_CASE("gemv_t/3", "[gemv][gemv_t]") {
+    etl::dyn_matrix<T> a(333, 257);
+    etl::dyn_vector<T> b(333);
+
+    etl::dyn_vector<T> c(257);
+    etl::dyn_vector<T> c_ref(257);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(a, b, c);
+
+    c_ref = 0;
+
+    for (size_t k = 0; k < 333; k++) {
+        for (size_t i = 0; i < 257; i++) {
+            c_ref(i) += a(k, i) * b(k);
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
+    }
+}
+
 TEMPLATE_TEST_CASE_2("gemv/7", "[gemv]", T, float, double) {
     etl::dyn_matrix<T> a(64, 64);
     etl::dyn_vector<T> b(64);
@@ -202,3 +202,98 @@ TEMPLATE_TEST_CASE_2("generators/uniform/2", "uniform", Z, float, double) {
         REQUIRE_DIRECT(value <= 8.0);
     }
 }
+
+TEMPLATE_TEST_CASE_2("generators/uniform/3", "uniform", Z, float, double) {
+    etl::dyn_vector<Z> a(1000);
+    etl::dyn_vector<Z> b(1000);
+
+    auto g = etl::uniform_generator(Z(-1.0), Z(1.0));
+
+    // The values only depend on the key and the index
+    a = g;
+    b = g;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        REQUIRE_EQUALS(a[i], b[i]);
+        REQUIRE_DIRECT(a[i] >= -1.0);
+        REQUIRE_DIRECT(a[i] <= 1.0);
+    }
+
+    REQUIRE_DIRECT(std::abs(etl::mean(a)) < 0.1);
+}
+
+TEMPLATE_TEST_CASE_2("generators/uniform/4", "uniform", Z, int, long) {
+    etl::dyn_vector<Z> a(1000);
+
+    a = etl::uniform_generator(Z(2), Z(5));
+
+    bool seen[4] = {false, false, false, false};
+
+    for (auto value : a) {
+        REQUIRE_DIRECT(value >= 2);
+        REQUIRE_DIRECT(value <= 5);
+
+        seen[value - 2] = true;
+    }
+
+    REQUIRE_DIRECT((seen[0] && seen[1] && seen[2] && seen[3]));
+}
+
+TEMPLATE_TEST_CASE_2("normal/dyn_vector_2", "generator", Z, float, double) {
+    etl::dyn_vector<Z> a(10000);
+
+    a = etl::normal_generator(Z(1.0), Z(2.0));
+
+    REQUIRE_DIRECT(std::abs(etl::mean(a) - 1.0) < 0.1);
+    REQUIRE_DIRECT(std::abs(etl::stddev(a) - 2.0) < 0.1);
+}
+
+TEMPLATE_TEST_CASE_2("truncated_normal/dyn_vector_2", "generator", Z, float, double) {
+    etl::dyn_vector<Z> a(1000);
+
+    a = etl::truncated_normal_generator(Z(1.0), Z(2.0));
+
+    for (auto value : a) {
+        REQUIRE_DIRECT(value >= -3.0);
+        REQUIRE_DIRECT(value <= 5.0);
+    }
+}
+
+/// counter-based generator
+
+TEST_CASE("random/philox/1", "[random]") {
+    // Known answers of the Philox4x32-10 reference implementation
+    auto b1 = etl::philox4x32::block(0, 0);
+
+    REQUIRE_EQUALS(b1[0], 0x6627e8d5U);
+    REQUIRE_EQUALS(b1[1], 0xe169c58dU);
+    REQUIRE_EQUALS(b1[2], 0xbc57ac4cU);
+    REQUIRE_EQUALS(b1[3], 0x9b00dbd8U);
+
+    auto b2 = etl::philox4x32::block(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+
+    REQUIRE_EQUALS(b2[0], 0x408f276dU);
+    REQUIRE_EQUALS(b2[1], 0x41c83b0eU);
+    REQUIRE_EQUALS(b2[2], 0xa20bc7c6U);
+    REQUIRE_EQUALS(b2[3], 0x6d5451fdU);
+
+    auto b3 = etl::philox4x32::block(0x299f31d0a4093822ULL, 0x85a308d3243f6a88ULL, 0x0370734413198a2eULL);
+
+    REQUIRE_EQUALS(b3[0], 0xd16cfe09U);
+    REQUIRE_EQUALS(b3[1], 0x94fdccebU);
+    REQUIRE_EQUALS(b3[2], 0x5001e420U);
+    REQUIRE_EQUALS(b3[3], 0x24126ea1U);
+}
+
+TEST_CASE("random/seed/1", "[random]") {
+    etl::dyn_vector<double> a(100);
+    etl::dyn_vector<double> b(100);
+
+    etl::random_seed(42);
+    a = etl::normal_generator();
+
+    etl::random_seed(42);
+    b = etl::normal_generator();
+
+    REQUIRE_DIRECT(a == b);
+}
@@ -107,6 +107,31 @@ GEVM_TEST_CASE("gevm/4", "[gevm]") {
     }
 }
 
+GEVM_TEST_CASE("gevm/6", "[gevm]") {
+    etl::dyn_matrix<T> a(333, 257);
+    etl::dyn_vector<T> b(333);
+
+    etl::dyn_vector<T> c(257);
+    etl::dyn_vector<T> c_ref(257);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(b, a, c);
+
+    c_ref = 0;
+
+    for (size_t k = 0; k < 333; k++) {
+        for (size_t j = 0; j < 257; j++) {
+            c_ref(j) += b(k) * a(k, j);
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
+    }
+}
+
 GEVM_T_TEST_CASE("gevm_t/1", "[gevm][gevm_t]") {
     etl::dyn_matrix<T> a(512, 368);
     etl::dyn_vector<T> b(368);
@@ -157,6 +182,31 @@ GEVM_T_TEST_CASE("gevm_t/2", "[gevm][gevm_t]") {
     }
 }
 
+GEVM_T_TEST_CASE("gevm_t/3", "[gevm][gevm_t]") {
+    etl::dyn_matrix<T> a(257, 333);
+    etl::dyn_vector<T> b(333);
+
+    etl::dyn_vector<T> c(257);
+    etl::dyn_vector<T> c_ref(257);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(b, a, c);
+
+    c_ref = 0;
+
+    for (size_t j = 0; j < 257; j++) {
+        for (size_t k = 0; k < 333; k++) {
+            c_ref(j) += b(k) * a(j, k);
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
+    }
+}
+
 TEMPLATE_TEST_CASE_2("gevm/5", "[gevm]", T, float, double) {
     etl::dyn_matrix<T> a(64, 64);
     etl::dyn_vector<T> b(64);
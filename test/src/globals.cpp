@@ -745,3 +745,12 @@ ETL_TEST_CASE("globals/parallel_shuffle/3", "[globals]") {
     REQUIRE_DIRECT(a == c);
     REQUIRE_DIRECT(b == c);
 }
+
+ETL_TEST_CASE("globals/runtime_vector_mode/1", "[globals]") {
+    // The CPU running the tests must support the compiled vector mode
+    const bool supported = etl::runtime_vector_mode() >= etl::vector_mode;
+    const bool cached    = etl::runtime_vector_mode() == etl::detect_vector_mode();
+
+    REQUIRE_DIRECT(supported);
+    REQUIRE_DIRECT(cached);
+}
@@ -264,6 +264,35 @@ IFFT1_MANY_TEST_CASE("ifft_1d_many/2", "[fast][ifft]") {
     REQUIRE_EQUALS_APPROX(c(1, 3).imag(), T(-0.375));
 }
 
+IFFT1_MANY_TEST_CASE("ifft_1d_many/3", "[fast][ifft]") {
+    etl::fast_matrix<std::complex<T>, 2, 3, 4> a;
+    etl::fast_matrix<std::complex<T>, 2, 3, 4> c;
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            a(i, j, 0) = std::complex<T>(2.0, 1.0);
+            a(i, j, 1) = std::complex<T>(2.0, 3.0);
+            a(i, j, 2) = std::complex<T>(0.0, 4.0);
+            a(i, j, 3) = std::complex<T>(1.0, -2.0);
+        }
+    }
+
+    Impl::apply(a, c);
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j, 0).real(), T(1.25));
+            REQUIRE_EQUALS_APPROX(c(i, j, 0).imag(), T(1.5));
+            REQUIRE_EQUALS_APPROX(c(i, j, 1).real(), T(-0.75));
+            REQUIRE_EQUALS_APPROX(c(i, j, 1).imag(), T(-0.5));
+            REQUIRE_EQUALS_APPROX(c(i, j, 2).real(), T(-0.25));
+            REQUIRE_EQUALS_APPROX(c(i, j, 2).imag(), T(1.0));
+            REQUIRE_EQUALS_APPROX(c(i, j, 3).real(), T(1.75));
+            REQUIRE_EQUALS_APPROX(c(i, j, 3).imag(), T(-1.0));
+        }
+    }
+}
+
 //ifft many inplace
 
 TEMPLATE_TEST_CASE_2("ifft_1d_many_inplace/1", "[fast][ifft]", T, double, float) {
@@ -39,6 +39,52 @@ TEMPLATE_TEST_CASE_2("ml/relu/backward/1", "[ml]", Z, double, float) {
     REQUIRE_EQUALS_APPROX(dx[3], Z(0.5));
 }
 
+TEMPLATE_TEST_CASE_2("ml/tanh/backward/1", "[ml]", Z, double, float) {
+    etl::dyn_vector<Z> x  = {-1.0, 2.0, 0.0, 0.5};
+    etl::dyn_vector<Z> dy = {1.0, 2.0, 3.0, 0.5};
+
+    etl::dyn_vector<Z> y;
+    y = etl::tanh(x);
+
+    etl::dyn_vector<Z> dx;
+    dx = etl::ml::tanh_backward(y, dy);
+
+    REQUIRE_EQUALS_APPROX(dx[0], Z(0.419974));
+    REQUIRE_EQUALS_APPROX(dx[1], Z(0.141302));
+    REQUIRE_EQUALS_APPROX(dx[2], Z(3.0));
+    REQUIRE_EQUALS_APPROX(dx[3], Z(0.393224));
+}
+
+TEMPLATE_TEST_CASE_2("ml/activations/backward/2", "[ml]", Z, double, float) {
+    etl::dyn_vector<Z> x(37);
+    etl::dyn_vector<Z> dy(37);
+
+    for (size_t i = 0; i < 37; ++i) {
+        x[i]  = Z(-4.5) + Z(0.25) * i;
+        dy[i] = Z(0.1) * i;
+    }
+
+    etl::dyn_vector<Z> s;
+    etl::dyn_vector<Z> t;
+    s = etl::sigmoid(x);
+    t = etl::tanh(x);
+
+    etl::dyn_vector<Z> ds;
+    etl::dyn_vector<Z> dt;
+    ds = etl::ml::sigmoid_backward(s, dy);
+    dt = etl::ml::tanh_backward(t, dy);
+
+    for (size_t i = 0; i < 37; ++i) {
+        Z ss = Z(1) / (Z(1) + std::exp(-x[i]));
+        Z tt = std::tanh(x[i]);
+
+        REQUIRE_EQUALS_APPROX(s[i], ss);
+        REQUIRE_EQUALS_APPROX(t[i], tt);
+        REQUIRE_EQUALS_APPROX(ds[i], ss * (Z(1) - ss) * dy[i]);
+        REQUIRE_EQUALS_APPROX(dt[i], (Z(1) - tt * tt) * dy[i]);
+    }
+}
+
 TEMPLATE_TEST_CASE_2("ml/cce/loss/1", "[ml]", Z, double, float) {
     etl::dyn_vector<Z> o(137);
     etl::dyn_vector<Z> l(137);
@@ -0,0 +1,157 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+/*
+ * These tests call the runtime dispatched kernels directly. When
+ * ETL_RUNTIME_DISPATCH is defined, they run the version selected for
+ * the current CPU, otherwise the generic version.
+ *
+ * The sizes are chosen to not be multiples of the vector sizes, nor of
+ * the blocks of the GEMM kernel.
+ */
+
+TEMPLATE_TEST_CASE_2("runtime_dispatch/sum/0", "[dispatch][sum]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 13) * Z(0.25) - Z(1.0);
+    }
+
+    Z ref(0);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        ref += a[i];
+    }
+
+    REQUIRE_EQUALS_APPROX(etl::detail::dispatch_sum(a.memory_start(), etl::size(a)), ref);
+    REQUIRE_EQUALS_APPROX(etl::detail::dispatch_sum(a.memory_start(), 7), Z(-1.75));
+}
+
+TEMPLATE_TEST_CASE_2("runtime_dispatch/dot/0", "[dispatch][dot]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 13) * Z(0.25) - Z(1.0);
+        b[i] = Z(i % 7) * Z(0.5);
+    }
+
+    Z ref(0);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        ref += a[i] * b[i];
+    }
+
+    REQUIRE_EQUALS_APPROX(etl::detail::dispatch_dot(a.memory_start(), b.memory_start(), etl::size(a)), ref);
+}
+
+TEMPLATE_TEST_CASE_2("runtime_dispatch/gemm/0", "[dispatch][gemm]", Z, float, double) {
+    const size_t M = 7;
+    const size_t N = 529;
+    const size_t K = 133;
+
+    etl::dyn_matrix<Z> a(M, K);
+    etl::dyn_matrix<Z> b(K, N);
+    etl::dyn_matrix<Z> c(M, N);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 11) * Z(0.125) - Z(0.5);
+    }
+
+    for (size_t i = 0; i < etl::size(b); ++i) {
+        b[i] = Z(i % 5) * Z(0.25) - Z(0.5);
+    }
+
+    // Must be fully overwritten by the kernel
+    c = Z(42.0);
+
+    etl::detail::dispatch_gemm_rr(a.memory_start(), b.memory_start(), c.memory_start(), M, N, K);
+
+    for (size_t i = 0; i < M; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            Z ref(0);
+
+            for (size_t k = 0; k < K; ++k) {
+                ref += a(i, k) * b(k, j);
+            }
+
+            REQUIRE_EQUALS_APPROX(c(i, j), ref);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("runtime_dispatch/gemm/1", "[dispatch][gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(19, 37);
+    etl::dyn_matrix<Z> b(37, 23);
+    etl::dyn_matrix<Z> c(19, 23);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 11) * Z(0.125) - Z(0.5);
+    }
+
+    for (size_t i = 0; i < etl::size(b); ++i) {
+        b[i] = Z(i % 5) * Z(0.25) - Z(0.5);
+    }
+
+    // The standard implementation uses the dispatched kernel when enabled
+    c = selected_helper(etl::gemm_impl::STD, a * b);
+
+    for (size_t i = 0; i < etl::rows(c); ++i) {
+        for (size_t j = 0; j < etl::columns(c); ++j) {
+            Z ref(0);
+
+            for (size_t k = 0; k < etl::columns(a); ++k) {
+                ref += a(i, k) * b(k, j);
+            }
+
+            REQUIRE_EQUALS_APPROX(c(i, j), ref);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("runtime_dispatch/assign/0", "[dispatch][assign]", Z, float, double) {
+    etl::dyn_vector<Z> a(531);
+    etl::dyn_vector<Z> b(531);
+    etl::dyn_vector<Z> c(531);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 13) * Z(0.25) - Z(1.0);
+        b[i] = Z(i % 7) * Z(0.5);
+    }
+
+    etl::detail::dispatch_assign(c.memory_start(), a + Z(2.0) * b, etl::size(c));
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], a[i] + Z(2.0) * b[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("runtime_dispatch/assign/1", "[dispatch][assign]", Z, float, double) {
+    etl::dyn_matrix<Z> a(17, 33);
+    etl::dyn_matrix<Z> b(17, 33);
+    etl::dyn_matrix<Z> c(17, 33);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 13) * Z(0.25) - Z(1.0);
+        b[i] = Z(i % 7) * Z(0.5);
+    }
+
+    // Goes through the assign functors
+    c = a >> b;
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS(c[i], a[i] * b[i]);
+    }
+
+    c = a - b;
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS(c[i], a[i] - b[i]);
+    }
+}
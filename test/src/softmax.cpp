@@ -106,3 +106,56 @@ TEMPLATE_TEST_CASE_2("stable_softmax/2", "fast_vector::softmax", Z, float, doubl
         REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
     }
 }
+
+TEMPLATE_TEST_CASE_2("softmax/6", "softmax", Z, float, double) {
+    etl::dyn_matrix<Z> a(7, 37);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 13) % 29) * Z(0.25) - Z(3.0);
+    }
+
+    etl::dyn_matrix<Z> c(7, 37);
+    c = etl::softmax(a);
+
+    for (size_t i = 0; i < 7; ++i) {
+        Z sum = 0;
+
+        for (size_t j = 0; j < 37; ++j) {
+            sum += std::exp(a(i, j));
+        }
+
+        for (size_t j = 0; j < 37; ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j), std::exp(a(i, j)) / sum);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("stable_softmax/3", "stable_softmax", Z, float, double) {
+    // Large values, the exponentials would overflow without the max
+    etl::dyn_matrix<Z> a(5, 21);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(1000.0) + Z((i * 7) % 19) * Z(0.5);
+    }
+
+    etl::dyn_matrix<Z> c(5, 21);
+    c = etl::stable_softmax(a);
+
+    for (size_t i = 0; i < 5; ++i) {
+        Z m = a(i, 0);
+
+        for (size_t j = 1; j < 21; ++j) {
+            m = std::max(m, a(i, j));
+        }
+
+        Z sum = 0;
+
+        for (size_t j = 0; j < 21; ++j) {
+            sum += std::exp(a(i, j) - m);
+        }
+
+        for (size_t j = 0; j < 21; ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j), std::exp(a(i, j) - m) / sum);
+        }
+    }
+}
@@ -0,0 +1,276 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+#include <tuple>
+
+TEMPLATE_TEST_CASE_2("sparse_csr/traits/1", "[mat][init][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 4);
+
+    REQUIRE_DIRECT(etl::is_etl_expr<decltype(a)>);
+    REQUIRE_DIRECT(etl::is_sparse_matrix<decltype(a)>);
+    REQUIRE_EQUALS(etl::rows(a), 3UL);
+    REQUIRE_EQUALS(etl::columns(a), 4UL);
+    REQUIRE_EQUALS(etl::size(a), 12UL);
+    REQUIRE_EQUALS(a.non_zeros(), 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/init/1", "[mat][init][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+
+    REQUIRE_EQUALS(a.size(), 6UL);
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(1.0));
+    REQUIRE_EQUALS(a.get(0, 1), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 0), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(2.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 1), Z(0.0));
+
+    REQUIRE_EQUALS(a.row_pointers()[0], 0UL);
+    REQUIRE_EQUALS(a.row_pointers()[1], 1UL);
+    REQUIRE_EQUALS(a.row_pointers()[2], 2UL);
+    REQUIRE_EQUALS(a.row_pointers()[3], 3UL);
+    REQUIRE_EQUALS(a.column_indices()[1], 1UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/set/1", "[mat][set][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 3);
+
+    a.set(1, 1, 42);
+
+    REQUIRE_EQUALS(a.get(1, 1), 42);
+    REQUIRE_EQUALS(a.non_zeros(), 1UL);
+
+    a.set(2, 2, 2);
+    a.set(0, 0, 1);
+    a.set(1, 0, 3);
+
+    REQUIRE_EQUALS(a.get(0, 0), 1);
+    REQUIRE_EQUALS(a.get(1, 0), 3);
+    REQUIRE_EQUALS(a.get(1, 1), 42);
+    REQUIRE_EQUALS(a.get(2, 2), 2);
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+
+    a.set(2, 2, -2.0);
+    a.set(1, 1, 0.0);
+
+    REQUIRE_EQUALS(a.get(1, 0), 3);
+    REQUIRE_EQUALS(a.get(1, 1), 0);
+    REQUIRE_EQUALS(a.get(2, 2), -2.0);
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/reference/1", "[mat][reference][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 3);
+
+    a(0, 0) = 1.0;
+    a(1, 1) = 42;
+    a(2, 2) = 2;
+    a(2, 2) += Z(1);
+
+    REQUIRE_EQUALS(a(0, 0), 1.0);
+    REQUIRE_EQUALS(a(0, 1), 0.0);
+    REQUIRE_EQUALS(a.get(1, 1), 42);
+    REQUIRE_EQUALS(a.get(2, 2), 3.0);
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+
+    a(0, 0) = 0.0;
+
+    REQUIRE_EQUALS(a.get(0, 0), 0.0);
+    REQUIRE_EQUALS(a.non_zeros(), 2UL);
+
+    REQUIRE_EQUALS(a[4], 42.0);
+    REQUIRE_EQUALS(a[5], 0.0);
+    REQUIRE_EQUALS(a.non_zeros(), 2UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/erase/1", "[mat][erase][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+
+    a.erase(0, 0);
+    a.erase(0, 0);
+
+    REQUIRE_EQUALS(a.get(0, 0), 0.0);
+    REQUIRE_EQUALS(a.get(1, 1), 2.0);
+    REQUIRE_EQUALS(a.get(2, 0), 3.0);
+    REQUIRE_EQUALS(a.non_zeros(), 2UL);
+
+    a.erase(1, 1);
+    a.erase(2, 0);
+
+    REQUIRE_EQUALS(a.get(2, 0), 0.0);
+    REQUIRE_EQUALS(a.non_zeros(), 0UL);
+
+    a.set(2, 0, 3);
+
+    REQUIRE_EQUALS(a.get(2, 0), 3.0);
+    REQUIRE_EQUALS(a.non_zeros(), 1UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/random/1", "[mat][set][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(37, 53);
+    etl::dyn_matrix<Z> ref(37, 53);
+
+    ref = Z(0);
+
+    for (size_t k = 0; k < 2000; ++k) {
+        const size_t i = (k * 7919) % 37;
+        const size_t j = (k * 104729) % 53;
+        const Z v      = (k % 5 == 0) ? Z(0) : Z(k % 17);
+
+        a.set(i, j, v);
+        ref(i, j) = v;
+    }
+
+    size_t nnz = 0;
+
+    for (size_t i = 0; i < 37; ++i) {
+        for (size_t j = 0; j < 53; ++j) {
+            REQUIRE_EQUALS(a.get(i, j), ref(i, j));
+
+            nnz += ref(i, j) != Z(0);
+        }
+    }
+
+    REQUIRE_EQUALS(a.non_zeros(), nnz);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/triplets/1", "[mat][init][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 4);
+
+    a.set(0, 0, 9.0);
+
+    std::vector<std::tuple<size_t, size_t, Z>> triplets{
+        std::make_tuple(2UL, 3UL, Z(1.0)),
+        std::make_tuple(0UL, 2UL, Z(2.0)),
+        std::make_tuple(2UL, 0UL, Z(3.0)),
+        std::make_tuple(0UL, 1UL, Z(4.0)),
+        std::make_tuple(2UL, 3UL, Z(5.0)),
+        std::make_tuple(1UL, 1UL, Z(1.0)),
+        std::make_tuple(1UL, 1UL, Z(-1.0))};
+
+    a.build_from_triplets(triplets.begin(), triplets.end());
+
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(0.0));
+    REQUIRE_EQUALS(a.get(0, 1), Z(4.0));
+    REQUIRE_EQUALS(a.get(0, 2), Z(2.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(0.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 3), Z(6.0));
+
+    REQUIRE_EQUALS(a.row_pointers()[1], 2UL);
+    REQUIRE_EQUALS(a.row_pointers()[2], 2UL);
+    REQUIRE_EQUALS(a.row_pointers()[3], 4UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/copy/1", "[mat][reference][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 3);
+    etl::sparse_csr_matrix<Z> b(3, 3);
+
+    a(1, 1) = 42;
+    a(0, 0) = 1.0;
+    a(2, 2) = 2.0;
+
+    b = a;
+
+    REQUIRE_EQUALS(b.get(0, 0), 1.0);
+    REQUIRE_EQUALS(b.get(1, 1), 42.0);
+    REQUIRE_EQUALS(b.get(2, 2), 2.0);
+    REQUIRE_EQUALS(b.non_zeros(), 3UL);
+
+    etl::sparse_csr_matrix<Z> c(a);
+    etl::sparse_csr_matrix<Z> d(std::move(a));
+
+    REQUIRE_EQUALS(a.non_zeros(), 0UL);
+
+    REQUIRE_EQUALS(c.get(1, 1), 42.0);
+    REQUIRE_EQUALS(c.non_zeros(), 3UL);
+    REQUIRE_EQUALS(d.get(2, 2), 2.0);
+    REQUIRE_EQUALS(d.non_zeros(), 3UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/move/1", "[mat][reference][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 3);
+    etl::sparse_csr_matrix<Z> b(2, 4);
+
+    a(1, 1) = 42;
+    a(0, 0) = 1.0;
+
+    b(1, 3) = 5.0;
+
+    a = std::move(b);
+
+    REQUIRE_EQUALS(b.non_zeros(), 0UL);
+    REQUIRE_EQUALS(etl::size(b), 0UL);
+
+    REQUIRE_EQUALS(etl::dim<0>(a), 2UL);
+    REQUIRE_EQUALS(etl::dim<1>(a), 4UL);
+    REQUIRE_EQUALS(a.get(1, 3), 5.0);
+    REQUIRE_EQUALS(a.get(1, 1), 0.0);
+    REQUIRE_EQUALS(a.non_zeros(), 1UL);
+    REQUIRE_EQUALS(a.row_pointers()[2], 1UL);
+
+    a(0, 0) = 2.0;
+
+    REQUIRE_EQUALS(a.get(0, 0), 2.0);
+    REQUIRE_EQUALS(a.non_zeros(), 2UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/empty/1", "[mat][init][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a;
+    etl::sparse_csr_matrix<Z> b;
+
+    std::vector<std::tuple<size_t, size_t, Z>> triplets;
+
+    a.build_from_triplets(triplets.begin(), triplets.end());
+
+    REQUIRE_EQUALS(a.non_zeros(), 0UL);
+    REQUIRE_EQUALS(a.row_pointers()[0], 0UL);
+
+    b = a;
+
+    REQUIRE_EQUALS(b.non_zeros(), 0UL);
+
+    etl::sparse_csr_matrix<Z> c;
+    etl::sparse_csr_matrix<Z> d;
+
+    d = c;
+
+    REQUIRE_EQUALS(d.non_zeros(), 0UL);
+    REQUIRE_EQUALS(d.row_pointers()[0], 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_csr/add/1", "[mat][add][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::sparse_csr_matrix<Z> b(3, 2, std::initializer_list<Z>({2.0, 1.0, 0.0, 3.0, 0.0, 0.0}));
+    etl::sparse_csr_matrix<Z> c;
+
+    c = a + b;
+
+    REQUIRE_EQUALS(etl::dim<0>(c), 3UL);
+    REQUIRE_EQUALS(etl::dim<1>(c), 2UL);
+    REQUIRE_EQUALS(c.non_zeros(), 4UL);
+
+    REQUIRE_EQUALS(c.get(0, 0), 3.0);
+    REQUIRE_EQUALS(c.get(0, 1), 1.0);
+    REQUIRE_EQUALS(c.get(1, 0), 0.0);
+    REQUIRE_EQUALS(c.get(1, 1), 5.0);
+    REQUIRE_EQUALS(c.get(2, 0), 3.0);
+    REQUIRE_EQUALS(c.get(2, 1), 0.0);
+
+    etl::dyn_matrix<Z> d;
+    d = a >> b;
+
+    REQUIRE_EQUALS(d(0, 0), 2.0);
+    REQUIRE_EQUALS(d(1, 1), 6.0);
+    REQUIRE_EQUALS(d(2, 0), 0.0);
+}
@@ -0,0 +1,128 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("sparse_gemv/1", "[gemv][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::dyn_vector<Z> b{2.0, 3.0};
+    etl::dyn_vector<Z> c(3);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0), 2.0);
+    REQUIRE_EQUALS(c(1), 6.0);
+    REQUIRE_EQUALS(c(2), 6.0);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_gemv/2", "[gemv][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::dyn_vector<Z> b{2.0, 3.0};
+    etl::dyn_vector<Z> c(3);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0), 2.0);
+    REQUIRE_EQUALS(c(1), 6.0);
+    REQUIRE_EQUALS(c(2), 6.0);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_gevm/1", "[gevm][sparse]", Z, double, float) {
+    etl::dyn_vector<Z> a{1.0, 2.0, 3.0};
+    etl::sparse_matrix<Z> b(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::dyn_vector<Z> c(2);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0), 10.0);
+    REQUIRE_EQUALS(c(1), 4.0);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_gevm/2", "[gevm][sparse]", Z, double, float) {
+    etl::dyn_vector<Z> a{1.0, 2.0, 3.0};
+    etl::sparse_csr_matrix<Z> b(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::dyn_vector<Z> c(2);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0), 10.0);
+    REQUIRE_EQUALS(c(1), 4.0);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_gemm/1", "[gemm][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::dyn_matrix<Z> b(2, 2, std::initializer_list<Z>({1.0, 2.0, 3.0, 4.0}));
+    etl::dyn_matrix<Z> c(3, 2);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0, 0), 1.0);
+    REQUIRE_EQUALS(c(0, 1), 2.0);
+    REQUIRE_EQUALS(c(1, 0), 6.0);
+    REQUIRE_EQUALS(c(1, 1), 8.0);
+    REQUIRE_EQUALS(c(2, 0), 3.0);
+    REQUIRE_EQUALS(c(2, 1), 6.0);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_gemm/2", "[gemm][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> a(2, 3, std::initializer_list<Z>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+    etl::sparse_csr_matrix<Z> b(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::dyn_matrix<Z> c(2, 2);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0, 0), 10.0);
+    REQUIRE_EQUALS(c(0, 1), 4.0);
+    REQUIRE_EQUALS(c(1, 0), 22.0);
+    REQUIRE_EQUALS(c(1, 1), 10.0);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_gemm/3", "[gemm][sparse]", Z, double, float) {
+    const size_t M = 97;
+    const size_t K = 53;
+    const size_t N = 71;
+
+    etl::sparse_csr_matrix<Z> a(M, K);
+    etl::sparse_matrix<Z> a_coo(M, K);
+    etl::dyn_matrix<Z> a_dense(M, K, Z(0));
+
+    for (size_t i = 0; i < M; ++i) {
+        for (size_t k = (i * 7) % 5; k < K; k += 5) {
+            a.set(i, k, Z(1 + (i + k) % 9));
+            a_coo.set(i, k, Z(1 + (i + k) % 9));
+            a_dense(i, k) = Z(1 + (i + k) % 9);
+        }
+    }
+
+    etl::dyn_matrix<Z> b(K, N);
+    etl::dyn_matrix<Z> bt(N, M);
+    b  = etl::sequence_generator(1.0) / Z(100.0);
+    bt = etl::sequence_generator(2.0) / Z(100.0);
+
+    etl::dyn_matrix<Z> c(M, N);
+    etl::dyn_matrix<Z> c_coo(M, N);
+    etl::dyn_matrix<Z> d(N, K);
+
+    c     = a * b;
+    c_coo = a_coo * b;
+    d     = bt * a;
+
+    etl::dyn_matrix<Z> c_ref(M, N);
+    etl::dyn_matrix<Z> d_ref(N, K);
+
+    c_ref = a_dense * b;
+    d_ref = bt * a_dense;
+
+    for (size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
+        REQUIRE_EQUALS_APPROX(c_coo[i], c_ref[i]);
+    }
+
+    for (size_t i = 0; i < d.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], d_ref[i]);
+    }
+}
@@ -344,3 +344,50 @@ TEMPLATE_TEST_CASE_2("sparse_matrix/copy/1", "[mat][reference][sparse]", Z, doub
     REQUIRE_EQUALS(b.get(2, 2), 2.0);
     REQUIRE_EQUALS(b.non_zeros(), 3UL);
 }
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/copy/2", "[mat][reference][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(3, 3);
+
+    a(1, 1) = 42;
+    a(0, 0) = 1.0;
+    a(2, 2) = 2.0;
+
+    etl::sparse_matrix<Z> b(a);
+
+    a(1, 1) = 3.0;
+
+    REQUIRE_EQUALS(b.get(0, 0), 1.0);
+    REQUIRE_EQUALS(b.get(1, 1), 42.0);
+    REQUIRE_EQUALS(b.get(2, 2), 2.0);
+    REQUIRE_EQUALS(b.non_zeros(), 3UL);
+    REQUIRE_EQUALS(a.get(1, 1), 3.0);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/move/1", "[mat][reference][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(3, 3);
+    etl::sparse_matrix<Z> c(2, 2);
+
+    a(1, 1) = 42;
+    a(0, 0) = 1.0;
+
+    c(1, 0) = 5.0;
+
+    etl::sparse_matrix<Z> b(std::move(a));
+
+    REQUIRE_EQUALS(a.non_zeros(), 0UL);
+    REQUIRE_EQUALS(etl::size(a), 0UL);
+
+    REQUIRE_EQUALS(b.get(0, 0), 1.0);
+    REQUIRE_EQUALS(b.get(1, 1), 42.0);
+    REQUIRE_EQUALS(b.non_zeros(), 2UL);
+
+    b = std::move(c);
+
+    REQUIRE_EQUALS(c.non_zeros(), 0UL);
+    REQUIRE_EQUALS(etl::size(c), 0UL);
+
+    REQUIRE_EQUALS(etl::dim<0>(b), 2UL);
+    REQUIRE_EQUALS(etl::dim<1>(b), 2UL);
+    REQUIRE_EQUALS(b.get(1, 0), 5.0);
+    REQUIRE_EQUALS(b.non_zeros(), 1UL);
+}
@@ -80,6 +80,46 @@ TRANSPOSE_TEST_CASE("transpose/dyn_matrix_2", "transpose") {
     REQUIRE_EQUALS(b(2, 1), -1);
 }
 
+TRANSPOSE_TEST_CASE("transpose/dyn_matrix_3", "transpose") {
+    etl::dyn_matrix<T> a(133, 70);
+    etl::dyn_matrix<T> b;
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(i);
+    }
+
+    Impl::apply(a, b);
+
+    REQUIRE_EQUALS(etl::dim<0>(b), 70UL);
+    REQUIRE_EQUALS(etl::dim<1>(b), 133UL);
+
+    for (size_t i = 0; i < 133; ++i) {
+        for (size_t j = 0; j < 70; ++j) {
+            REQUIRE_EQUALS_APPROX(b(j, i), a(i, j));
+        }
+    }
+}
+
+TRANSPOSE_TEST_CASE("transpose/dyn_matrix_4", "transpose") {
+    etl::dyn_matrix<T> a(128, 77);
+    etl::dyn_matrix<T> b;
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(i);
+    }
+
+    Impl::apply(a, b);
+
+    REQUIRE_EQUALS(etl::dim<0>(b), 77UL);
+    REQUIRE_EQUALS(etl::dim<1>(b), 128UL);
+
+    for (size_t i = 0; i < 128; ++i) {
+        for (size_t j = 0; j < 77; ++j) {
+            REQUIRE_EQUALS_APPROX(b(j, i), a(i, j));
+        }
+    }
+}
+
 INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/2", "[transpose]") {
     etl::dyn_matrix<T> a(3, 3, std::initializer_list<T>({1, 2, 3, 4, 5, 6, 7, 8, 9}));
 
@@ -179,6 +219,118 @@ INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/4", "transpose") {
     REQUIRE_EQUALS(a(4, 2), 15.0);
 }
 
+INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/5", "[transpose]") {
+    etl::dyn_matrix<T> a(75, 75);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(i);
+    }
+
+    Impl::apply(a);
+
+    for (size_t i = 0; i < 75; ++i) {
+        for (size_t j = 0; j < 75; ++j) {
+            REQUIRE_EQUALS_APPROX(a(j, i), T(i * 75 + j));
+        }
+    }
+}
+
+INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/6", "[transpose]") {
+    etl::dyn_matrix<T> a(600, 450);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(i % 1013);
+    }
+
+    Impl::apply(a);
+
+    REQUIRE_EQUALS(etl::dim<0>(a), 450UL);
+    REQUIRE_EQUALS(etl::dim<1>(a), 600UL);
+
+    for (size_t i = 0; i < 600; ++i) {
+        for (size_t j = 0; j < 450; ++j) {
+            REQUIRE_EQUALS_APPROX(a(j, i), T((i * 450 + j) % 1013));
+        }
+    }
+}
+
+INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/7", "[transpose]") {
+    etl::dyn_matrix<T> a(77, 101);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(i);
+    }
+
+    Impl::apply(a);
+
+    REQUIRE_EQUALS(etl::dim<0>(a), 101UL);
+    REQUIRE_EQUALS(etl::dim<1>(a), 77UL);
+
+    for (size_t i = 0; i < 77; ++i) {
+        for (size_t j = 0; j < 101; ++j) {
+            REQUIRE_EQUALS_APPROX(a(j, i), T(i * 101 + j));
+        }
+    }
+
+    Impl::apply(a);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(a[i], T(i));
+    }
+}
+
+INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/8", "[transpose]") {
+    // Tall and narrow, fewer columns than the transpose blocks
+    etl::dyn_matrix<T> a(1531, 7);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(i % 1013);
+    }
+
+    Impl::apply(a);
+
+    REQUIRE_EQUALS(etl::dim<0>(a), 7UL);
+    REQUIRE_EQUALS(etl::dim<1>(a), 1531UL);
+
+    for (size_t i = 0; i < 1531; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            REQUIRE_EQUALS_APPROX(a(j, i), T((i * 7 + j) % 1013));
+        }
+    }
+
+    Impl::apply(a);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(a[i], T(i % 1013));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("transpose/inplace_kernel/1", "[transpose]", Z, float, double) {
+    // The inplace kernel is only used above a threshold, test it directly
+    const size_t m = 2003;
+    const size_t n = 3;
+
+    etl::dyn_vector<Z> a(m * n);
+
+    for (size_t i = 0; i < m * n; ++i) {
+        a[i] = Z(i % 1013);
+    }
+
+    etl::impl::standard::detail::inplace_rectangular_transpose_kernel(a.memory_start(), m, n);
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS(a[j * m + i], Z((i * n + j) % 1013));
+        }
+    }
+
+    etl::impl::standard::detail::inplace_rectangular_transpose_kernel(a.memory_start(), n, m);
+
+    for (size_t i = 0; i < m * n; ++i) {
+        REQUIRE_EQUALS(a[i], Z(i % 1013));
+    }
+}
+
 TEMPLATE_TEST_CASE_2("transpose/expr_1", "transpose", Z, float, double) {
     etl::dyn_matrix<Z, 3> a(3, 3, 3, std::initializer_list<Z>({1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
 
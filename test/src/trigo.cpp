@@ -216,3 +216,146 @@ TEMPLATE_TEST_CASE_2("trigo/cosh/3", "[trigo][cosh]", Z, etl::complex<float>, et
         REQUIRE_EQUALS_APPROX(b[i].imag, etl::cosh(a[i]).imag);
     }
 }
+
+TEMPLATE_TEST_CASE_2("trigo/tanh/4", "[trigo][tanh]", Z, double, float) {
+    etl::dyn_vector<Z> a(41);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = Z(-5.0) + Z(0.25) * Z(i);
+    }
+
+    etl::dyn_vector<Z> b;
+    b = etl::tanh(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::tanh(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("trigo/sinh/4", "[trigo][sinh]", Z, double, float) {
+    etl::dyn_vector<Z> a(41);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = Z(-5.0) + Z(0.25) * Z(i);
+    }
+
+    etl::dyn_vector<Z> b;
+    b = etl::sinh(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::sinh(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("trigo/cosh/4", "[trigo][cosh]", Z, double, float) {
+    etl::dyn_vector<Z> a(41);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = Z(-5.0) + Z(0.25) * Z(i);
+    }
+
+    etl::dyn_vector<Z> b;
+    b = etl::cosh(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::cosh(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("trigo/special/0", "[trigo][exp]", Z, double, float) {
+    etl::dyn_vector<Z> a(16);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = i % 2 ? Z(1.0) : std::numeric_limits<Z>::quiet_NaN();
+    }
+
+    etl::dyn_vector<Z> b;
+
+    b = etl::exp(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        if (i % 2) {
+            REQUIRE_EQUALS_APPROX(b[i], std::exp(Z(1.0)));
+        } else {
+            REQUIRE_DIRECT(std::isnan(b[i]));
+        }
+    }
+
+    b = etl::tanh(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        if (i % 2) {
+            REQUIRE_EQUALS_APPROX(b[i], std::tanh(Z(1.0)));
+        } else {
+            REQUIRE_DIRECT(std::isnan(b[i]));
+        }
+    }
+
+    b = etl::sinh(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        if (i % 2) {
+            REQUIRE_EQUALS_APPROX(b[i], std::sinh(Z(1.0)));
+        } else {
+            REQUIRE_DIRECT(std::isnan(b[i]));
+        }
+    }
+}
+
+TEST_CASE("trigo/special/1", "[trigo][exp]") {
+    etl::dyn_vector<double> a(16);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = i % 2 ? std::numeric_limits<double>::infinity() : 1000.0;
+    }
+
+    etl::dyn_vector<double> b;
+    b = etl::exp(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_DIRECT(std::isinf(b[i]));
+    }
+}
+
+TEST_CASE("trigo/special/2", "[trigo][sin][cos]") {
+    etl::dyn_vector<double> a(16);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        switch (i % 4) {
+            case 0:
+                a[i] = std::numeric_limits<double>::infinity();
+                break;
+            case 1:
+                a[i] = -std::numeric_limits<double>::infinity();
+                break;
+            case 2:
+                a[i] = std::numeric_limits<double>::quiet_NaN();
+                break;
+            default:
+                a[i] = 0.5;
+                break;
+        }
+    }
+
+    etl::dyn_vector<double> b;
+
+    b = etl::sin(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        if (i % 4 == 3) {
+            REQUIRE_EQUALS_APPROX(b[i], std::sin(0.5));
+        } else {
+            REQUIRE_DIRECT(std::isnan(b[i]));
+        }
+    }
+
+    b = etl::cos(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        if (i % 4 == 3) {
+            REQUIRE_EQUALS_APPROX(b[i], std::cos(0.5));
+        } else {
+            REQUIRE_DIRECT(std::isnan(b[i]));
+        }
+    }
+}
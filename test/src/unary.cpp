@@ -642,6 +642,21 @@ TEMPLATE_TEST_CASE_2("exp/1", "[exp]", Z, float, double) {
     REQUIRE_EQUALS_APPROX(d[7], std::exp(Z(6.1)));
 }
 
+TEMPLATE_TEST_CASE_2("exp/2", "[exp]", Z, float, double) {
+    etl::dyn_vector<Z> a(37);
+
+    for (size_t i = 0; i < 37; ++i) {
+        a[i] = Z(-4.0) + Z(0.25) * Z(i);
+    }
+
+    etl::dyn_vector<Z> d;
+    d = exp(a);
+
+    for (size_t i = 0; i < 37; ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], std::exp(a[i]));
+    }
+}
+
 constexpr bool binary(double a) {
     return a == 0.0 || a == 1.0;
 }
@@ -669,3 +684,41 @@ TEMPLATE_TEST_CASE_2("fast_matrix/r_bernoulli", "fast_matrix::r_bernoulli", Z, f
     REQUIRE_DIRECT(binary(d[2]));
     REQUIRE_DIRECT(binary(d[3]));
 }
+
+TEMPLATE_TEST_CASE_2("dyn_vector/noise/1", "[noise]", Z, float, double) {
+    etl::dyn_vector<Z> a(103);
+
+    for (size_t i = 0; i < 103; ++i) {
+        a[i] = Z(i) / Z(103);
+    }
+
+    auto u = etl::uniform_noise(a);
+    auto n = etl::normal_noise(a);
+    auto b = etl::bernoulli(a);
+    auto r = etl::r_bernoulli(a);
+
+    etl::dyn_vector<Z> du;
+    etl::dyn_vector<Z> dn;
+    etl::dyn_vector<Z> db;
+    etl::dyn_vector<Z> dr;
+
+    du = u;
+    dn = n;
+    db = b;
+    dr = r;
+
+    // The evaluation of the whole expression gives the same values as
+    // the evaluation of each element
+
+    for (size_t i = 0; i < 103; ++i) {
+        REQUIRE_EQUALS(du[i], u[i]);
+        REQUIRE_EQUALS_APPROX(dn[i], n[i]);
+        REQUIRE_EQUALS(db[i], b[i]);
+        REQUIRE_EQUALS(dr[i], r[i]);
+
+        REQUIRE_DIRECT(du[i] >= a[i]);
+        REQUIRE_DIRECT(du[i] <= a[i] + 1.0);
+        REQUIRE_DIRECT(binary(db[i]));
+        REQUIRE_DIRECT(binary(dr[i]));
+    }
+}